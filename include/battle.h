@@ -313,6 +313,33 @@ struct SimulatedDamage
     u16 maximum;
 };
 
+// An AI_CalcDamage result, see AI_DAMAGE_CACHE_SIZE. hash covers the
+// arguments and the battle state that the damage depends on.
+struct AiDamageCacheEntry
+{
+    u32 hash;
+    u16 move;
+    u8 battlerAtk:2;
+    u8 battlerDef:2;
+    u8 considerGimmickAtk:1;
+    u8 considerGimmickDef:1;
+    u8 isValid:1;
+    u8 padding:1;
+    uq4_12_t effectiveness;
+    struct SimulatedDamage damage;
+};
+
+// Which move on which target SetAiLogicDataForTurn simulates next.
+struct AiMovesDataProgress
+{
+    u32 weather;
+    u8 battlerAtk;
+    u8 battlerDef;
+    u8 moveIndex;
+    u8 inProgress:1;
+    u8 padding:7;
+};
+
 // Ai Data used when deciding which move to use, computed only once before each turn's start.
 struct AiLogicData
 {
@@ -342,6 +369,10 @@ struct AiLogicData
     u8 aiCalcInProgress:1;
     u8 battlerDoingPrediction; // Stores which battler is currently running its prediction calcs
     u16 predictedMove[MAX_BATTLERS_COUNT];
+    struct AiMovesDataProgress movesDataProgress; // Damage simulation left over from SetAiLogicDataForTurn, see ContinueAiLogicDataForTurn.
+#if AI_DAMAGE_CACHE_SIZE
+    struct AiDamageCacheEntry damageCache[AI_DAMAGE_CACHE_SIZE]; // Cleared with the rest of this struct at the start of every turn.
+#endif
 };
 
 struct AiThinkingStruct
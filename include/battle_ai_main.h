@@ -115,6 +115,9 @@ void Ai_InitPartyStruct(void);
 void Ai_UpdateSwitchInData(u32 battler);
 void Ai_UpdateFaintData(u32 battler);
 void SetAiLogicDataForTurn(struct AiLogicData *aiData);
+bool32 ContinueAiLogicDataForTurn(u32 cycleBudget);
+void FinishAiLogicDataForTurn(void);
+bool32 IsAiLogicDataForTurnFinished(void);
 void ResetDynamicAiFunc(void);
 
 #endif // GUARD_BATTLE_AI_MAIN_H
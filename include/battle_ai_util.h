@@ -44,6 +44,14 @@ enum AIConsiderGimmick
     USE_GIMMICK,
 };
 
+struct AiDamageCacheStats
+{
+    u32 hits;
+    u32 misses;
+};
+
+extern struct AiDamageCacheStats gAiDamageCacheStats;
+
 static inline bool32 IsMoveUnusable(u32 moveIndex, u32 move, u32 moveLimitations)
 {
     return move == MOVE_NONE
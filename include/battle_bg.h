@@ -17,6 +17,7 @@ void DrawBattleEntryBackground(void);
 void InitLinkBattleVsScreen(u8 taskId);
 void LoadBattleMenuWindowGfx(void);
 void LoadBattleTextboxAndBackground(void);
+void LoadBattleTextboxAndBackgroundOverFrames(void);
 void BattleInitBgsAndWindows(void);
 void DrawMainBattleBackground(void);
 void DrawTerrainTypeBattleBackground(void);
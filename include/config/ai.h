@@ -79,4 +79,8 @@
 #define FRIENDLY_FIRE_NORMAL_THRESHOLD          3
 #define FRIENDLY_FIRE_CONSERVATIVE_THRESHOLD    4
 
+// AI damage simulation
+#define AI_DATA_CYCLES_PER_FRAME                                40000 // How many CPU cycles per frame the AI may spend simulating the damage of every move on every target while the player chooses an action. AI battlers decide once it is done. Set to 0 to simulate all of it at the start of the turn in one go.
+#define AI_DAMAGE_CACHE_SIZE                                    64    // How many AI_CalcDamage results are remembered for the rest of the turn, so that scoring, switching and Tera decisions don't simulate the same move against the same state again. Set to 0 to turn it off. See gAiDamageCacheStats and T_AI_DAMAGE_CACHE_VERIFY.
+
 #endif // GUARD_CONFIG_AI_H
@@ -356,6 +356,9 @@
 //  Battle UI settings
 #define B_MOVE_REARRANGEMENT_IN_BATTLE  GEN_LATEST  //  In Gen 4+ move slots cannot be rearranged in battle
 
+// Performance settings
+#define B_CACHE_BATTLER_EFFECTS             FALSE    // If set to TRUE, GetBattlerAbility and GetBattlerHoldEffect remember what they worked out from each battler's own state until that state changes, instead of looking it up again on every call. Neutralizing Gas and Mold Breaker are still checked on every call. Off until its saving is measured, see the benchmark in test/battle/battler_effect_cache.c. See DEBUG_BATTLER_EFFECT_CACHE.
+
 #define B_POOL_SETTING_CONSISTENT_RNG       FALSE    // If set to true, the same trainer will always generate the same pool on the same save file
 #define B_POOL_SETTING_USE_FIXED_SEED       FALSE    // If set to true, will use the fixed seed defined in B_POOL_SETTING_FIXED_SEED
 #define B_POOL_SETTING_FIXED_SEED           0x1D4127 // "Random" number, unless a mistake was made, it's へだら in Emerald charmap which should spell he-da-ra
@@ -10,6 +10,10 @@
 // Battle Debug Menu
 #define DEBUG_BATTLE_MENU               TRUE    // If set to TRUE, enables a debug menu to use in battles by pressing the Select button.
 #define DEBUG_AI_DELAY_TIMER            FALSE   // If set to TRUE, displays the number of frames it takes for the AI to choose a move. Replaces the "What will PKMN do" text. Useful for devs or anyone who modifies the AI code and wants to see if it doesn't take too long to run.
+#define DEBUG_BATTLER_EFFECT_CACHE      FALSE   // If set to TRUE, checks every ability and hold effect that B_CACHE_BATTLER_EFFECTS returns against working it out again, and prints any difference through DebugPrintf. Requires DEBUG=1.
+
+// Performance Debug
+#define DEBUG_FRAME_PROFILER            FALSE   // If set to TRUE, measures how many cycles each part of the main loop, each task and each sprite callback takes, and prints it through DebugPrintf every 60 frames. Requires DEBUG=1. Summarize an mGBA log with tools/frame_profiler/report.py.
 
 // Pokémon Debug
 #define DEBUG_POKEMON_SPRITE_VISUALIZER TRUE    // Enables a debug menu for Pokémon sprites and icons, accessed by pressing Select in the summary screen.
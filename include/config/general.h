@@ -78,6 +78,11 @@
 #define COMPETITIVE_PARTY_SYNTAX     TRUE    // If TRUE, parties are defined in "competitive syntax".
 #define AUTO_SCROLL_TEXT             FALSE   // If TRUE, text will automatically scroll to the next line after NUM_FRAMES_AUTO_SCROLL_DELAY. Players can still press A_BUTTON or B_BUTTON to scroll on their own.
 #define NUM_FRAMES_AUTO_SCROLL_DELAY 49
+#define SPRITE_CACHE_SIZE            0       // Bytes of EWRAM used to keep recently decompressed sprite sheets and Pokémon pics around, see src/sprite_cache.c. Every 4096 bytes holds one sheet, 0 disables the cache. Off until the decode cycles it saves are measured against the EWRAM it costs, see test/sprite_cache.c.
+#define DMA3_VBLANK_BYTE_BUDGET      (40 * 1024) // The most bytes ProcessDma3Requests copies in one VBlank. OAM and sprite tiles go first, then palettes, bg tiles and tilemaps, and anything else last.
+#define DMA3_MAX_WAIT_VBLANKS        4       // Requests that were pending for this many VBlanks go before any newer ones, regardless of their priority. At most 255.
+#define GLYPH_CACHE_SLOTS            64      // Decompressed glyphs that text printers keep in EWRAM, keyed by font, glyph and colors. Every slot takes 136 bytes, 0 disables the cache. Must be even.
+#define DECOMPRESSION_STREAM_CYCLE_BUDGET 70000 // The max number of cycles a streamed decompression task may use per frame, see CreateDecompressionTask. A frame is 280896 cycles.
 
 // Measurement system constants to be used for UNITS
 #define UNITS_IMPERIAL               0       // Inches, feet, pounds
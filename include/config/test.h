@@ -1142,6 +1142,19 @@
 // Compression DebugPrintf switch
 #define T_COMPRESSION_SHOULD_PRINT FALSE
 
+//  Heap usage
+#define T_HEAP_FRAGMENTATION_LIMIT 0    //  If not 0, fails every test where more than this percentage of the heap was free but outside of the largest free block at some point, see GetHeapFragmentation.
+#define T_HEAP_PROFILE             FALSE    //  If TRUE, tracks the peak heap usage and the bytes allocated by every Alloc call site of each test. mgba-rom-test-hydra prints the tests and call sites that used the most heap.
+
+//  Headless runs
+#define T_HEADLESS_TURBO           FALSE    //  If TRUE, headless test runs start the next frame as soon as the last one is done instead of waiting for VBlank, and skip copying OAM, palettes and scanline effects to the display. Game logic still sees one VBlank per frame. Off until the full suite has been run and timed in both modes.
+
+//  AI damage cache
+#define T_AI_DAMAGE_CACHE_VERIFY   TRUE     //  If TRUE, every AI_CalcDamage result that comes from the cache is worked out again, and the test fails if the two differ. See AI_DAMAGE_CACHE_SIZE.
+
+//  Battler effect cache
+#define T_BATTLER_EFFECT_CACHE_VERIFY TRUE  //  If TRUE, every ability and hold effect that B_CACHE_BATTLER_EFFECTS returns is worked out again outside of benchmarks, and the test fails if the two differ.
+
 //  Move animation testing
 #define T_SHOULD_RUN_MOVE_ANIM  FALSE       //  If TRUE, enables the move animation tests, these are very computationally heavy and takes a long time to run.
 
@@ -62,6 +62,37 @@ enum CompressionMode {
     IS_TILEMAP = 8,
 };
 
+enum DecompressionStreamState {
+    STREAM_DECODE_LO,
+    STREAM_DECODE_SYMS,
+    STREAM_DECODE_INSTRUCTIONS,
+    STREAM_DECODE_WHOLE,
+    STREAM_DONE,
+};
+
+//  Resumable decompression of a single asset, see ContinueDecompressionStream
+struct DecompressionStream {
+    const u32 *src;
+    u16 *dest;
+    const u32 *loFreqs;
+    const u32 *symFreqs;
+    const u32 *dataPtr;
+    const u8 *loVec;
+    const u8 *loVecEnd;
+    const u16 *symVec;
+    void *buffer;
+    u16 loSize;
+    u16 symSize;
+    u16 copyLength;
+    u16 copyOffset;
+    u16 rawLength;
+    u16 workPerStep;
+    u8 mode;
+    u8 state;
+    u8 currState;
+    u8 bitIndex;
+};
+
 void DecompressDataWithHeaderVram(const u32 *src, void *dest);
 void DecompressDataWithHeaderWram(const u32 *src, void *dest);
 
@@ -84,4 +115,12 @@ void LoadSpecialPokePic(void *dest, s32 species, u32 personality, bool8 isFrontP
 
 u32 GetDecompressedDataSize(const u32 *ptr);
 
+void InitDecompressionStream(struct DecompressionStream *stream, const u32 *src, void *dest, u32 numSteps);
+bool32 ContinueDecompressionStream(struct DecompressionStream *stream, u32 cycleBudget);
+void FinishDecompressionStream(struct DecompressionStream *stream);
+u8 CreateDecompressionTask(const u32 *src, void *dest, u32 numFrames);
+u32 LoadCompressedSpriteSheetOverFrames(const struct CompressedSpriteSheet *src, u32 numFrames);
+bool32 IsDecompressionTaskActive(void);
+void FinishDecompressionTasks(void);
+
 #endif // GUARD_DECOMPRESS_H
@@ -54,10 +54,22 @@
 #define Dma3FillLarge16_(value, dest, size) Dma3FillLarge_(value, dest, size, 16)
 #define Dma3FillLarge32_(value, dest, size) Dma3FillLarge_(value, dest, size, 32)
 
+struct Dma3Stats
+{
+    u32 lastVBlankBytes; // Bytes copied or filled by the last ProcessDma3Requests.
+    u32 totalBytes;
+    u32 deferredBytes; // Bytes left pending at the end of each ProcessDma3Requests, added up.
+    u32 mergedRequests;
+    u32 maxWaitVBlanks; // The most VBlanks a request was pending for.
+};
+
+extern struct Dma3Stats gDma3Stats;
+
 // Cancel pending DMA3 requests
 void ClearDma3Requests(void);
 
-// Handle pending DMA3 requests
+// Handle pending DMA3 requests, by priority and up to
+// DMA3_VBLANK_BYTE_BUDGET bytes at a time
 void ProcessDma3Requests(void);
 
 // Copy size bytes from src to dest.
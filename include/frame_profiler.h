@@ -0,0 +1,59 @@
+#ifndef GUARD_FRAME_PROFILER_H
+#define GUARD_FRAME_PROFILER_H
+
+// Parts of a frame that DEBUG_FRAME_PROFILER measures. CALLBACK2 includes
+// the tasks, sprite callbacks and OAM building that it runs, and every
+// stage includes any interrupts that happened during it.
+enum FrameProfilerStage
+{
+    FRAME_STAGE_BUSY, // From the end of one VBlank wait to the start of the next.
+    FRAME_STAGE_CALLBACK1,
+    FRAME_STAGE_CALLBACK2,
+    FRAME_STAGE_TASKS,
+    FRAME_STAGE_SPRITE_CALLBACKS,
+    FRAME_STAGE_BUILD_OAM,
+    FRAME_STAGE_VBLANK,
+    FRAME_STAGE_COUNT,
+};
+
+#define FRAME_PROFILER_CYCLES_PER_FRAME 280896
+#define FRAME_PROFILER_CYCLES_PER_TICK 64
+// Frames are grouped into windows of this many frames, or fewer if
+// gMain.callback2 changes, and every window is reported on its own.
+#define FRAME_PROFILER_WINDOW_FRAMES 60
+// Histogram buckets are 10% of FRAME_PROFILER_CYCLES_PER_FRAME wide, and
+// the last one counts every frame that used the whole budget or more.
+#define FRAME_PROFILER_NUM_BUCKETS 11
+#define FRAME_PROFILER_MAX_FUNCS 64
+
+#if DEBUG_FRAME_PROFILER
+
+#ifdef NDEBUG
+#error "DEBUG_FRAME_PROFILER reports through DebugPrintf, which needs a DEBUG=1 build."
+#endif
+
+void FrameProfilerInit(void);
+void FrameProfilerEndFrame(u32 frameStart);
+void FrameProfilerAddStage(enum FrameProfilerStage stage, u32 start);
+void FrameProfilerAddFunc(enum FrameProfilerStage stage, const void *func, u32 start);
+
+// Timer 1 at 64 cycles per tick. It wraps every 15 frames, which is fine for
+// anything that is measured within a frame. Every other timer is taken by the
+// sound, the link code or the test runner, so it is shared with StartTimer1,
+// see FrameProfilerEndFrame.
+static inline u32 FrameProfilerTime(void)
+{
+    return REG_TM1CNT_L;
+}
+
+#else
+
+static inline void FrameProfilerInit(void) {}
+static inline void FrameProfilerEndFrame(u32 frameStart) {}
+static inline void FrameProfilerAddStage(enum FrameProfilerStage stage, u32 start) {}
+static inline void FrameProfilerAddFunc(enum FrameProfilerStage stage, const void *func, u32 start) {}
+static inline u32 FrameProfilerTime(void) { return 0; }
+
+#endif // DEBUG_FRAME_PROFILER
+
+#endif // GUARD_FRAME_PROFILER_H
@@ -46,15 +46,62 @@ struct MemBlock {
 #define HEAP_SIZE 0x1C000
 extern u8 gHeap[];
 
+struct HeapStats {
+    // Bytes in allocated blocks, including their headers.
+    u32 usedBytes;
+    u32 peakUsedBytes;
+    u32 numAllocations;
+    // Highest GetHeapFragmentation since InitHeap. Only tracked in tests.
+    u32 peakFragmentation;
+};
+
+extern struct HeapStats gHeapStats;
+
+#if T_HEAP_PROFILE
+#define HEAP_PROFILE_MAX_SITES 64
+
+// Totals for every Alloc call site since InitHeap, in bytes including the
+// block headers. Once the table is full, allocations from new call sites
+// are counted in the last entry, which has a NULL location.
+struct HeapAllocSite {
+    const char *location;
+    u32 numAllocations;
+    u32 totalBytes;
+    u32 liveBytes;
+    u32 peakLiveBytes;
+    // Bytes this site had allocated when gHeapStats.peakUsedBytes was reached.
+    u32 bytesAtPeak;
+};
+
+extern struct HeapAllocSite gHeapAllocSites[HEAP_PROFILE_MAX_SITES];
+#endif
+
+// A group of allocations that are all freed together, e.g. everything a
+// menu needs between opening and closing. Memory is taken from the heap in
+// chunks and handed out by bumping a pointer, so there's no per-allocation
+// header or free list search, and FreeArena releases the whole scope.
+// An arena that is all zeroes is empty.
+struct Arena {
+    struct ArenaChunk *chunks;
+    u8 *pos;
+    u8 *end;
+};
+
+#define ARENA_CHUNK_SIZE 0x400
+
 #if TESTING || !defined(NDEBUG)
 
 #define Alloc(size) Alloc_(size, __FILE__ ":" STR(__LINE__))
 #define AllocZeroed(size) AllocZeroed_(size, __FILE__ ":" STR(__LINE__))
+#define ArenaAlloc(arena, size) ArenaAlloc_(arena, size, __FILE__ ":" STR(__LINE__))
+#define ArenaAllocZeroed(arena, size) ArenaAllocZeroed_(arena, size, __FILE__ ":" STR(__LINE__))
 
 #else
 
 #define Alloc(size) Alloc_(size, NULL)
 #define AllocZeroed(size) AllocZeroed_(size, NULL)
+#define ArenaAlloc(arena, size) ArenaAlloc_(arena, size, NULL)
+#define ArenaAllocZeroed(arena, size) ArenaAllocZeroed_(arena, size, NULL)
 
 #endif
 
@@ -63,7 +110,14 @@ void *AllocZeroed_(u32 size, const char *location);
 void Free(void *pointer);
 void InitHeap(void *pointer, u32 size);
 
+void InitArena(struct Arena *arena);
+void *ArenaAlloc_(struct Arena *arena, u32 size, const char *location);
+void *ArenaAllocZeroed_(struct Arena *arena, u32 size, const char *location);
+void FreeArena(struct Arena *arena);
+
 const struct MemBlock *HeapHead(void);
 const char *MemBlockLocation(const struct MemBlock *block);
+bool32 CheckHeap(void);
+u32 GetHeapFragmentation(void);
 
 #endif // GUARD_MALLOC_H
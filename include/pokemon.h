@@ -284,6 +284,18 @@ struct Pokemon
     u16 spDefense;
 };
 
+// A decrypted BoxPokemon, see OpenBoxMonView.
+struct BoxMonView
+{
+    struct BoxPokemon *boxMon;
+    struct PokemonSubstruct0 *substruct0;
+    struct PokemonSubstruct1 *substruct1;
+    struct PokemonSubstruct2 *substruct2;
+    struct PokemonSubstruct3 *substruct3;
+    bool8 isValid; // Checksum matched when opened.
+    bool8 isDirty;
+};
+
 struct MonSpritesGfxManager
 {
     u32 numSprites:4;
@@ -731,6 +743,7 @@ void CalculateMonStats(struct Pokemon *mon);
 void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest);
 u8 GetLevelFromMonExp(struct Pokemon *mon);
 u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon);
+u8 GetLevelFromBoxMonViewExp(struct BoxMonView *view);
 u16 GiveMoveToMon(struct Pokemon *mon, u16 move);
 u16 GiveMoveToBoxMon(struct BoxPokemon *boxMon, u16 move);
 u16 GiveMoveToBattleMon(struct BattlePokemon *mon, u16 move);
@@ -767,6 +780,12 @@ u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field);
 
 void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg);
 void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg);
+void OpenBoxMonView(struct BoxMonView *view, struct BoxPokemon *boxMon);
+void CloseBoxMonView(struct BoxMonView *view);
+#define GetBoxMonViewData(...) CAT(GetBoxMonViewData, NARG_8(__VA_ARGS__))(__VA_ARGS__)
+u32 GetBoxMonViewData3(struct BoxMonView *view, s32 field, u8 *data);
+u32 GetBoxMonViewData2(struct BoxMonView *view, s32 field);
+void SetBoxMonViewData(struct BoxMonView *view, s32 field, const void *dataArg);
 void CopyMon(void *dest, void *src, size_t size);
 u8 GiveMonToPlayer(struct Pokemon *mon);
 u8 CopyMonToPC(struct Pokemon *mon);
@@ -0,0 +1,21 @@
+#ifndef GUARD_SPRITE_CACHE_H
+#define GUARD_SPRITE_CACHE_H
+
+// Every slot holds one decompressed sheet of at most a two frame Pokémon pic.
+#define SPRITE_CACHE_SLOT_SIZE  (MON_PIC_SIZE * MAX_MON_PIC_FRAMES)
+#define SPRITE_CACHE_SLOT_COUNT (SPRITE_CACHE_SIZE / SPRITE_CACHE_SLOT_SIZE)
+
+struct SpriteCacheStats
+{
+    u32 hits;
+    u32 misses;
+    u32 evictions;
+    u32 uncached; // Sheets that were too large or not in ROM.
+};
+
+extern struct SpriteCacheStats gSpriteCacheStats;
+
+void DecompressDataWithHeaderWramCached(const u32 *src, void *dest);
+void ResetSpriteCache(void);
+
+#endif // GUARD_SPRITE_CACHE_H
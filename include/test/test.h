@@ -4,6 +4,7 @@
 #include "test_runner.h"
 
 #define MAX_PROCESSES 32 // See also tools/mgba-rom-test-hydra/main.c
+#define MAX_TEST_TIMINGS 8192 // See also tools/mgba-rom-test-hydra/main.c
 
 enum TestResult
 {
@@ -37,6 +38,15 @@ struct Test
     u16 sourceLine;
 };
 
+// The measured cost of a test in a previous run, and the process that
+// mgba-rom-test-hydra assigned it to. Sorted by nameHash.
+struct TestTiming
+{
+    u32 nameHash;
+    u32 cost;
+    u32 runner;
+};
+
 struct TestRunnerState
 {
     u8 state;
@@ -45,6 +55,9 @@ struct TestRunnerState
     u32 failedAssumptionsBlockLine;
     const struct Test *test;
     u32 processCosts[MAX_PROCESSES];
+    u32 estimatedCost;
+    u32 timerInterrupts;
+    u32 startTicks;
 
     u8 result;
     u8 expectedResult;
@@ -57,6 +70,9 @@ struct TestRunnerState
 extern const u8 gTestRunnerN;
 extern const u8 gTestRunnerI;
 extern const char gTestRunnerArgv[256];
+extern const u32 gTestRunnerTimingsCount;
+extern const u32 gTestRunnerCostScale;
+extern const struct TestTiming gTestRunnerTimings[MAX_TEST_TIMINGS];
 
 extern const struct TestRunner gAssumptionsRunner;
 
@@ -7,6 +7,8 @@ extern const bool8 gTestRunnerSkipIsFail;
 
 #if TESTING
 
+extern bool8 gTestRunnerTurbo;
+
 void TestRunner_Battle_RecordAbilityPopUp(u32 battlerId, u32 ability);
 void TestRunner_Battle_RecordAnimation(u32 animType, u32 animId);
 void TestRunner_Battle_RecordHP(u32 battlerId, u32 oldHP, u32 newHP);
@@ -20,15 +22,21 @@ void TestRunner_Battle_CheckAiMoveScores(u32 battlerId);
 void TestRunner_Battle_AISetScore(const char *file, u32 line, u32 battlerId, u32 moveIndex, s32 score);
 void TestRunner_Battle_AIAdjustScore(const char *file, u32 line, u32 battlerId, u32 moveIndex, s32 score);
 void TestRunner_Battle_InvalidNoHPMon(u32 battlerId, u32 partyIndex);
+void TestRunner_Battle_AiDamageCacheMismatch(u32 battlerAtk, u32 battlerDef, u32 move);
+bool32 TestRunner_Battle_VerifiesBattlerEffectCache(void);
+void TestRunner_Battle_BattlerEffectCacheMismatch(u32 battlerId);
 void TestRunner_CheckMemory(void);
 
 void TestRunner_Battle_CheckBattleRecordActionType(u32 battlerId, u32 recordIndex, u32 actionType);
+void TestRunner_Battle_CheckActionTaken(u32 battlerId);
 
 u32 TestRunner_Battle_GetForcedAbility(u32 side, u32 partyIndex);
 u32 TestRunner_Battle_GetChosenGimmick(u32 side, u32 partyIndex);
 
 #else
 
+#define gTestRunnerTurbo FALSE
+
 #define TestRunner_Battle_RecordAbilityPopUp(...) (void)0
 #define TestRunner_Battle_RecordAnimation(...) (void)0
 #define TestRunner_Battle_RecordHP(...) (void)0
@@ -42,8 +50,12 @@ u32 TestRunner_Battle_GetChosenGimmick(u32 side, u32 partyIndex);
 #define TestRunner_Battle_AISetScore(...) (void)0
 #define TestRunner_Battle_AIAdjustScore(...) (void)0
 #define TestRunner_Battle_InvalidNoHPMon(...) (void)0
+#define TestRunner_Battle_AiDamageCacheMismatch(...) (void)0
+#define TestRunner_Battle_VerifiesBattlerEffectCache(...) (bool32)FALSE
+#define TestRunner_Battle_BattlerEffectCacheMismatch(...) (void)0
 
 #define TestRunner_Battle_CheckBattleRecordActionType(...) (void)0
+#define TestRunner_Battle_CheckActionTaken(...) (void)0
 
 #define TestRunner_Battle_GetForcedAbility(...) (u32)0
 
@@ -65,6 +65,14 @@ struct TextGlyph
 
 extern struct TextGlyph gCurGlyph;
 
+struct GlyphCacheStats
+{
+    u32 hits;
+    u32 misses;
+};
+
+extern struct GlyphCacheStats gGlyphCacheStats;
+
 struct TextPrinterSubStruct
 {
     u8 fontId:4;  // 0x14
@@ -156,6 +164,7 @@ void SaveTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
 void RestoreTextColors(u8 *fgColor, u8 *bgColor, u8 *shadowColor);
 void DecompressGlyphTile(const void *src_, void *dest_);
 void CopyGlyphToWindow(struct TextPrinter *x);
+void ResetGlyphCache(void);
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width);
 
 void TextPrinterInitDownArrowCounters(struct TextPrinter *textPrinter);
@@ -21,6 +21,8 @@ enum WildPokemonArea
 
 #define NUM_ALTERING_CAVE_TABLES 9
 
+#define HEADER_NONE 0xFFFF
+
 #define FISHING_CHAIN_LENGTH_MAX 999
 #define FISHING_CHAIN_SHINY_STREAK_MAX 20
 
@@ -368,6 +368,40 @@ void SetupAIPredictionData(u32 battler, enum SwitchType switchType)
     gAiLogicData->aiPredictionInProgress = FALSE;
 }
 
+// The battle state that CalcAiDamage uses as scratch space. The player's
+// controller runs between the slices of the simulation, so every slice puts
+// it back the way it found it.
+struct AiScratchBattleState
+{
+    struct SpecialStatus specialStatuses[MAX_BATTLERS_COUNT];
+    u16 zMoveBaseMoves[MAX_BATTLERS_COUNT];
+    bool8 ateBoost[MAX_BATTLERS_COUNT];
+    u8 dynamicMoveType;
+    u8 swapDamageCategory:1;
+    u8 padding:7;
+    u8 multiHitCounter;
+};
+
+static void SaveAiScratchBattleState(struct AiScratchBattleState *state)
+{
+    memcpy(state->specialStatuses, gSpecialStatuses, sizeof(state->specialStatuses));
+    memcpy(state->zMoveBaseMoves, gBattleStruct->zmove.baseMoves, sizeof(state->zMoveBaseMoves));
+    memcpy(state->ateBoost, gBattleStruct->ateBoost, sizeof(state->ateBoost));
+    state->dynamicMoveType = gBattleStruct->dynamicMoveType;
+    state->swapDamageCategory = gBattleStruct->swapDamageCategory;
+    state->multiHitCounter = gMultiHitCounter;
+}
+
+static void RestoreAiScratchBattleState(const struct AiScratchBattleState *state)
+{
+    memcpy(gSpecialStatuses, state->specialStatuses, sizeof(state->specialStatuses));
+    memcpy(gBattleStruct->zmove.baseMoves, state->zMoveBaseMoves, sizeof(state->zMoveBaseMoves));
+    memcpy(gBattleStruct->ateBoost, state->ateBoost, sizeof(state->ateBoost));
+    gBattleStruct->dynamicMoveType = state->dynamicMoveType;
+    gBattleStruct->swapDamageCategory = state->swapDamageCategory;
+    gMultiHitCounter = state->multiHitCounter;
+}
+
 void ComputeBattlerDecisions(u32 battler)
 {
     if ((gBattleTypeFlags & BATTLE_TYPE_HAS_AI || IsWildMonSmart())
@@ -380,7 +414,10 @@ void ComputeBattlerDecisions(u32 battler)
 
         // Risky AI switches aggressively even mid battle
         enum SwitchType switchType = (gAiThinkingStruct->aiFlags[battler] & AI_FLAG_RISKY) ? SWITCH_AFTER_KO : SWITCH_MID_BATTLE;
+        struct AiScratchBattleState scratch;
 
+        // The player's menus may already be open.
+        SaveAiScratchBattleState(&scratch);
         gAiLogicData->aiCalcInProgress = TRUE;
 
         // Setup battler and prediction data
@@ -398,6 +435,7 @@ void ComputeBattlerDecisions(u32 battler)
         ModifySwitchAfterMoveScoring(battler);
 
         gAiLogicData->aiCalcInProgress = FALSE;
+        RestoreAiScratchBattleState(&scratch);
     }
 }
 
@@ -562,50 +600,132 @@ static u32 Ai_SetMoveAccuracy(struct AiLogicData *aiData, u32 battlerAtk, u32 ba
     return accuracy;
 }
 
+static void CalcBattlerAiMoveData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef, u32 moveIndex, u32 weather)
+{
+    struct SimulatedDamage dmg = {0};
+    uq4_12_t effectiveness = Q_4_12(0.0);
+    u32 move = GetMovesArray(battlerAtk)[moveIndex];
+
+    if (IsMoveUnusable(moveIndex, move, aiData->moveLimitations[battlerAtk]))
+        return;
+
+    // Also get effectiveness of status moves
+    dmg = AI_CalcDamage(move, battlerAtk, battlerDef, &effectiveness, USE_GIMMICK, NO_GIMMICK, weather);
+    aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex] = Ai_SetMoveAccuracy(aiData, battlerAtk, battlerDef, move);
+
+    aiData->simulatedDmg[battlerAtk][battlerDef][moveIndex] = dmg;
+    aiData->effectiveness[battlerAtk][battlerDef][moveIndex] = effectiveness;
+}
+
 static void CalcBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef, u32 weather)
 {
-    u32 moveIndex, move;
-    u16 *moves = GetMovesArray(battlerAtk);
-    u32 moveLimitations = aiData->moveLimitations[battlerAtk];
+    u32 moveIndex;
 
     for (moveIndex = 0; moveIndex < MAX_MON_MOVES; moveIndex++)
-    {
-        struct SimulatedDamage dmg = {0};
-        uq4_12_t effectiveness = Q_4_12(0.0);
-        move = moves[moveIndex];
+        CalcBattlerAiMoveData(aiData, battlerAtk, battlerDef, moveIndex, weather);
+}
 
-        if (IsMoveUnusable(moveIndex, move, moveLimitations))
-            continue;
+#define CYCLES_PER_SCANLINE 1232
+#define SCANLINES_PER_FRAME 228
 
-        // Also get effectiveness of status moves
-        dmg = AI_CalcDamage(move, battlerAtk, battlerDef, &effectiveness, USE_GIMMICK, NO_GIMMICK, weather);
-        aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex] = Ai_SetMoveAccuracy(aiData, battlerAtk, battlerDef, move);
+// Measured in scanlines so that it works without a free timer. Anything
+// that runs into the next frame has used up the budget.
+static bool32 HasUsedAiCycleBudget(u32 cycleBudget, u32 startFrame, u32 startScanline)
+{
+    u32 scanlines;
 
-        aiData->simulatedDmg[battlerAtk][battlerDef][moveIndex] = dmg;
-        aiData->effectiveness[battlerAtk][battlerDef][moveIndex] = effectiveness;
-    }
+    if (cycleBudget == 0)
+        return FALSE;
+    if (gMain.vblankCounter1 - startFrame > 1)
+        return TRUE;
+    scanlines = (REG_VCOUNT + SCANLINES_PER_FRAME - startScanline) % SCANLINES_PER_FRAME;
+    return scanlines * CYCLES_PER_SCANLINE >= cycleBudget;
 }
 
-static void SetBattlerAiMovesData(struct AiLogicData *aiData, u32 battlerAtk, u32 battlersCount, u32 weather)
+// Simulates the moves of every attacker on every target in the same order
+// as doing it all at once, one move at a time until cycleBudget cycles are
+// used up, or until it is done if cycleBudget is 0. The battler data that
+// SetBattlerData hides from the AI and the scratch battle state are put back
+// before returning, so the rest of the battle can run in between. Returns
+// TRUE once it is done.
+bool32 ContinueAiLogicDataForTurn(u32 cycleBudget)
 {
-    u32 battlerDef;
-    SaveBattlerData(battlerAtk);
-    SetBattlerData(battlerAtk);
+    struct AiLogicData *aiData = gAiLogicData;
+    struct AiMovesDataProgress *progress = &aiData->movesDataProgress;
+    struct AiScratchBattleState scratch;
+    u32 startFrame = gMain.vblankCounter1;
+    u32 startScanline = REG_VCOUNT;
+    u32 battlersCount = gBattlersCount;
+    bool32 usedBudget = FALSE;
+
+    if (!progress->inProgress)
+        return TRUE;
 
-    // Simulate dmg for both ai controlled mons and for player controlled mons.
-    for (battlerDef = 0; battlerDef < battlersCount; battlerDef++)
+    SaveAiScratchBattleState(&scratch);
+    gAiLogicData->aiCalcInProgress = TRUE;
+    if (DEBUG_AI_DELAY_TIMER)
+        CycleCountStart();
+    while (!usedBudget && progress->battlerAtk < battlersCount)
     {
+        u32 battlerAtk = progress->battlerAtk;
+        u32 battlerDef = progress->battlerDef;
+
+        if (!IsBattlerAlive(battlerAtk) || battlerDef >= battlersCount)
+        {
+            progress->battlerAtk++;
+            progress->battlerDef = 0;
+            continue;
+        }
         if (battlerAtk == battlerDef || !IsBattlerAlive(battlerDef))
+        {
+            progress->battlerDef++;
             continue;
+        }
 
+        SaveBattlerData(battlerAtk);
+        SetBattlerData(battlerAtk);
         SaveBattlerData(battlerDef);
         SetBattlerData(battlerDef);
-        CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, weather);
+        do
+        {
+            CalcBattlerAiMoveData(aiData, battlerAtk, battlerDef, progress->moveIndex++, progress->weather);
+            usedBudget = HasUsedAiCycleBudget(cycleBudget, startFrame, startScanline);
+        } while (!usedBudget && progress->moveIndex < MAX_MON_MOVES);
         RestoreBattlerData(battlerDef);
+        RestoreBattlerData(battlerAtk);
+
+        if (progress->moveIndex == MAX_MON_MOVES)
+        {
+            progress->moveIndex = 0;
+            progress->battlerDef++;
+        }
     }
-    RestoreBattlerData(battlerAtk);
+    if (DEBUG_AI_DELAY_TIMER)
+        // We add to existing to compound multiple calls
+        gBattleStruct->aiDelayCycles += CycleCountEnd();
+    gAiLogicData->aiCalcInProgress = FALSE;
+    RestoreAiScratchBattleState(&scratch);
+
+    if (progress->battlerAtk < battlersCount)
+        return FALSE;
+    progress->inProgress = FALSE;
+    return TRUE;
+}
+
+void FinishAiLogicDataForTurn(void)
+{
+    ContinueAiLogicDataForTurn(0);
 }
 
+bool32 IsAiLogicDataForTurnFinished(void)
+{
+    return !gAiLogicData->movesDataProgress.inProgress;
+}
+
+// The damage of every move on every target is only simulated here when
+// AI_DATA_CYCLES_PER_FRAME is 0. Otherwise HandleTurnActionSelectionState
+// spreads it over the first frames of the turn, while the player's menus are
+// already open, and the AI battlers wait for it before they decide.
 void SetAiLogicDataForTurn(struct AiLogicData *aiData)
 {
     u32 battlerAtk, battlersCount, weather;
@@ -633,18 +753,16 @@ void SetAiLogicDataForTurn(struct AiLogicData *aiData)
 
         SetBattlerAiData(battlerAtk, aiData);
     }
-
-    for (battlerAtk = 0; battlerAtk < battlersCount; battlerAtk++)
-    {
-        if (!IsBattlerAlive(battlerAtk))
-            continue;
-
-        SetBattlerAiMovesData(aiData, battlerAtk, battlersCount, weather);
-    }
     if (DEBUG_AI_DELAY_TIMER)
         // We add to existing to compound multiple calls
         gBattleStruct->aiDelayCycles += CycleCountEnd();
     gAiLogicData->aiCalcInProgress = FALSE;
+
+    aiData->movesDataProgress.weather = weather;
+    aiData->movesDataProgress.inProgress = TRUE;
+    // Link battles have to choose in step with the other game.
+    if (AI_DATA_CYCLES_PER_FRAME == 0 || gBattleTypeFlags & BATTLE_TYPE_LINK)
+        FinishAiLogicDataForTurn();
 }
 
 u32 GetPartyMonAbility(struct Pokemon *mon)
@@ -15,6 +15,7 @@
 #include "pokemon.h"
 #include "random.h"
 #include "recorded_battle.h"
+#include "test_runner.h"
 #include "util.h"
 #include "constants/abilities.h"
 #include "constants/battle_ai.h"
@@ -23,6 +24,8 @@
 #include "constants/moves.h"
 #include "constants/items.h"
 
+EWRAM_DATA struct AiDamageCacheStats gAiDamageCacheStats = {0};
+
 // Functions
 static bool32 AI_IsDoubleSpreadMove(u32 battlerAtk, u32 move)
 {
@@ -737,9 +740,9 @@ static inline bool32 ShouldCalcCritDamage(u32 battlerAtk, u32 battlerDef, u32 mo
     return FALSE;
 }
 
-struct SimulatedDamage AI_CalcDamage(u32 move, u32 battlerAtk, u32 battlerDef, uq4_12_t *typeEffectiveness, enum AIConsiderGimmick considerGimmickAtk, enum AIConsiderGimmick considerGimmickDef, u32 weather)
+static struct SimulatedDamage CalcAiDamage(u32 move, u32 battlerAtk, u32 battlerDef, uq4_12_t *typeEffectiveness, enum AIConsiderGimmick considerGimmickAtk, enum AIConsiderGimmick considerGimmickDef, u32 weather)
 {
-    struct SimulatedDamage simDamage;
+    struct SimulatedDamage simDamage = {0};
     enum BattleMoveEffects moveEffect = GetMoveEffect(move);
     bool32 isDamageMoveUnusable = FALSE;
     bool32 toggledGimmickAtk = FALSE;
@@ -857,6 +860,121 @@ struct SimulatedDamage AI_CalcDamage(u32 move, u32 battlerAtk, u32 battlerDef, u
     return simDamage;
 }
 
+#if AI_DAMAGE_CACHE_SIZE
+// HashAiDamageState reads whole words.
+STATIC_ASSERT(sizeof(struct BattlePokemon) % sizeof(u32) == 0, BattlePokemonIsWordSized);
+STATIC_ASSERT(sizeof(struct DisableStruct) % sizeof(u32) == 0, DisableStructIsWordSized);
+STATIC_ASSERT(sizeof(gProtectStructs) % sizeof(u32) == 0, ProtectStructsAreWordSized);
+STATIC_ASSERT(sizeof(gAiLogicData->abilities) % sizeof(u32) == 0, AbilitiesAreWordSized);
+STATIC_ASSERT(sizeof(gAiLogicData->holdEffects) % sizeof(u32) == 0, HoldEffectsAreWordSized);
+
+static u32 HashAiDamageState(u32 hash, const void *data, u32 size)
+{
+    const u32 *words = data;
+    u32 i;
+
+    for (i = 0; i < size / sizeof(u32); i++)
+        hash = (hash ^ words[i]) * 0x01000193;
+    return hash;
+}
+
+// What CalcAiDamage reads and that changes while the AI thinks or while the
+// turn plays out. Anything else only changes between turns, when
+// SetAiLogicDataForTurn clears the cache. Left out on purpose:
+// - gBattleTurnCounter, which only changes between turns.
+// - Anything that CalculateMoveDamage writes, like moveResultFlags.
+static u32 GetAiDamageCacheHash(u32 move, u32 battlerAtk, u32 battlerDef, enum AIConsiderGimmick considerGimmickAtk, enum AIConsiderGimmick considerGimmickDef, u32 weather)
+{
+    u32 hash = 0x811C9DC5;
+    u32 inputs[] =
+    {
+        move | (battlerAtk << 16) | (battlerDef << 18) | (considerGimmickAtk << 20) | (considerGimmickDef << 21),
+        weather,
+        gFieldStatuses,
+        gSideStatuses[B_SIDE_PLAYER],
+        gSideStatuses[B_SIDE_OPPONENT],
+        GetActiveGimmick(battlerAtk) | (GetActiveGimmick(battlerDef) << 8)
+            | (gBattleStruct->gimmick.usableGimmick[battlerAtk] << 16) | (gBattleStruct->gimmick.usableGimmick[battlerDef] << 24),
+        // Rage Fist, Echoed Voice, Metronome (item), Stomping Tantrum and Pursuit
+        gBattleStruct->timesGotHit[GetBattlerSide(battlerAtk)][gBattlerPartyIndexes[battlerAtk]]
+            | (gBattleStruct->sameMoveTurns[battlerAtk] << 8)
+            | (gBattleStruct->battlerState[battlerAtk].stompingTantrumTimer << 16)
+            | (gBattleStruct->battlerState[battlerDef].pursuitTarget << 18),
+        // Retaliate, -ate abilities, Pledge, Fickle Beam and Max Moves
+        gSideTimers[GetBattlerSide(battlerAtk)].retaliateTimer
+            | (gBattleStruct->ateBoost[battlerAtk] << 8)
+            | (gBattleStruct->pledgeMove << 16)
+            | (gBattleStruct->fickleBeamBoosted << 17)
+            | (gBattleStruct->chosenMovePositions[battlerAtk] << 24),
+        // Gems, Parental Bond and multi-hit moves like Triple Axel
+        gSpecialStatuses[battlerAtk].gemParam
+            | (gSpecialStatuses[battlerAtk].gemBoost << 8)
+            | (gSpecialStatuses[battlerAtk].parentalBondState << 9)
+            | (gMultiHitCounter << 16),
+        // Round, Fusion Flare and Fusion Bolt, Me First
+        gLastUsedMove | (gChosenMove << 16),
+        // Rolled when Magnitude or Present is used
+        gBattleStruct->magnitudeBasePower | (gBattleStruct->presentBasePower << 8),
+    };
+
+    hash = HashAiDamageState(hash, inputs, sizeof(inputs));
+    hash = HashAiDamageState(hash, gBattleMons, gBattlersCount * sizeof(gBattleMons[0]));
+    hash = HashAiDamageState(hash, gStatuses3, sizeof(gStatuses3));
+    hash = HashAiDamageState(hash, gStatuses4, sizeof(gStatuses4));
+    hash = HashAiDamageState(hash, gProtectStructs, sizeof(gProtectStructs));
+    hash = HashAiDamageState(hash, &gDisableStructs[battlerAtk], sizeof(gDisableStructs[battlerAtk]));
+    hash = HashAiDamageState(hash, &gDisableStructs[battlerDef], sizeof(gDisableStructs[battlerDef]));
+    hash = HashAiDamageState(hash, gAiLogicData->abilities, sizeof(gAiLogicData->abilities));
+    hash = HashAiDamageState(hash, gAiLogicData->holdEffects, sizeof(gAiLogicData->holdEffects));
+    return hash;
+}
+#endif // AI_DAMAGE_CACHE_SIZE
+
+struct SimulatedDamage AI_CalcDamage(u32 move, u32 battlerAtk, u32 battlerDef, uq4_12_t *typeEffectiveness, enum AIConsiderGimmick considerGimmickAtk, enum AIConsiderGimmick considerGimmickDef, u32 weather)
+{
+#if AI_DAMAGE_CACHE_SIZE
+    struct SimulatedDamage simDamage;
+    u32 hash = GetAiDamageCacheHash(move, battlerAtk, battlerDef, considerGimmickAtk, considerGimmickDef, weather);
+    struct AiDamageCacheEntry *entry = &gAiLogicData->damageCache[hash % AI_DAMAGE_CACHE_SIZE];
+
+    if (entry->isValid
+     && entry->hash == hash
+     && entry->move == move
+     && entry->battlerAtk == battlerAtk
+     && entry->battlerDef == battlerDef
+     && entry->considerGimmickAtk == considerGimmickAtk
+     && entry->considerGimmickDef == considerGimmickDef)
+    {
+        gAiDamageCacheStats.hits++;
+    #if T_AI_DAMAGE_CACHE_VERIFY
+        simDamage = CalcAiDamage(move, battlerAtk, battlerDef, typeEffectiveness, considerGimmickAtk, considerGimmickDef, weather);
+        if (simDamage.minimum != entry->damage.minimum
+         || simDamage.median != entry->damage.median
+         || simDamage.maximum != entry->damage.maximum
+         || *typeEffectiveness != entry->effectiveness)
+            TestRunner_Battle_AiDamageCacheMismatch(battlerAtk, battlerDef, move);
+    #endif // T_AI_DAMAGE_CACHE_VERIFY
+        *typeEffectiveness = entry->effectiveness;
+        return entry->damage;
+    }
+
+    gAiDamageCacheStats.misses++;
+    simDamage = CalcAiDamage(move, battlerAtk, battlerDef, typeEffectiveness, considerGimmickAtk, considerGimmickDef, weather);
+    entry->hash = hash;
+    entry->move = move;
+    entry->battlerAtk = battlerAtk;
+    entry->battlerDef = battlerDef;
+    entry->considerGimmickAtk = considerGimmickAtk;
+    entry->considerGimmickDef = considerGimmickDef;
+    entry->isValid = TRUE;
+    entry->effectiveness = *typeEffectiveness;
+    entry->damage = simDamage;
+    return simDamage;
+#else
+    return CalcAiDamage(move, battlerAtk, battlerDef, typeEffectiveness, considerGimmickAtk, considerGimmickDef, weather);
+#endif // AI_DAMAGE_CACHE_SIZE
+}
+
 bool32 AI_IsDamagedByRecoil(u32 battler)
 {
     u32 ability = gAiLogicData->abilities[battler];
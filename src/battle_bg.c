@@ -686,12 +686,15 @@ const void* GetBattleBackgroundPalette(u16 terrain)
     return gBattleEnvironmentInfo[terrain].background.palette;
 }
 
-static void LoadBattleTerrainGfx(u16 terrain)
+static void LoadBattleTerrainGfx(u16 terrain, bool32 tilesOverFrames)
 {
     if (terrain >= NELEMS(gBattleEnvironmentInfo))
         terrain = BATTLE_ENVIRONMENT_PLAIN;
     // Copy to bg3
-    DecompressDataWithHeaderVram(gBattleEnvironmentInfo[terrain].background.tileset, (void *)BG_CHAR_ADDR(2));
+    if (tilesOverFrames)
+        CreateDecompressionTask(gBattleEnvironmentInfo[terrain].background.tileset, (void *)BG_CHAR_ADDR(2), 0);
+    else
+        DecompressDataWithHeaderVram(gBattleEnvironmentInfo[terrain].background.tileset, (void *)BG_CHAR_ADDR(2));
     DecompressDataWithHeaderVram(gBattleEnvironmentInfo[terrain].background.tilemap, (void *)BG_SCREEN_ADDR(26));
     LoadPalette(GetBattleBackgroundPalette(terrain), BG_PLTT_ID(2), 3 * PLTT_SIZE_4BPP);
 }
@@ -759,22 +762,41 @@ void LoadBattleMenuWindowGfx(void)
 
 void DrawMainBattleBackground(void)
 {
-    LoadBattleTerrainGfx(GetBattleTerrainOverride());
+    LoadBattleTerrainGfx(GetBattleTerrainOverride(), FALSE);
 }
 
-void LoadBattleTextboxAndBackground(void)
+static void LoadBattleTextbox(void)
 {
     DecompressDataWithHeaderVram(gBattleTextboxTiles, (void *)(BG_CHAR_ADDR(0)));
     CopyToBgTilemapBuffer(0, gBattleTextboxTilemap, 0, 0);
     CopyBgTilemapBufferToVram(0);
     LoadPalette(gBattleTextboxPalette, BG_PLTT_ID(0), 2 * PLTT_SIZE_4BPP);
     LoadBattleMenuWindowGfx();
+}
+
+void LoadBattleTextboxAndBackground(void)
+{
+    LoadBattleTextbox();
     if (B_TERRAIN_BG_CHANGE == TRUE)
         DrawTerrainTypeBattleBackground();
     else
         DrawMainBattleBackground();
 }
 
+// Like LoadBattleTextboxAndBackground, but a task decompresses the tiles of
+// the battle background over the next frames, so that they don't all land in
+// the first frame of the battle. bg3 must stay hidden until
+// IsDecompressionTaskActive returns FALSE. Nothing else may write the bg3 tiles
+// in the meantime.
+void LoadBattleTextboxAndBackgroundOverFrames(void)
+{
+    LoadBattleTextbox();
+    if (B_TERRAIN_BG_CHANGE == TRUE && gFieldStatuses & STATUS_FIELD_TERRAIN_ANY)
+        DrawTerrainTypeBattleBackground();
+    else
+        LoadBattleTerrainGfx(GetBattleTerrainOverride(), TRUE);
+}
+
 static void DrawLinkBattleParticipantPokeballs(u8 taskId, u8 multiplayerId, u8 bgId, u8 destX, u8 destY)
 {
     s32 i;
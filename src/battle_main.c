@@ -573,9 +573,9 @@ static void CB2_InitBattleInternal(void)
     }
 
     InitBattleBgsVideo();
-    LoadBattleTextboxAndBackground();
     ResetSpriteData();
     ResetTasks();
+    LoadBattleTextboxAndBackgroundOverFrames();
     if (B_FAST_INTRO_NO_SLIDE == FALSE && !gTestRunnerHeadless)
         DrawBattleEntryBackground();
     FreeAllSpritePalettes();
@@ -886,7 +886,7 @@ static void CB2_HandleStartBattle(void)
     switch (gBattleCommunication[MULTIUSE_STATE])
     {
     case 0:
-        if (!IsDma3ManagerBusyWithBgCopy())
+        if (!IsDma3ManagerBusyWithBgCopy() && !IsDecompressionTaskActive())
         {
             ShowBg(0);
             ShowBg(1);
@@ -1094,7 +1094,7 @@ static void CB2_HandleStartMultiPartnerBattle(void)
     switch (gBattleCommunication[MULTIUSE_STATE])
     {
     case 0:
-        if (!IsDma3ManagerBusyWithBgCopy())
+        if (!IsDma3ManagerBusyWithBgCopy() && !IsDecompressionTaskActive())
         {
             ShowBg(0);
             ShowBg(1);
@@ -1492,7 +1492,7 @@ static void CB2_HandleStartMultiBattle(void)
     switch (gBattleCommunication[MULTIUSE_STATE])
     {
     case 0:
-        if (!IsDma3ManagerBusyWithBgCopy())
+        if (!IsDma3ManagerBusyWithBgCopy() && !IsDecompressionTaskActive())
         {
             ShowBg(0);
             ShowBg(1);
@@ -2710,6 +2710,7 @@ static void BattleMainCB1(void)
 {
     u32 battler;
 
+    InvalidateBattlerEffectCache();
     gBattleMainFunc();
     for (battler = 0; battler < gBattlersCount; battler++)
         gBattlerControllerFuncs[battler](battler);
@@ -3913,17 +3914,34 @@ enum
     STATE_SELECTION_SCRIPT_MAY_RUN
 };
 
+static bool32 IsAnyBattlerAtTurnStart(void)
+{
+    u32 battler;
+
+    for (battler = 0; battler < gBattlersCount; battler++)
+    {
+        if (gBattleCommunication[battler] == STATE_TURN_START_RECORD)
+            return TRUE;
+    }
+    return FALSE;
+}
+
 static void HandleTurnActionSelectionState(void)
 {
     s32 i, battler;
 
     gBattleCommunication[ACTIONS_CONFIRMED_COUNT] = 0;
+    ContinueAiLogicDataForTurn(AI_DATA_CYCLES_PER_FRAME);
     for (battler = 0; battler < gBattlersCount; battler++)
     {
         u32 position = GetBattlerPosition(battler);
         switch (gBattleCommunication[battler])
         {
         case STATE_TURN_START_RECORD: // Recorded battle related action on start of every turn.
+            // AI battlers, an in-game partner included, wait until the AI's
+            // damage simulations are done. The player's menus open meanwhile.
+            if (BattlerHasAi(battler) && !IsAiLogicDataForTurnFinished())
+                break;
             RecordedBattle_CopyBattlerMoves(battler);
             gBattleCommunication[battler] = STATE_BEFORE_ACTION_CHOSEN;
             ComputeBattlerDecisions(battler); // Do AI score computations here so we can use them in AI_TrySwitchOrUseItem
@@ -3980,8 +3998,12 @@ static void HandleTurnActionSelectionState(void)
             }
             break;
         case STATE_WAIT_ACTION_CHOSEN: // Try to perform an action.
-            if (!IsBattleControllerActiveOrPendingSyncAnywhere(battler))
+            // No action is taken until every AI battler has decided, so that an
+            // AI partner never sees the player's choice in GetAllyChosenMove,
+            // however fast they were.
+            if (!IsBattleControllerActiveOrPendingSyncAnywhere(battler) && !IsAnyBattlerAtTurnStart())
             {
+                TestRunner_Battle_CheckActionTaken(battler);
                 RecordedBattle_SetBattlerAction(battler, gBattleResources->bufferB[battler][1]);
                 gChosenActionByBattler[battler] = gBattleResources->bufferB[battler][1];
 
@@ -4401,6 +4423,7 @@ static void HandleTurnActionSelectionState(void)
                 gChosenActionByBattler[GetBattlerAtPosition(B_POSITION_PLAYER_LEFT)] = B_ACTION_NOTHING_FAINTED;
         }
 
+        FinishAiLogicDataForTurn();
         gBattleMainFunc = SetActionsAndBattlersTurnOrder;
 
         if (gBattleTypeFlags & BATTLE_TYPE_INGAME_PARTNER)
@@ -5394,6 +5394,93 @@ static inline bool32 CanBreakThroughAbility(u32 battlerAtk, u32 battlerDef, u32
          && gCurrentTurnActionNumber < gBattlersCount);
 }
 
+static EWRAM_DATA u32 sBattlerStateEpoch = 0;
+
+// Called once per step of the battle engine, and by anything that changes
+// battler state that the cache doesn't check.
+void InvalidateBattlerEffectCache(void)
+{
+    sBattlerStateEpoch++;
+}
+
+static u32 CalcBattlerAbility(u32 battler, u32 ignoreMoldBreaker, u32 noAbilityShield);
+static enum ItemHoldEffect CalcBattlerHoldEffect(u32 battler, bool32 checkNegating, bool32 checkAbility);
+
+#if B_CACHE_BATTLER_EFFECTS
+// What GetBattlerAbilityInternal and GetBattlerHoldEffectInternal work out
+// from a battler's own state. An entry is only used in the same epoch and
+// while that state is unchanged. Neutralizing Gas and Mold Breaker depend on
+// the other battlers and the current move, so they are checked every time.
+// Neutralizing Gas can start or end in the middle of a step, when a battler
+// switches in, faints or gets Gastro Acid, so it isn't cached per epoch
+// either.
+struct BattlerEffectCache
+{
+    u32 epoch;
+    u16 ability;
+    u16 item;
+    u32 status3;
+    u8 transformed:1;
+    u8 magicRoom:1;
+    u8 hasAbilityShield:1;
+    u8 canBeNeutralized:1;
+    u8 itemNegated:1;
+    u8 padding:3;
+    u8 holdEffect;
+    u16 ownAbility; // ABILITY_NONE if the battler's own state suppresses it.
+};
+
+static EWRAM_DATA struct BattlerEffectCache sBattlerEffectCache[MAX_BATTLERS_COUNT] = {0};
+
+static const struct BattlerEffectCache *GetBattlerEffectCache(u32 battler)
+{
+    struct BattlerEffectCache *entry = &sBattlerEffectCache[battler];
+    u32 status3 = gStatuses3[battler] & (STATUS3_GASTRO_ACID | STATUS3_EMBARGO);
+    bool32 transformed = (gBattleMons[battler].status2 & STATUS2_TRANSFORMED) != 0;
+    bool32 magicRoom = (gFieldStatuses & STATUS_FIELD_MAGIC_ROOM) != 0;
+
+    if (entry->epoch == sBattlerStateEpoch
+     && entry->ability == gBattleMons[battler].ability
+     && entry->item == gBattleMons[battler].item
+     && entry->status3 == status3
+     && entry->transformed == transformed
+     && entry->magicRoom == magicRoom)
+        return entry;
+
+    entry->epoch = sBattlerStateEpoch;
+    entry->ability = gBattleMons[battler].ability;
+    entry->item = gBattleMons[battler].item;
+    entry->status3 = status3;
+    entry->transformed = transformed;
+    entry->magicRoom = magicRoom;
+
+    if (entry->item == ITEM_ENIGMA_BERRY_E_READER)
+        entry->holdEffect = gEnigmaBerries[battler].holdEffect;
+    else
+        entry->holdEffect = GetItemHoldEffect(entry->item);
+    entry->itemNegated = (status3 & STATUS3_EMBARGO) || magicRoom;
+    entry->hasAbilityShield = !entry->itemNegated && entry->holdEffect == HOLD_EFFECT_ABILITY_SHIELD;
+
+    if (gAbilitiesInfo[entry->ability].cantBeSuppressed)
+    {
+        entry->canBeNeutralized = FALSE;
+        if (transformed && (status3 & STATUS3_GASTRO_ACID) && entry->ability == ABILITY_COMATOSE)
+            entry->ownAbility = ABILITY_NONE;
+        else
+            entry->ownAbility = entry->ability;
+    }
+    else
+    {
+        entry->canBeNeutralized = entry->ability != ABILITY_NEUTRALIZING_GAS;
+        if (status3 & STATUS3_GASTRO_ACID)
+            entry->ownAbility = ABILITY_NONE;
+        else
+            entry->ownAbility = entry->ability;
+    }
+    return entry;
+}
+#endif // B_CACHE_BATTLER_EFFECTS
+
 u32 GetBattlerAbilityNoAbilityShield(u32 battler)
 {
     return GetBattlerAbilityInternal(battler, FALSE, TRUE);
@@ -5411,7 +5498,42 @@ u32 GetBattlerAbility(u32 battler)
 
 u32 GetBattlerAbilityInternal(u32 battler, u32 ignoreMoldBreaker, u32 noAbilityShield)
 {
-    bool32 hasAbilityShield = !noAbilityShield && GetBattlerHoldEffectIgnoreAbility(battler, TRUE) == HOLD_EFFECT_ABILITY_SHIELD;
+#if B_CACHE_BATTLER_EFFECTS
+    const struct BattlerEffectCache *entry = GetBattlerEffectCache(battler);
+    bool32 hasAbilityShield = !noAbilityShield && entry->hasAbilityShield;
+    u32 ability = entry->ownAbility;
+
+    // Looking for an Ability Shield sets it, see GetBattlerHoldEffectInternal.
+    if (!noAbilityShield && !entry->itemNegated)
+        gPotentialItemEffectBattler = battler;
+
+    if (ability != ABILITY_NONE)
+    {
+        if (!hasAbilityShield && entry->canBeNeutralized && IsNeutralizingGasOnField())
+            ability = ABILITY_NONE;
+        else if (CanBreakThroughAbility(gBattlerAttacker, battler, gBattleMons[gBattlerAttacker].ability, hasAbilityShield, ignoreMoldBreaker))
+            ability = ABILITY_NONE;
+    }
+
+    if (DEBUG_BATTLER_EFFECT_CACHE || TestRunner_Battle_VerifiesBattlerEffectCache())
+    {
+        u32 expected = CalcBattlerAbility(battler, ignoreMoldBreaker, noAbilityShield);
+        if (ability != expected)
+        {
+            DebugPrintfLevel(MGBA_LOG_ERROR, "Cached ability of battler %d is %d, not %d", battler, ability, expected);
+            TestRunner_Battle_BattlerEffectCacheMismatch(battler);
+            ability = expected;
+        }
+    }
+    return ability;
+#else
+    return CalcBattlerAbility(battler, ignoreMoldBreaker, noAbilityShield);
+#endif
+}
+
+static u32 CalcBattlerAbility(u32 battler, u32 ignoreMoldBreaker, u32 noAbilityShield)
+{
+    bool32 hasAbilityShield = !noAbilityShield && CalcBattlerHoldEffect(battler, TRUE, FALSE) == HOLD_EFFECT_ABILITY_SHIELD;
     bool32 abilityCantBeSuppressed = gAbilitiesInfo[gBattleMons[battler].ability].cantBeSuppressed;
 
     if (abilityCantBeSuppressed)
@@ -7557,6 +7679,48 @@ enum ItemHoldEffect GetBattlerHoldEffectIgnoreAbility(u32 battler, bool32 checkN
 }
 
 enum ItemHoldEffect GetBattlerHoldEffectInternal(u32 battler, bool32 checkNegating, bool32 checkAbility)
+{
+#if B_CACHE_BATTLER_EFFECTS
+    u32 potentialItemEffectBattler = gPotentialItemEffectBattler;
+    const struct BattlerEffectCache *entry = GetBattlerEffectCache(battler);
+    enum ItemHoldEffect holdEffect = entry->holdEffect;
+    bool32 negated = FALSE;
+
+    if (checkNegating)
+    {
+        if (entry->itemNegated)
+            negated = TRUE;
+        else if (checkAbility && GetBattlerAbility(battler) == ABILITY_KLUTZ && !(entry->status3 & STATUS3_GASTRO_ACID))
+            negated = TRUE;
+    }
+    if (negated)
+        holdEffect = HOLD_EFFECT_NONE;
+    else
+        gPotentialItemEffectBattler = battler;
+
+    // gPotentialItemEffectBattler is checked as well, and like the ability,
+    // both are replaced by what CalcBattlerHoldEffect works out.
+    if (DEBUG_BATTLER_EFFECT_CACHE || TestRunner_Battle_VerifiesBattlerEffectCache())
+    {
+        u32 cachedPotentialItemEffectBattler = gPotentialItemEffectBattler;
+        enum ItemHoldEffect expected;
+
+        gPotentialItemEffectBattler = potentialItemEffectBattler;
+        expected = CalcBattlerHoldEffect(battler, checkNegating, checkAbility);
+        if (holdEffect != expected || gPotentialItemEffectBattler != cachedPotentialItemEffectBattler)
+        {
+            DebugPrintfLevel(MGBA_LOG_ERROR, "Cached hold effect of battler %d is %d, not %d", battler, holdEffect, expected);
+            TestRunner_Battle_BattlerEffectCacheMismatch(battler);
+            holdEffect = expected;
+        }
+    }
+    return holdEffect;
+#else
+    return CalcBattlerHoldEffect(battler, checkNegating, checkAbility);
+#endif
+}
+
+static enum ItemHoldEffect CalcBattlerHoldEffect(u32 battler, bool32 checkNegating, bool32 checkAbility)
 {
     if (checkNegating)
     {
@@ -7564,7 +7728,7 @@ enum ItemHoldEffect GetBattlerHoldEffectInternal(u32 battler, bool32 checkNegati
             return HOLD_EFFECT_NONE;
         if (gFieldStatuses & STATUS_FIELD_MAGIC_ROOM)
             return HOLD_EFFECT_NONE;
-        if (checkAbility && GetBattlerAbility(battler) == ABILITY_KLUTZ && !(gStatuses3[battler] & STATUS3_GASTRO_ACID))
+        if (checkAbility && CalcBattlerAbility(battler, FALSE, FALSE) == ABILITY_KLUTZ && !(gStatuses3[battler] & STATUS3_GASTRO_ACID))
             return HOLD_EFFECT_NONE;
     }
 
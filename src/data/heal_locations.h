@@ -0,0 +1,173 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from src/data/heal_locations.json and Inja template src/data/heal_locations.json.txt
+//
+
+
+static const struct HealLocation sHealLocations[NUM_HEAL_LOCATIONS - 1] = {
+    [HEAL_LOCATION_PALLET_TOWN - 1] = {
+        .mapGroup = MAP_GROUP(MAP_PALLET_TOWN),
+        .mapNum = MAP_NUM(MAP_PALLET_TOWN),
+        .x = 6,
+        .y = 8,
+    },
+    [HEAL_LOCATION_VIRIDIAN_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_VIRIDIAN_CITY),
+        .mapNum = MAP_NUM(MAP_VIRIDIAN_CITY),
+        .x = 26,
+        .y = 27,
+    },
+    [HEAL_LOCATION_PEWTER_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_PEWTER_CITY),
+        .mapNum = MAP_NUM(MAP_PEWTER_CITY),
+        .x = 17,
+        .y = 26,
+    },
+    [HEAL_LOCATION_CERULEAN_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_CERULEAN_CITY),
+        .mapNum = MAP_NUM(MAP_CERULEAN_CITY),
+        .x = 22,
+        .y = 20,
+    },
+    [HEAL_LOCATION_LAVENDER_TOWN - 1] = {
+        .mapGroup = MAP_GROUP(MAP_LAVENDER_TOWN),
+        .mapNum = MAP_NUM(MAP_LAVENDER_TOWN),
+        .x = 6,
+        .y = 6,
+    },
+    [HEAL_LOCATION_VERMILION_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_VERMILION_CITY),
+        .mapNum = MAP_NUM(MAP_VERMILION_CITY),
+        .x = 15,
+        .y = 7,
+    },
+    [HEAL_LOCATION_CELADON_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_CELADON_CITY),
+        .mapNum = MAP_NUM(MAP_CELADON_CITY),
+        .x = 48,
+        .y = 12,
+    },
+    [HEAL_LOCATION_FUCHSIA_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_FUCHSIA_CITY),
+        .mapNum = MAP_NUM(MAP_FUCHSIA_CITY),
+        .x = 25,
+        .y = 32,
+    },
+    [HEAL_LOCATION_CINNABAR_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_CINNABAR_ISLAND),
+        .mapNum = MAP_NUM(MAP_CINNABAR_ISLAND),
+        .x = 14,
+        .y = 12,
+    },
+    [HEAL_LOCATION_INDIGO_PLATEAU - 1] = {
+        .mapGroup = MAP_GROUP(MAP_INDIGO_PLATEAU_EXTERIOR),
+        .mapNum = MAP_NUM(MAP_INDIGO_PLATEAU_EXTERIOR),
+        .x = 11,
+        .y = 7,
+    },
+    [HEAL_LOCATION_SAFFRON_CITY - 1] = {
+        .mapGroup = MAP_GROUP(MAP_SAFFRON_CITY),
+        .mapNum = MAP_NUM(MAP_SAFFRON_CITY),
+        .x = 24,
+        .y = 39,
+    },
+    [HEAL_LOCATION_ROUTE4 - 1] = {
+        .mapGroup = MAP_GROUP(MAP_ROUTE4),
+        .mapNum = MAP_NUM(MAP_ROUTE4),
+        .x = 12,
+        .y = 6,
+    },
+    [HEAL_LOCATION_ROUTE10 - 1] = {
+        .mapGroup = MAP_GROUP(MAP_ROUTE10),
+        .mapNum = MAP_NUM(MAP_ROUTE10),
+        .x = 13,
+        .y = 21,
+    },
+    [HEAL_LOCATION_ONE_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_ONE_ISLAND),
+        .mapNum = MAP_NUM(MAP_ONE_ISLAND),
+        .x = 14,
+        .y = 6,
+    },
+    [HEAL_LOCATION_TWO_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_TWO_ISLAND),
+        .mapNum = MAP_NUM(MAP_TWO_ISLAND),
+        .x = 21,
+        .y = 8,
+    },
+    [HEAL_LOCATION_THREE_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_THREE_ISLAND),
+        .mapNum = MAP_NUM(MAP_THREE_ISLAND),
+        .x = 14,
+        .y = 28,
+    },
+    [HEAL_LOCATION_FOUR_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_FOUR_ISLAND),
+        .mapNum = MAP_NUM(MAP_FOUR_ISLAND),
+        .x = 18,
+        .y = 21,
+    },
+    [HEAL_LOCATION_FIVE_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_FIVE_ISLAND),
+        .mapNum = MAP_NUM(MAP_FIVE_ISLAND),
+        .x = 18,
+        .y = 7,
+    },
+    [HEAL_LOCATION_SEVEN_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_SEVEN_ISLAND),
+        .mapNum = MAP_NUM(MAP_SEVEN_ISLAND),
+        .x = 12,
+        .y = 4,
+    },
+    [HEAL_LOCATION_SIX_ISLAND - 1] = {
+        .mapGroup = MAP_GROUP(MAP_SIX_ISLAND),
+        .mapNum = MAP_NUM(MAP_SIX_ISLAND),
+        .x = 11,
+        .y = 12,
+    },
+};
+
+static const u16 sWhiteoutRespawnHealCenterMapIdxs[NUM_HEAL_LOCATIONS - 1][2] = {
+    [HEAL_LOCATION_PALLET_TOWN - 1] = { MAP_GROUP(MAP_PALLET_TOWN_PLAYERS_HOUSE_1F), MAP_NUM(MAP_PALLET_TOWN_PLAYERS_HOUSE_1F)},
+    [HEAL_LOCATION_VIRIDIAN_CITY - 1] = { MAP_GROUP(MAP_VIRIDIAN_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_VIRIDIAN_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_PEWTER_CITY - 1] = { MAP_GROUP(MAP_PEWTER_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_PEWTER_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_CERULEAN_CITY - 1] = { MAP_GROUP(MAP_CERULEAN_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_CERULEAN_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_LAVENDER_TOWN - 1] = { MAP_GROUP(MAP_LAVENDER_TOWN_POKEMON_CENTER_1F), MAP_NUM(MAP_LAVENDER_TOWN_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_VERMILION_CITY - 1] = { MAP_GROUP(MAP_VERMILION_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_VERMILION_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_CELADON_CITY - 1] = { MAP_GROUP(MAP_CELADON_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_CELADON_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_FUCHSIA_CITY - 1] = { MAP_GROUP(MAP_FUCHSIA_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_FUCHSIA_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_CINNABAR_ISLAND - 1] = { MAP_GROUP(MAP_CINNABAR_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_CINNABAR_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_INDIGO_PLATEAU - 1] = { MAP_GROUP(MAP_INDIGO_PLATEAU_POKEMON_CENTER_1F), MAP_NUM(MAP_INDIGO_PLATEAU_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_SAFFRON_CITY - 1] = { MAP_GROUP(MAP_SAFFRON_CITY_POKEMON_CENTER_1F), MAP_NUM(MAP_SAFFRON_CITY_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_ROUTE4 - 1] = { MAP_GROUP(MAP_ROUTE4_POKEMON_CENTER_1F), MAP_NUM(MAP_ROUTE4_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_ROUTE10 - 1] = { MAP_GROUP(MAP_ROUTE10_POKEMON_CENTER_1F), MAP_NUM(MAP_ROUTE10_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_ONE_ISLAND - 1] = { MAP_GROUP(MAP_ONE_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_ONE_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_TWO_ISLAND - 1] = { MAP_GROUP(MAP_TWO_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_TWO_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_THREE_ISLAND - 1] = { MAP_GROUP(MAP_THREE_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_THREE_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_FOUR_ISLAND - 1] = { MAP_GROUP(MAP_FOUR_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_FOUR_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_FIVE_ISLAND - 1] = { MAP_GROUP(MAP_FIVE_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_FIVE_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_SEVEN_ISLAND - 1] = { MAP_GROUP(MAP_SEVEN_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_SEVEN_ISLAND_POKEMON_CENTER_1F)},
+    [HEAL_LOCATION_SIX_ISLAND - 1] = { MAP_GROUP(MAP_SIX_ISLAND_POKEMON_CENTER_1F), MAP_NUM(MAP_SIX_ISLAND_POKEMON_CENTER_1F)},
+};
+
+static const u8 sWhiteoutRespawnHealerNpcIds[NUM_HEAL_LOCATIONS - 1] = {
+    [HEAL_LOCATION_PALLET_TOWN - 1] = LOCALID_MOM,
+    [HEAL_LOCATION_VIRIDIAN_CITY - 1] = LOCALID_VIRIDIAN_NURSE,
+    [HEAL_LOCATION_PEWTER_CITY - 1] = LOCALID_PEWTER_NURSE,
+    [HEAL_LOCATION_CERULEAN_CITY - 1] = LOCALID_CERULEAN_NURSE,
+    [HEAL_LOCATION_LAVENDER_TOWN - 1] = LOCALID_LAVENDER_NURSE,
+    [HEAL_LOCATION_VERMILION_CITY - 1] = LOCALID_VERMILION_NURSE,
+    [HEAL_LOCATION_CELADON_CITY - 1] = LOCALID_CELADON_NURSE,
+    [HEAL_LOCATION_FUCHSIA_CITY - 1] = LOCALID_FUCHSIA_NURSE,
+    [HEAL_LOCATION_CINNABAR_ISLAND - 1] = LOCALID_CINNABAR_NURSE,
+    [HEAL_LOCATION_INDIGO_PLATEAU - 1] = LOCALID_LEAGUE_NURSE,
+    [HEAL_LOCATION_SAFFRON_CITY - 1] = LOCALID_SAFFRON_NURSE,
+    [HEAL_LOCATION_ROUTE4 - 1] = LOCALID_ROUTE4_NURSE,
+    [HEAL_LOCATION_ROUTE10 - 1] = LOCALID_ROUTE10_NURSE,
+    [HEAL_LOCATION_ONE_ISLAND - 1] = LOCALID_ONE_ISLAND_NURSE,
+    [HEAL_LOCATION_TWO_ISLAND - 1] = LOCALID_TWO_ISLAND_NURSE,
+    [HEAL_LOCATION_THREE_ISLAND - 1] = LOCALID_THREE_ISLAND_NURSE,
+    [HEAL_LOCATION_FOUR_ISLAND - 1] = LOCALID_FOUR_ISLAND_NURSE,
+    [HEAL_LOCATION_FIVE_ISLAND - 1] = LOCALID_FIVE_ISLAND_NURSE,
+    [HEAL_LOCATION_SEVEN_ISLAND - 1] = LOCALID_SEVEN_ISLAND_NURSE,
+    [HEAL_LOCATION_SIX_ISLAND - 1] = LOCALID_SIX_ISLAND_NURSE,
+};
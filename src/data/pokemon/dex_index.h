@@ -0,0 +1,3598 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated by tools/dex_index/make_dex_index.py
+//
+
+static const u16 sNationalDexNumToSpecies[NATIONAL_DEX_END] =
+{
+#if (P_FAMILY_BULBASAUR)
+    [NATIONAL_DEX_BULBASAUR] = SPECIES_BULBASAUR,
+#endif
+#if (P_FAMILY_BULBASAUR)
+    [NATIONAL_DEX_IVYSAUR] = SPECIES_IVYSAUR,
+#endif
+#if (P_FAMILY_BULBASAUR)
+    [NATIONAL_DEX_VENUSAUR] = SPECIES_VENUSAUR,
+#endif
+#if (P_FAMILY_CHARMANDER)
+    [NATIONAL_DEX_CHARMANDER] = SPECIES_CHARMANDER,
+#endif
+#if (P_FAMILY_CHARMANDER)
+    [NATIONAL_DEX_CHARMELEON] = SPECIES_CHARMELEON,
+#endif
+#if (P_FAMILY_CHARMANDER)
+    [NATIONAL_DEX_CHARIZARD] = SPECIES_CHARIZARD,
+#endif
+#if (P_FAMILY_SQUIRTLE)
+    [NATIONAL_DEX_SQUIRTLE] = SPECIES_SQUIRTLE,
+#endif
+#if (P_FAMILY_SQUIRTLE)
+    [NATIONAL_DEX_WARTORTLE] = SPECIES_WARTORTLE,
+#endif
+#if (P_FAMILY_SQUIRTLE)
+    [NATIONAL_DEX_BLASTOISE] = SPECIES_BLASTOISE,
+#endif
+#if (P_FAMILY_CATERPIE)
+    [NATIONAL_DEX_CATERPIE] = SPECIES_CATERPIE,
+#endif
+#if (P_FAMILY_CATERPIE)
+    [NATIONAL_DEX_METAPOD] = SPECIES_METAPOD,
+#endif
+#if (P_FAMILY_CATERPIE)
+    [NATIONAL_DEX_BUTTERFREE] = SPECIES_BUTTERFREE,
+#endif
+#if (P_FAMILY_WEEDLE)
+    [NATIONAL_DEX_WEEDLE] = SPECIES_WEEDLE,
+#endif
+#if (P_FAMILY_WEEDLE)
+    [NATIONAL_DEX_KAKUNA] = SPECIES_KAKUNA,
+#endif
+#if (P_FAMILY_WEEDLE)
+    [NATIONAL_DEX_BEEDRILL] = SPECIES_BEEDRILL,
+#endif
+#if (P_FAMILY_PIDGEY)
+    [NATIONAL_DEX_PIDGEY] = SPECIES_PIDGEY,
+#endif
+#if (P_FAMILY_PIDGEY)
+    [NATIONAL_DEX_PIDGEOTTO] = SPECIES_PIDGEOTTO,
+#endif
+#if (P_FAMILY_PIDGEY)
+    [NATIONAL_DEX_PIDGEOT] = SPECIES_PIDGEOT,
+#endif
+#if (P_FAMILY_RATTATA)
+    [NATIONAL_DEX_RATTATA] = SPECIES_RATTATA,
+#endif
+#if (P_FAMILY_RATTATA)
+    [NATIONAL_DEX_RATICATE] = SPECIES_RATICATE,
+#endif
+#if (P_FAMILY_SPEAROW)
+    [NATIONAL_DEX_SPEAROW] = SPECIES_SPEAROW,
+#endif
+#if (P_FAMILY_SPEAROW)
+    [NATIONAL_DEX_FEAROW] = SPECIES_FEAROW,
+#endif
+#if (P_FAMILY_EKANS)
+    [NATIONAL_DEX_EKANS] = SPECIES_EKANS,
+#endif
+#if (P_FAMILY_EKANS)
+    [NATIONAL_DEX_ARBOK] = SPECIES_ARBOK,
+#endif
+#if (P_FAMILY_PIKACHU)
+    [NATIONAL_DEX_PIKACHU] = SPECIES_PIKACHU,
+#endif
+#if (P_FAMILY_PIKACHU)
+    [NATIONAL_DEX_RAICHU] = SPECIES_RAICHU,
+#endif
+#if (P_FAMILY_SANDSHREW)
+    [NATIONAL_DEX_SANDSHREW] = SPECIES_SANDSHREW,
+#endif
+#if (P_FAMILY_SANDSHREW)
+    [NATIONAL_DEX_SANDSLASH] = SPECIES_SANDSLASH,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDORAN_F] = SPECIES_NIDORAN_F,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDORINA] = SPECIES_NIDORINA,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDOQUEEN] = SPECIES_NIDOQUEEN,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDORAN_M] = SPECIES_NIDORAN_M,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDORINO] = SPECIES_NIDORINO,
+#endif
+#if (P_FAMILY_NIDORAN)
+    [NATIONAL_DEX_NIDOKING] = SPECIES_NIDOKING,
+#endif
+#if (P_FAMILY_CLEFAIRY)
+    [NATIONAL_DEX_CLEFAIRY] = SPECIES_CLEFAIRY,
+#endif
+#if (P_FAMILY_CLEFAIRY)
+    [NATIONAL_DEX_CLEFABLE] = SPECIES_CLEFABLE,
+#endif
+#if (P_FAMILY_VULPIX)
+    [NATIONAL_DEX_VULPIX] = SPECIES_VULPIX,
+#endif
+#if (P_FAMILY_VULPIX)
+    [NATIONAL_DEX_NINETALES] = SPECIES_NINETALES,
+#endif
+#if (P_FAMILY_JIGGLYPUFF)
+    [NATIONAL_DEX_JIGGLYPUFF] = SPECIES_JIGGLYPUFF,
+#endif
+#if (P_FAMILY_JIGGLYPUFF)
+    [NATIONAL_DEX_WIGGLYTUFF] = SPECIES_WIGGLYTUFF,
+#endif
+#if (P_FAMILY_ZUBAT)
+    [NATIONAL_DEX_ZUBAT] = SPECIES_ZUBAT,
+#endif
+#if (P_FAMILY_ZUBAT)
+    [NATIONAL_DEX_GOLBAT] = SPECIES_GOLBAT,
+#endif
+#if (P_FAMILY_ODDISH)
+    [NATIONAL_DEX_ODDISH] = SPECIES_ODDISH,
+#endif
+#if (P_FAMILY_ODDISH)
+    [NATIONAL_DEX_GLOOM] = SPECIES_GLOOM,
+#endif
+#if (P_FAMILY_ODDISH)
+    [NATIONAL_DEX_VILEPLUME] = SPECIES_VILEPLUME,
+#endif
+#if (P_FAMILY_PARAS)
+    [NATIONAL_DEX_PARAS] = SPECIES_PARAS,
+#endif
+#if (P_FAMILY_PARAS)
+    [NATIONAL_DEX_PARASECT] = SPECIES_PARASECT,
+#endif
+#if (P_FAMILY_VENONAT)
+    [NATIONAL_DEX_VENONAT] = SPECIES_VENONAT,
+#endif
+#if (P_FAMILY_VENONAT)
+    [NATIONAL_DEX_VENOMOTH] = SPECIES_VENOMOTH,
+#endif
+#if (P_FAMILY_DIGLETT)
+    [NATIONAL_DEX_DIGLETT] = SPECIES_DIGLETT,
+#endif
+#if (P_FAMILY_DIGLETT)
+    [NATIONAL_DEX_DUGTRIO] = SPECIES_DUGTRIO,
+#endif
+#if (P_FAMILY_MEOWTH)
+    [NATIONAL_DEX_MEOWTH] = SPECIES_MEOWTH,
+#endif
+#if (P_FAMILY_MEOWTH)
+    [NATIONAL_DEX_PERSIAN] = SPECIES_PERSIAN,
+#endif
+#if (P_FAMILY_PSYDUCK)
+    [NATIONAL_DEX_PSYDUCK] = SPECIES_PSYDUCK,
+#endif
+#if (P_FAMILY_PSYDUCK)
+    [NATIONAL_DEX_GOLDUCK] = SPECIES_GOLDUCK,
+#endif
+#if (P_FAMILY_MANKEY)
+    [NATIONAL_DEX_MANKEY] = SPECIES_MANKEY,
+#endif
+#if (P_FAMILY_MANKEY)
+    [NATIONAL_DEX_PRIMEAPE] = SPECIES_PRIMEAPE,
+#endif
+#if (P_FAMILY_GROWLITHE)
+    [NATIONAL_DEX_GROWLITHE] = SPECIES_GROWLITHE,
+#endif
+#if (P_FAMILY_GROWLITHE)
+    [NATIONAL_DEX_ARCANINE] = SPECIES_ARCANINE,
+#endif
+#if (P_FAMILY_POLIWAG)
+    [NATIONAL_DEX_POLIWAG] = SPECIES_POLIWAG,
+#endif
+#if (P_FAMILY_POLIWAG)
+    [NATIONAL_DEX_POLIWHIRL] = SPECIES_POLIWHIRL,
+#endif
+#if (P_FAMILY_POLIWAG)
+    [NATIONAL_DEX_POLIWRATH] = SPECIES_POLIWRATH,
+#endif
+#if (P_FAMILY_ABRA)
+    [NATIONAL_DEX_ABRA] = SPECIES_ABRA,
+#endif
+#if (P_FAMILY_ABRA)
+    [NATIONAL_DEX_KADABRA] = SPECIES_KADABRA,
+#endif
+#if (P_FAMILY_ABRA)
+    [NATIONAL_DEX_ALAKAZAM] = SPECIES_ALAKAZAM,
+#endif
+#if (P_FAMILY_MACHOP)
+    [NATIONAL_DEX_MACHOP] = SPECIES_MACHOP,
+#endif
+#if (P_FAMILY_MACHOP)
+    [NATIONAL_DEX_MACHOKE] = SPECIES_MACHOKE,
+#endif
+#if (P_FAMILY_MACHOP)
+    [NATIONAL_DEX_MACHAMP] = SPECIES_MACHAMP,
+#endif
+#if (P_FAMILY_BELLSPROUT)
+    [NATIONAL_DEX_BELLSPROUT] = SPECIES_BELLSPROUT,
+#endif
+#if (P_FAMILY_BELLSPROUT)
+    [NATIONAL_DEX_WEEPINBELL] = SPECIES_WEEPINBELL,
+#endif
+#if (P_FAMILY_BELLSPROUT)
+    [NATIONAL_DEX_VICTREEBEL] = SPECIES_VICTREEBEL,
+#endif
+#if (P_FAMILY_TENTACOOL)
+    [NATIONAL_DEX_TENTACOOL] = SPECIES_TENTACOOL,
+#endif
+#if (P_FAMILY_TENTACOOL)
+    [NATIONAL_DEX_TENTACRUEL] = SPECIES_TENTACRUEL,
+#endif
+#if (P_FAMILY_GEODUDE)
+    [NATIONAL_DEX_GEODUDE] = SPECIES_GEODUDE,
+#endif
+#if (P_FAMILY_GEODUDE)
+    [NATIONAL_DEX_GRAVELER] = SPECIES_GRAVELER,
+#endif
+#if (P_FAMILY_GEODUDE)
+    [NATIONAL_DEX_GOLEM] = SPECIES_GOLEM,
+#endif
+#if (P_FAMILY_PONYTA)
+    [NATIONAL_DEX_PONYTA] = SPECIES_PONYTA,
+#endif
+#if (P_FAMILY_PONYTA)
+    [NATIONAL_DEX_RAPIDASH] = SPECIES_RAPIDASH,
+#endif
+#if (P_FAMILY_SLOWPOKE)
+    [NATIONAL_DEX_SLOWPOKE] = SPECIES_SLOWPOKE,
+#endif
+#if (P_FAMILY_SLOWPOKE)
+    [NATIONAL_DEX_SLOWBRO] = SPECIES_SLOWBRO,
+#endif
+#if (P_FAMILY_MAGNEMITE)
+    [NATIONAL_DEX_MAGNEMITE] = SPECIES_MAGNEMITE,
+#endif
+#if (P_FAMILY_MAGNEMITE)
+    [NATIONAL_DEX_MAGNETON] = SPECIES_MAGNETON,
+#endif
+#if (P_FAMILY_FARFETCHD)
+    [NATIONAL_DEX_FARFETCHD] = SPECIES_FARFETCHD,
+#endif
+#if (P_FAMILY_DODUO)
+    [NATIONAL_DEX_DODUO] = SPECIES_DODUO,
+#endif
+#if (P_FAMILY_DODUO)
+    [NATIONAL_DEX_DODRIO] = SPECIES_DODRIO,
+#endif
+#if (P_FAMILY_SEEL)
+    [NATIONAL_DEX_SEEL] = SPECIES_SEEL,
+#endif
+#if (P_FAMILY_SEEL)
+    [NATIONAL_DEX_DEWGONG] = SPECIES_DEWGONG,
+#endif
+#if (P_FAMILY_GRIMER)
+    [NATIONAL_DEX_GRIMER] = SPECIES_GRIMER,
+#endif
+#if (P_FAMILY_GRIMER)
+    [NATIONAL_DEX_MUK] = SPECIES_MUK,
+#endif
+#if (P_FAMILY_SHELLDER)
+    [NATIONAL_DEX_SHELLDER] = SPECIES_SHELLDER,
+#endif
+#if (P_FAMILY_SHELLDER)
+    [NATIONAL_DEX_CLOYSTER] = SPECIES_CLOYSTER,
+#endif
+#if (P_FAMILY_GASTLY)
+    [NATIONAL_DEX_GASTLY] = SPECIES_GASTLY,
+#endif
+#if (P_FAMILY_GASTLY)
+    [NATIONAL_DEX_HAUNTER] = SPECIES_HAUNTER,
+#endif
+#if (P_FAMILY_GASTLY)
+    [NATIONAL_DEX_GENGAR] = SPECIES_GENGAR,
+#endif
+#if (P_FAMILY_ONIX)
+    [NATIONAL_DEX_ONIX] = SPECIES_ONIX,
+#endif
+#if (P_FAMILY_DROWZEE)
+    [NATIONAL_DEX_DROWZEE] = SPECIES_DROWZEE,
+#endif
+#if (P_FAMILY_DROWZEE)
+    [NATIONAL_DEX_HYPNO] = SPECIES_HYPNO,
+#endif
+#if (P_FAMILY_KRABBY)
+    [NATIONAL_DEX_KRABBY] = SPECIES_KRABBY,
+#endif
+#if (P_FAMILY_KRABBY)
+    [NATIONAL_DEX_KINGLER] = SPECIES_KINGLER,
+#endif
+#if (P_FAMILY_VOLTORB)
+    [NATIONAL_DEX_VOLTORB] = SPECIES_VOLTORB,
+#endif
+#if (P_FAMILY_VOLTORB)
+    [NATIONAL_DEX_ELECTRODE] = SPECIES_ELECTRODE,
+#endif
+#if (P_FAMILY_EXEGGCUTE)
+    [NATIONAL_DEX_EXEGGCUTE] = SPECIES_EXEGGCUTE,
+#endif
+#if (P_FAMILY_EXEGGCUTE)
+    [NATIONAL_DEX_EXEGGUTOR] = SPECIES_EXEGGUTOR,
+#endif
+#if (P_FAMILY_CUBONE)
+    [NATIONAL_DEX_CUBONE] = SPECIES_CUBONE,
+#endif
+#if (P_FAMILY_CUBONE)
+    [NATIONAL_DEX_MAROWAK] = SPECIES_MAROWAK,
+#endif
+#if (P_FAMILY_HITMONS)
+    [NATIONAL_DEX_HITMONLEE] = SPECIES_HITMONLEE,
+#endif
+#if (P_FAMILY_HITMONS)
+    [NATIONAL_DEX_HITMONCHAN] = SPECIES_HITMONCHAN,
+#endif
+#if (P_FAMILY_LICKITUNG)
+    [NATIONAL_DEX_LICKITUNG] = SPECIES_LICKITUNG,
+#endif
+#if (P_FAMILY_KOFFING)
+    [NATIONAL_DEX_KOFFING] = SPECIES_KOFFING,
+#endif
+#if (P_FAMILY_KOFFING)
+    [NATIONAL_DEX_WEEZING] = SPECIES_WEEZING,
+#endif
+#if (P_FAMILY_RHYHORN)
+    [NATIONAL_DEX_RHYHORN] = SPECIES_RHYHORN,
+#endif
+#if (P_FAMILY_RHYHORN)
+    [NATIONAL_DEX_RHYDON] = SPECIES_RHYDON,
+#endif
+#if (P_FAMILY_CHANSEY)
+    [NATIONAL_DEX_CHANSEY] = SPECIES_CHANSEY,
+#endif
+#if (P_FAMILY_TANGELA)
+    [NATIONAL_DEX_TANGELA] = SPECIES_TANGELA,
+#endif
+#if (P_FAMILY_KANGASKHAN)
+    [NATIONAL_DEX_KANGASKHAN] = SPECIES_KANGASKHAN,
+#endif
+#if (P_FAMILY_HORSEA)
+    [NATIONAL_DEX_HORSEA] = SPECIES_HORSEA,
+#endif
+#if (P_FAMILY_HORSEA)
+    [NATIONAL_DEX_SEADRA] = SPECIES_SEADRA,
+#endif
+#if (P_FAMILY_GOLDEEN)
+    [NATIONAL_DEX_GOLDEEN] = SPECIES_GOLDEEN,
+#endif
+#if (P_FAMILY_GOLDEEN)
+    [NATIONAL_DEX_SEAKING] = SPECIES_SEAKING,
+#endif
+#if (P_FAMILY_STARYU)
+    [NATIONAL_DEX_STARYU] = SPECIES_STARYU,
+#endif
+#if (P_FAMILY_STARYU)
+    [NATIONAL_DEX_STARMIE] = SPECIES_STARMIE,
+#endif
+#if (P_FAMILY_MR_MIME)
+    [NATIONAL_DEX_MR_MIME] = SPECIES_MR_MIME,
+#endif
+#if (P_FAMILY_SCYTHER)
+    [NATIONAL_DEX_SCYTHER] = SPECIES_SCYTHER,
+#endif
+#if (P_FAMILY_JYNX)
+    [NATIONAL_DEX_JYNX] = SPECIES_JYNX,
+#endif
+#if (P_FAMILY_ELECTABUZZ)
+    [NATIONAL_DEX_ELECTABUZZ] = SPECIES_ELECTABUZZ,
+#endif
+#if (P_FAMILY_MAGMAR)
+    [NATIONAL_DEX_MAGMAR] = SPECIES_MAGMAR,
+#endif
+#if (P_FAMILY_PINSIR)
+    [NATIONAL_DEX_PINSIR] = SPECIES_PINSIR,
+#endif
+#if (P_FAMILY_TAUROS)
+    [NATIONAL_DEX_TAUROS] = SPECIES_TAUROS,
+#endif
+#if (P_FAMILY_MAGIKARP)
+    [NATIONAL_DEX_MAGIKARP] = SPECIES_MAGIKARP,
+#endif
+#if (P_FAMILY_MAGIKARP)
+    [NATIONAL_DEX_GYARADOS] = SPECIES_GYARADOS,
+#endif
+#if (P_FAMILY_LAPRAS)
+    [NATIONAL_DEX_LAPRAS] = SPECIES_LAPRAS,
+#endif
+#if (P_FAMILY_DITTO)
+    [NATIONAL_DEX_DITTO] = SPECIES_DITTO,
+#endif
+#if (P_FAMILY_EEVEE)
+    [NATIONAL_DEX_EEVEE] = SPECIES_EEVEE,
+#endif
+#if (P_FAMILY_EEVEE)
+    [NATIONAL_DEX_VAPOREON] = SPECIES_VAPOREON,
+#endif
+#if (P_FAMILY_EEVEE)
+    [NATIONAL_DEX_JOLTEON] = SPECIES_JOLTEON,
+#endif
+#if (P_FAMILY_EEVEE)
+    [NATIONAL_DEX_FLAREON] = SPECIES_FLAREON,
+#endif
+#if (P_FAMILY_PORYGON)
+    [NATIONAL_DEX_PORYGON] = SPECIES_PORYGON,
+#endif
+#if (P_FAMILY_OMANYTE)
+    [NATIONAL_DEX_OMANYTE] = SPECIES_OMANYTE,
+#endif
+#if (P_FAMILY_OMANYTE)
+    [NATIONAL_DEX_OMASTAR] = SPECIES_OMASTAR,
+#endif
+#if (P_FAMILY_KABUTO)
+    [NATIONAL_DEX_KABUTO] = SPECIES_KABUTO,
+#endif
+#if (P_FAMILY_KABUTO)
+    [NATIONAL_DEX_KABUTOPS] = SPECIES_KABUTOPS,
+#endif
+#if (P_FAMILY_AERODACTYL)
+    [NATIONAL_DEX_AERODACTYL] = SPECIES_AERODACTYL,
+#endif
+#if (P_FAMILY_SNORLAX)
+    [NATIONAL_DEX_SNORLAX] = SPECIES_SNORLAX,
+#endif
+#if (P_FAMILY_ARTICUNO)
+    [NATIONAL_DEX_ARTICUNO] = SPECIES_ARTICUNO,
+#endif
+#if (P_FAMILY_ZAPDOS)
+    [NATIONAL_DEX_ZAPDOS] = SPECIES_ZAPDOS,
+#endif
+#if (P_FAMILY_MOLTRES)
+    [NATIONAL_DEX_MOLTRES] = SPECIES_MOLTRES,
+#endif
+#if (P_FAMILY_DRATINI)
+    [NATIONAL_DEX_DRATINI] = SPECIES_DRATINI,
+#endif
+#if (P_FAMILY_DRATINI)
+    [NATIONAL_DEX_DRAGONAIR] = SPECIES_DRAGONAIR,
+#endif
+#if (P_FAMILY_DRATINI)
+    [NATIONAL_DEX_DRAGONITE] = SPECIES_DRAGONITE,
+#endif
+#if (P_FAMILY_MEWTWO)
+    [NATIONAL_DEX_MEWTWO] = SPECIES_MEWTWO,
+#endif
+#if (P_FAMILY_MEW)
+    [NATIONAL_DEX_MEW] = SPECIES_MEW,
+#endif
+#if (P_FAMILY_CHIKORITA)
+    [NATIONAL_DEX_CHIKORITA] = SPECIES_CHIKORITA,
+#endif
+#if (P_FAMILY_CHIKORITA)
+    [NATIONAL_DEX_BAYLEEF] = SPECIES_BAYLEEF,
+#endif
+#if (P_FAMILY_CHIKORITA)
+    [NATIONAL_DEX_MEGANIUM] = SPECIES_MEGANIUM,
+#endif
+#if (P_FAMILY_CYNDAQUIL)
+    [NATIONAL_DEX_CYNDAQUIL] = SPECIES_CYNDAQUIL,
+#endif
+#if (P_FAMILY_CYNDAQUIL)
+    [NATIONAL_DEX_QUILAVA] = SPECIES_QUILAVA,
+#endif
+#if (P_FAMILY_CYNDAQUIL)
+    [NATIONAL_DEX_TYPHLOSION] = SPECIES_TYPHLOSION,
+#endif
+#if (P_FAMILY_TOTODILE)
+    [NATIONAL_DEX_TOTODILE] = SPECIES_TOTODILE,
+#endif
+#if (P_FAMILY_TOTODILE)
+    [NATIONAL_DEX_CROCONAW] = SPECIES_CROCONAW,
+#endif
+#if (P_FAMILY_TOTODILE)
+    [NATIONAL_DEX_FERALIGATR] = SPECIES_FERALIGATR,
+#endif
+#if (P_FAMILY_SENTRET)
+    [NATIONAL_DEX_SENTRET] = SPECIES_SENTRET,
+#endif
+#if (P_FAMILY_SENTRET)
+    [NATIONAL_DEX_FURRET] = SPECIES_FURRET,
+#endif
+#if (P_FAMILY_HOOTHOOT)
+    [NATIONAL_DEX_HOOTHOOT] = SPECIES_HOOTHOOT,
+#endif
+#if (P_FAMILY_HOOTHOOT)
+    [NATIONAL_DEX_NOCTOWL] = SPECIES_NOCTOWL,
+#endif
+#if (P_FAMILY_LEDYBA)
+    [NATIONAL_DEX_LEDYBA] = SPECIES_LEDYBA,
+#endif
+#if (P_FAMILY_LEDYBA)
+    [NATIONAL_DEX_LEDIAN] = SPECIES_LEDIAN,
+#endif
+#if (P_FAMILY_SPINARAK)
+    [NATIONAL_DEX_SPINARAK] = SPECIES_SPINARAK,
+#endif
+#if (P_FAMILY_SPINARAK)
+    [NATIONAL_DEX_ARIADOS] = SPECIES_ARIADOS,
+#endif
+#if (P_FAMILY_ZUBAT) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_CROBAT] = SPECIES_CROBAT,
+#endif
+#if (P_FAMILY_CHINCHOU)
+    [NATIONAL_DEX_CHINCHOU] = SPECIES_CHINCHOU,
+#endif
+#if (P_FAMILY_CHINCHOU)
+    [NATIONAL_DEX_LANTURN] = SPECIES_LANTURN,
+#endif
+#if (P_FAMILY_PIKACHU) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_PICHU] = SPECIES_PICHU,
+#endif
+#if (P_FAMILY_CLEFAIRY) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_CLEFFA] = SPECIES_CLEFFA,
+#endif
+#if (P_FAMILY_JIGGLYPUFF) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_IGGLYBUFF] = SPECIES_IGGLYBUFF,
+#endif
+#if (P_FAMILY_TOGEPI)
+    [NATIONAL_DEX_TOGEPI] = SPECIES_TOGEPI,
+#endif
+#if (P_FAMILY_TOGEPI)
+    [NATIONAL_DEX_TOGETIC] = SPECIES_TOGETIC,
+#endif
+#if (P_FAMILY_NATU)
+    [NATIONAL_DEX_NATU] = SPECIES_NATU,
+#endif
+#if (P_FAMILY_NATU)
+    [NATIONAL_DEX_XATU] = SPECIES_XATU,
+#endif
+#if (P_FAMILY_MAREEP)
+    [NATIONAL_DEX_MAREEP] = SPECIES_MAREEP,
+#endif
+#if (P_FAMILY_MAREEP)
+    [NATIONAL_DEX_FLAAFFY] = SPECIES_FLAAFFY,
+#endif
+#if (P_FAMILY_MAREEP)
+    [NATIONAL_DEX_AMPHAROS] = SPECIES_AMPHAROS,
+#endif
+#if (P_FAMILY_ODDISH) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_BELLOSSOM] = SPECIES_BELLOSSOM,
+#endif
+#if (P_FAMILY_MARILL)
+    [NATIONAL_DEX_MARILL] = SPECIES_MARILL,
+#endif
+#if (P_FAMILY_MARILL)
+    [NATIONAL_DEX_AZUMARILL] = SPECIES_AZUMARILL,
+#endif
+#if (P_FAMILY_SUDOWOODO)
+    [NATIONAL_DEX_SUDOWOODO] = SPECIES_SUDOWOODO,
+#endif
+#if (P_FAMILY_POLIWAG) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_POLITOED] = SPECIES_POLITOED,
+#endif
+#if (P_FAMILY_HOPPIP)
+    [NATIONAL_DEX_HOPPIP] = SPECIES_HOPPIP,
+#endif
+#if (P_FAMILY_HOPPIP)
+    [NATIONAL_DEX_SKIPLOOM] = SPECIES_SKIPLOOM,
+#endif
+#if (P_FAMILY_HOPPIP)
+    [NATIONAL_DEX_JUMPLUFF] = SPECIES_JUMPLUFF,
+#endif
+#if (P_FAMILY_AIPOM)
+    [NATIONAL_DEX_AIPOM] = SPECIES_AIPOM,
+#endif
+#if (P_FAMILY_SUNKERN)
+    [NATIONAL_DEX_SUNKERN] = SPECIES_SUNKERN,
+#endif
+#if (P_FAMILY_SUNKERN)
+    [NATIONAL_DEX_SUNFLORA] = SPECIES_SUNFLORA,
+#endif
+#if (P_FAMILY_YANMA)
+    [NATIONAL_DEX_YANMA] = SPECIES_YANMA,
+#endif
+#if (P_FAMILY_WOOPER)
+    [NATIONAL_DEX_WOOPER] = SPECIES_WOOPER,
+#endif
+#if (P_FAMILY_WOOPER)
+    [NATIONAL_DEX_QUAGSIRE] = SPECIES_QUAGSIRE,
+#endif
+#if (P_FAMILY_EEVEE) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_ESPEON] = SPECIES_ESPEON,
+#endif
+#if (P_FAMILY_EEVEE) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_UMBREON] = SPECIES_UMBREON,
+#endif
+#if (P_FAMILY_MURKROW)
+    [NATIONAL_DEX_MURKROW] = SPECIES_MURKROW,
+#endif
+#if (P_FAMILY_SLOWPOKE) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SLOWKING] = SPECIES_SLOWKING,
+#endif
+#if (P_FAMILY_MISDREAVUS)
+    [NATIONAL_DEX_MISDREAVUS] = SPECIES_MISDREAVUS,
+#endif
+#if (P_FAMILY_UNOWN)
+    [NATIONAL_DEX_UNOWN] = SPECIES_UNOWN,
+#endif
+#if (P_FAMILY_WOBBUFFET)
+    [NATIONAL_DEX_WOBBUFFET] = SPECIES_WOBBUFFET,
+#endif
+#if (P_FAMILY_GIRAFARIG)
+    [NATIONAL_DEX_GIRAFARIG] = SPECIES_GIRAFARIG,
+#endif
+#if (P_FAMILY_PINECO)
+    [NATIONAL_DEX_PINECO] = SPECIES_PINECO,
+#endif
+#if (P_FAMILY_PINECO)
+    [NATIONAL_DEX_FORRETRESS] = SPECIES_FORRETRESS,
+#endif
+#if (P_FAMILY_DUNSPARCE)
+    [NATIONAL_DEX_DUNSPARCE] = SPECIES_DUNSPARCE,
+#endif
+#if (P_FAMILY_GLIGAR)
+    [NATIONAL_DEX_GLIGAR] = SPECIES_GLIGAR,
+#endif
+#if (P_FAMILY_ONIX) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_STEELIX] = SPECIES_STEELIX,
+#endif
+#if (P_FAMILY_SNUBBULL)
+    [NATIONAL_DEX_SNUBBULL] = SPECIES_SNUBBULL,
+#endif
+#if (P_FAMILY_SNUBBULL)
+    [NATIONAL_DEX_GRANBULL] = SPECIES_GRANBULL,
+#endif
+#if (P_FAMILY_QWILFISH)
+    [NATIONAL_DEX_QWILFISH] = SPECIES_QWILFISH,
+#endif
+#if (P_FAMILY_SCYTHER) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SCIZOR] = SPECIES_SCIZOR,
+#endif
+#if (P_FAMILY_SHUCKLE)
+    [NATIONAL_DEX_SHUCKLE] = SPECIES_SHUCKLE,
+#endif
+#if (P_FAMILY_HERACROSS)
+    [NATIONAL_DEX_HERACROSS] = SPECIES_HERACROSS,
+#endif
+#if (P_FAMILY_SNEASEL)
+    [NATIONAL_DEX_SNEASEL] = SPECIES_SNEASEL,
+#endif
+#if (P_FAMILY_TEDDIURSA)
+    [NATIONAL_DEX_TEDDIURSA] = SPECIES_TEDDIURSA,
+#endif
+#if (P_FAMILY_TEDDIURSA)
+    [NATIONAL_DEX_URSARING] = SPECIES_URSARING,
+#endif
+#if (P_FAMILY_SLUGMA)
+    [NATIONAL_DEX_SLUGMA] = SPECIES_SLUGMA,
+#endif
+#if (P_FAMILY_SLUGMA)
+    [NATIONAL_DEX_MAGCARGO] = SPECIES_MAGCARGO,
+#endif
+#if (P_FAMILY_SWINUB)
+    [NATIONAL_DEX_SWINUB] = SPECIES_SWINUB,
+#endif
+#if (P_FAMILY_SWINUB)
+    [NATIONAL_DEX_PILOSWINE] = SPECIES_PILOSWINE,
+#endif
+#if (P_FAMILY_CORSOLA)
+    [NATIONAL_DEX_CORSOLA] = SPECIES_CORSOLA,
+#endif
+#if (P_FAMILY_REMORAID)
+    [NATIONAL_DEX_REMORAID] = SPECIES_REMORAID,
+#endif
+#if (P_FAMILY_REMORAID)
+    [NATIONAL_DEX_OCTILLERY] = SPECIES_OCTILLERY,
+#endif
+#if (P_FAMILY_DELIBIRD)
+    [NATIONAL_DEX_DELIBIRD] = SPECIES_DELIBIRD,
+#endif
+#if (P_FAMILY_MANTINE)
+    [NATIONAL_DEX_MANTINE] = SPECIES_MANTINE,
+#endif
+#if (P_FAMILY_SKARMORY)
+    [NATIONAL_DEX_SKARMORY] = SPECIES_SKARMORY,
+#endif
+#if (P_FAMILY_HOUNDOUR)
+    [NATIONAL_DEX_HOUNDOUR] = SPECIES_HOUNDOUR,
+#endif
+#if (P_FAMILY_HOUNDOUR)
+    [NATIONAL_DEX_HOUNDOOM] = SPECIES_HOUNDOOM,
+#endif
+#if (P_FAMILY_HORSEA) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_KINGDRA] = SPECIES_KINGDRA,
+#endif
+#if (P_FAMILY_PHANPY)
+    [NATIONAL_DEX_PHANPY] = SPECIES_PHANPY,
+#endif
+#if (P_FAMILY_PHANPY)
+    [NATIONAL_DEX_DONPHAN] = SPECIES_DONPHAN,
+#endif
+#if (P_FAMILY_PORYGON) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_PORYGON2] = SPECIES_PORYGON2,
+#endif
+#if (P_FAMILY_STANTLER)
+    [NATIONAL_DEX_STANTLER] = SPECIES_STANTLER,
+#endif
+#if (P_FAMILY_SMEARGLE)
+    [NATIONAL_DEX_SMEARGLE] = SPECIES_SMEARGLE,
+#endif
+#if (P_FAMILY_HITMONS) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_TYROGUE] = SPECIES_TYROGUE,
+#endif
+#if (P_FAMILY_HITMONS) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_HITMONTOP] = SPECIES_HITMONTOP,
+#endif
+#if (P_FAMILY_JYNX) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SMOOCHUM] = SPECIES_SMOOCHUM,
+#endif
+#if (P_FAMILY_ELECTABUZZ) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_ELEKID] = SPECIES_ELEKID,
+#endif
+#if (P_FAMILY_MAGMAR) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_MAGBY] = SPECIES_MAGBY,
+#endif
+#if (P_FAMILY_MILTANK)
+    [NATIONAL_DEX_MILTANK] = SPECIES_MILTANK,
+#endif
+#if (P_FAMILY_CHANSEY) && (P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_BLISSEY] = SPECIES_BLISSEY,
+#endif
+#if (P_FAMILY_RAIKOU)
+    [NATIONAL_DEX_RAIKOU] = SPECIES_RAIKOU,
+#endif
+#if (P_FAMILY_ENTEI)
+    [NATIONAL_DEX_ENTEI] = SPECIES_ENTEI,
+#endif
+#if (P_FAMILY_SUICUNE)
+    [NATIONAL_DEX_SUICUNE] = SPECIES_SUICUNE,
+#endif
+#if (P_FAMILY_LARVITAR)
+    [NATIONAL_DEX_LARVITAR] = SPECIES_LARVITAR,
+#endif
+#if (P_FAMILY_LARVITAR)
+    [NATIONAL_DEX_PUPITAR] = SPECIES_PUPITAR,
+#endif
+#if (P_FAMILY_LARVITAR)
+    [NATIONAL_DEX_TYRANITAR] = SPECIES_TYRANITAR,
+#endif
+#if (P_FAMILY_LUGIA)
+    [NATIONAL_DEX_LUGIA] = SPECIES_LUGIA,
+#endif
+#if (P_FAMILY_HO_OH)
+    [NATIONAL_DEX_HO_OH] = SPECIES_HO_OH,
+#endif
+#if (P_FAMILY_CELEBI)
+    [NATIONAL_DEX_CELEBI] = SPECIES_CELEBI,
+#endif
+#if (P_FAMILY_TREECKO)
+    [NATIONAL_DEX_TREECKO] = SPECIES_TREECKO,
+#endif
+#if (P_FAMILY_TREECKO)
+    [NATIONAL_DEX_GROVYLE] = SPECIES_GROVYLE,
+#endif
+#if (P_FAMILY_TREECKO)
+    [NATIONAL_DEX_SCEPTILE] = SPECIES_SCEPTILE,
+#endif
+#if (P_FAMILY_TORCHIC)
+    [NATIONAL_DEX_TORCHIC] = SPECIES_TORCHIC,
+#endif
+#if (P_FAMILY_TORCHIC)
+    [NATIONAL_DEX_COMBUSKEN] = SPECIES_COMBUSKEN,
+#endif
+#if (P_FAMILY_TORCHIC)
+    [NATIONAL_DEX_BLAZIKEN] = SPECIES_BLAZIKEN,
+#endif
+#if (P_FAMILY_MUDKIP)
+    [NATIONAL_DEX_MUDKIP] = SPECIES_MUDKIP,
+#endif
+#if (P_FAMILY_MUDKIP)
+    [NATIONAL_DEX_MARSHTOMP] = SPECIES_MARSHTOMP,
+#endif
+#if (P_FAMILY_MUDKIP)
+    [NATIONAL_DEX_SWAMPERT] = SPECIES_SWAMPERT,
+#endif
+#if (P_FAMILY_POOCHYENA)
+    [NATIONAL_DEX_POOCHYENA] = SPECIES_POOCHYENA,
+#endif
+#if (P_FAMILY_POOCHYENA)
+    [NATIONAL_DEX_MIGHTYENA] = SPECIES_MIGHTYENA,
+#endif
+#if (P_FAMILY_ZIGZAGOON)
+    [NATIONAL_DEX_ZIGZAGOON] = SPECIES_ZIGZAGOON,
+#endif
+#if (P_FAMILY_ZIGZAGOON)
+    [NATIONAL_DEX_LINOONE] = SPECIES_LINOONE,
+#endif
+#if (P_FAMILY_WURMPLE)
+    [NATIONAL_DEX_WURMPLE] = SPECIES_WURMPLE,
+#endif
+#if (P_FAMILY_WURMPLE)
+    [NATIONAL_DEX_SILCOON] = SPECIES_SILCOON,
+#endif
+#if (P_FAMILY_WURMPLE)
+    [NATIONAL_DEX_BEAUTIFLY] = SPECIES_BEAUTIFLY,
+#endif
+#if (P_FAMILY_WURMPLE)
+    [NATIONAL_DEX_CASCOON] = SPECIES_CASCOON,
+#endif
+#if (P_FAMILY_WURMPLE)
+    [NATIONAL_DEX_DUSTOX] = SPECIES_DUSTOX,
+#endif
+#if (P_FAMILY_LOTAD)
+    [NATIONAL_DEX_LOTAD] = SPECIES_LOTAD,
+#endif
+#if (P_FAMILY_LOTAD)
+    [NATIONAL_DEX_LOMBRE] = SPECIES_LOMBRE,
+#endif
+#if (P_FAMILY_LOTAD)
+    [NATIONAL_DEX_LUDICOLO] = SPECIES_LUDICOLO,
+#endif
+#if (P_FAMILY_SEEDOT)
+    [NATIONAL_DEX_SEEDOT] = SPECIES_SEEDOT,
+#endif
+#if (P_FAMILY_SEEDOT)
+    [NATIONAL_DEX_NUZLEAF] = SPECIES_NUZLEAF,
+#endif
+#if (P_FAMILY_SEEDOT)
+    [NATIONAL_DEX_SHIFTRY] = SPECIES_SHIFTRY,
+#endif
+#if (P_FAMILY_TAILLOW)
+    [NATIONAL_DEX_TAILLOW] = SPECIES_TAILLOW,
+#endif
+#if (P_FAMILY_TAILLOW)
+    [NATIONAL_DEX_SWELLOW] = SPECIES_SWELLOW,
+#endif
+#if (P_FAMILY_WINGULL)
+    [NATIONAL_DEX_WINGULL] = SPECIES_WINGULL,
+#endif
+#if (P_FAMILY_WINGULL)
+    [NATIONAL_DEX_PELIPPER] = SPECIES_PELIPPER,
+#endif
+#if (P_FAMILY_RALTS)
+    [NATIONAL_DEX_RALTS] = SPECIES_RALTS,
+#endif
+#if (P_FAMILY_RALTS)
+    [NATIONAL_DEX_KIRLIA] = SPECIES_KIRLIA,
+#endif
+#if (P_FAMILY_RALTS)
+    [NATIONAL_DEX_GARDEVOIR] = SPECIES_GARDEVOIR,
+#endif
+#if (P_FAMILY_SURSKIT)
+    [NATIONAL_DEX_SURSKIT] = SPECIES_SURSKIT,
+#endif
+#if (P_FAMILY_SURSKIT)
+    [NATIONAL_DEX_MASQUERAIN] = SPECIES_MASQUERAIN,
+#endif
+#if (P_FAMILY_SHROOMISH)
+    [NATIONAL_DEX_SHROOMISH] = SPECIES_SHROOMISH,
+#endif
+#if (P_FAMILY_SHROOMISH)
+    [NATIONAL_DEX_BRELOOM] = SPECIES_BRELOOM,
+#endif
+#if (P_FAMILY_SLAKOTH)
+    [NATIONAL_DEX_SLAKOTH] = SPECIES_SLAKOTH,
+#endif
+#if (P_FAMILY_SLAKOTH)
+    [NATIONAL_DEX_VIGOROTH] = SPECIES_VIGOROTH,
+#endif
+#if (P_FAMILY_SLAKOTH)
+    [NATIONAL_DEX_SLAKING] = SPECIES_SLAKING,
+#endif
+#if (P_FAMILY_NINCADA)
+    [NATIONAL_DEX_NINCADA] = SPECIES_NINCADA,
+#endif
+#if (P_FAMILY_NINCADA)
+    [NATIONAL_DEX_NINJASK] = SPECIES_NINJASK,
+#endif
+#if (P_FAMILY_NINCADA)
+    [NATIONAL_DEX_SHEDINJA] = SPECIES_SHEDINJA,
+#endif
+#if (P_FAMILY_WHISMUR)
+    [NATIONAL_DEX_WHISMUR] = SPECIES_WHISMUR,
+#endif
+#if (P_FAMILY_WHISMUR)
+    [NATIONAL_DEX_LOUDRED] = SPECIES_LOUDRED,
+#endif
+#if (P_FAMILY_WHISMUR)
+    [NATIONAL_DEX_EXPLOUD] = SPECIES_EXPLOUD,
+#endif
+#if (P_FAMILY_MAKUHITA)
+    [NATIONAL_DEX_MAKUHITA] = SPECIES_MAKUHITA,
+#endif
+#if (P_FAMILY_MAKUHITA)
+    [NATIONAL_DEX_HARIYAMA] = SPECIES_HARIYAMA,
+#endif
+#if (P_FAMILY_MARILL) && (P_GEN_3_CROSS_EVOS)
+    [NATIONAL_DEX_AZURILL] = SPECIES_AZURILL,
+#endif
+#if (P_FAMILY_NOSEPASS)
+    [NATIONAL_DEX_NOSEPASS] = SPECIES_NOSEPASS,
+#endif
+#if (P_FAMILY_SKITTY)
+    [NATIONAL_DEX_SKITTY] = SPECIES_SKITTY,
+#endif
+#if (P_FAMILY_SKITTY)
+    [NATIONAL_DEX_DELCATTY] = SPECIES_DELCATTY,
+#endif
+#if (P_FAMILY_SABLEYE)
+    [NATIONAL_DEX_SABLEYE] = SPECIES_SABLEYE,
+#endif
+#if (P_FAMILY_MAWILE)
+    [NATIONAL_DEX_MAWILE] = SPECIES_MAWILE,
+#endif
+#if (P_FAMILY_ARON)
+    [NATIONAL_DEX_ARON] = SPECIES_ARON,
+#endif
+#if (P_FAMILY_ARON)
+    [NATIONAL_DEX_LAIRON] = SPECIES_LAIRON,
+#endif
+#if (P_FAMILY_ARON)
+    [NATIONAL_DEX_AGGRON] = SPECIES_AGGRON,
+#endif
+#if (P_FAMILY_MEDITITE)
+    [NATIONAL_DEX_MEDITITE] = SPECIES_MEDITITE,
+#endif
+#if (P_FAMILY_MEDITITE)
+    [NATIONAL_DEX_MEDICHAM] = SPECIES_MEDICHAM,
+#endif
+#if (P_FAMILY_ELECTRIKE)
+    [NATIONAL_DEX_ELECTRIKE] = SPECIES_ELECTRIKE,
+#endif
+#if (P_FAMILY_ELECTRIKE)
+    [NATIONAL_DEX_MANECTRIC] = SPECIES_MANECTRIC,
+#endif
+#if (P_FAMILY_PLUSLE)
+    [NATIONAL_DEX_PLUSLE] = SPECIES_PLUSLE,
+#endif
+#if (P_FAMILY_MINUN)
+    [NATIONAL_DEX_MINUN] = SPECIES_MINUN,
+#endif
+#if (P_FAMILY_VOLBEAT_ILLUMISE)
+    [NATIONAL_DEX_VOLBEAT] = SPECIES_VOLBEAT,
+#endif
+#if (P_FAMILY_VOLBEAT_ILLUMISE)
+    [NATIONAL_DEX_ILLUMISE] = SPECIES_ILLUMISE,
+#endif
+#if (P_FAMILY_ROSELIA)
+    [NATIONAL_DEX_ROSELIA] = SPECIES_ROSELIA,
+#endif
+#if (P_FAMILY_GULPIN)
+    [NATIONAL_DEX_GULPIN] = SPECIES_GULPIN,
+#endif
+#if (P_FAMILY_GULPIN)
+    [NATIONAL_DEX_SWALOT] = SPECIES_SWALOT,
+#endif
+#if (P_FAMILY_CARVANHA)
+    [NATIONAL_DEX_CARVANHA] = SPECIES_CARVANHA,
+#endif
+#if (P_FAMILY_CARVANHA)
+    [NATIONAL_DEX_SHARPEDO] = SPECIES_SHARPEDO,
+#endif
+#if (P_FAMILY_WAILMER)
+    [NATIONAL_DEX_WAILMER] = SPECIES_WAILMER,
+#endif
+#if (P_FAMILY_WAILMER)
+    [NATIONAL_DEX_WAILORD] = SPECIES_WAILORD,
+#endif
+#if (P_FAMILY_NUMEL)
+    [NATIONAL_DEX_NUMEL] = SPECIES_NUMEL,
+#endif
+#if (P_FAMILY_NUMEL)
+    [NATIONAL_DEX_CAMERUPT] = SPECIES_CAMERUPT,
+#endif
+#if (P_FAMILY_TORKOAL)
+    [NATIONAL_DEX_TORKOAL] = SPECIES_TORKOAL,
+#endif
+#if (P_FAMILY_SPOINK)
+    [NATIONAL_DEX_SPOINK] = SPECIES_SPOINK,
+#endif
+#if (P_FAMILY_SPOINK)
+    [NATIONAL_DEX_GRUMPIG] = SPECIES_GRUMPIG,
+#endif
+#if (P_FAMILY_SPINDA)
+    [NATIONAL_DEX_SPINDA] = SPECIES_SPINDA,
+#endif
+#if (P_FAMILY_TRAPINCH)
+    [NATIONAL_DEX_TRAPINCH] = SPECIES_TRAPINCH,
+#endif
+#if (P_FAMILY_TRAPINCH)
+    [NATIONAL_DEX_VIBRAVA] = SPECIES_VIBRAVA,
+#endif
+#if (P_FAMILY_TRAPINCH)
+    [NATIONAL_DEX_FLYGON] = SPECIES_FLYGON,
+#endif
+#if (P_FAMILY_CACNEA)
+    [NATIONAL_DEX_CACNEA] = SPECIES_CACNEA,
+#endif
+#if (P_FAMILY_CACNEA)
+    [NATIONAL_DEX_CACTURNE] = SPECIES_CACTURNE,
+#endif
+#if (P_FAMILY_SWABLU)
+    [NATIONAL_DEX_SWABLU] = SPECIES_SWABLU,
+#endif
+#if (P_FAMILY_SWABLU)
+    [NATIONAL_DEX_ALTARIA] = SPECIES_ALTARIA,
+#endif
+#if (P_FAMILY_ZANGOOSE)
+    [NATIONAL_DEX_ZANGOOSE] = SPECIES_ZANGOOSE,
+#endif
+#if (P_FAMILY_SEVIPER)
+    [NATIONAL_DEX_SEVIPER] = SPECIES_SEVIPER,
+#endif
+#if (P_FAMILY_LUNATONE)
+    [NATIONAL_DEX_LUNATONE] = SPECIES_LUNATONE,
+#endif
+#if (P_FAMILY_SOLROCK)
+    [NATIONAL_DEX_SOLROCK] = SPECIES_SOLROCK,
+#endif
+#if (P_FAMILY_BARBOACH)
+    [NATIONAL_DEX_BARBOACH] = SPECIES_BARBOACH,
+#endif
+#if (P_FAMILY_BARBOACH)
+    [NATIONAL_DEX_WHISCASH] = SPECIES_WHISCASH,
+#endif
+#if (P_FAMILY_CORPHISH)
+    [NATIONAL_DEX_CORPHISH] = SPECIES_CORPHISH,
+#endif
+#if (P_FAMILY_CORPHISH)
+    [NATIONAL_DEX_CRAWDAUNT] = SPECIES_CRAWDAUNT,
+#endif
+#if (P_FAMILY_BALTOY)
+    [NATIONAL_DEX_BALTOY] = SPECIES_BALTOY,
+#endif
+#if (P_FAMILY_BALTOY)
+    [NATIONAL_DEX_CLAYDOL] = SPECIES_CLAYDOL,
+#endif
+#if (P_FAMILY_LILEEP)
+    [NATIONAL_DEX_LILEEP] = SPECIES_LILEEP,
+#endif
+#if (P_FAMILY_LILEEP)
+    [NATIONAL_DEX_CRADILY] = SPECIES_CRADILY,
+#endif
+#if (P_FAMILY_ANORITH)
+    [NATIONAL_DEX_ANORITH] = SPECIES_ANORITH,
+#endif
+#if (P_FAMILY_ANORITH)
+    [NATIONAL_DEX_ARMALDO] = SPECIES_ARMALDO,
+#endif
+#if (P_FAMILY_FEEBAS)
+    [NATIONAL_DEX_FEEBAS] = SPECIES_FEEBAS,
+#endif
+#if (P_FAMILY_FEEBAS)
+    [NATIONAL_DEX_MILOTIC] = SPECIES_MILOTIC,
+#endif
+#if (P_FAMILY_CASTFORM)
+    [NATIONAL_DEX_CASTFORM] = SPECIES_CASTFORM_NORMAL,
+#endif
+#if (P_FAMILY_KECLEON)
+    [NATIONAL_DEX_KECLEON] = SPECIES_KECLEON,
+#endif
+#if (P_FAMILY_SHUPPET)
+    [NATIONAL_DEX_SHUPPET] = SPECIES_SHUPPET,
+#endif
+#if (P_FAMILY_SHUPPET)
+    [NATIONAL_DEX_BANETTE] = SPECIES_BANETTE,
+#endif
+#if (P_FAMILY_DUSKULL)
+    [NATIONAL_DEX_DUSKULL] = SPECIES_DUSKULL,
+#endif
+#if (P_FAMILY_DUSKULL)
+    [NATIONAL_DEX_DUSCLOPS] = SPECIES_DUSCLOPS,
+#endif
+#if (P_FAMILY_TROPIUS)
+    [NATIONAL_DEX_TROPIUS] = SPECIES_TROPIUS,
+#endif
+#if (P_FAMILY_CHIMECHO)
+    [NATIONAL_DEX_CHIMECHO] = SPECIES_CHIMECHO,
+#endif
+#if (P_FAMILY_ABSOL)
+    [NATIONAL_DEX_ABSOL] = SPECIES_ABSOL,
+#endif
+#if (P_FAMILY_WOBBUFFET) && (P_GEN_3_CROSS_EVOS)
+    [NATIONAL_DEX_WYNAUT] = SPECIES_WYNAUT,
+#endif
+#if (P_FAMILY_SNORUNT)
+    [NATIONAL_DEX_SNORUNT] = SPECIES_SNORUNT,
+#endif
+#if (P_FAMILY_SNORUNT)
+    [NATIONAL_DEX_GLALIE] = SPECIES_GLALIE,
+#endif
+#if (P_FAMILY_SPHEAL)
+    [NATIONAL_DEX_SPHEAL] = SPECIES_SPHEAL,
+#endif
+#if (P_FAMILY_SPHEAL)
+    [NATIONAL_DEX_SEALEO] = SPECIES_SEALEO,
+#endif
+#if (P_FAMILY_SPHEAL)
+    [NATIONAL_DEX_WALREIN] = SPECIES_WALREIN,
+#endif
+#if (P_FAMILY_CLAMPERL)
+    [NATIONAL_DEX_CLAMPERL] = SPECIES_CLAMPERL,
+#endif
+#if (P_FAMILY_CLAMPERL)
+    [NATIONAL_DEX_HUNTAIL] = SPECIES_HUNTAIL,
+#endif
+#if (P_FAMILY_CLAMPERL)
+    [NATIONAL_DEX_GOREBYSS] = SPECIES_GOREBYSS,
+#endif
+#if (P_FAMILY_RELICANTH)
+    [NATIONAL_DEX_RELICANTH] = SPECIES_RELICANTH,
+#endif
+#if (P_FAMILY_LUVDISC)
+    [NATIONAL_DEX_LUVDISC] = SPECIES_LUVDISC,
+#endif
+#if (P_FAMILY_BAGON)
+    [NATIONAL_DEX_BAGON] = SPECIES_BAGON,
+#endif
+#if (P_FAMILY_BAGON)
+    [NATIONAL_DEX_SHELGON] = SPECIES_SHELGON,
+#endif
+#if (P_FAMILY_BAGON)
+    [NATIONAL_DEX_SALAMENCE] = SPECIES_SALAMENCE,
+#endif
+#if (P_FAMILY_BELDUM)
+    [NATIONAL_DEX_BELDUM] = SPECIES_BELDUM,
+#endif
+#if (P_FAMILY_BELDUM)
+    [NATIONAL_DEX_METANG] = SPECIES_METANG,
+#endif
+#if (P_FAMILY_BELDUM)
+    [NATIONAL_DEX_METAGROSS] = SPECIES_METAGROSS,
+#endif
+#if (P_FAMILY_REGIROCK)
+    [NATIONAL_DEX_REGIROCK] = SPECIES_REGIROCK,
+#endif
+#if (P_FAMILY_REGICE)
+    [NATIONAL_DEX_REGICE] = SPECIES_REGICE,
+#endif
+#if (P_FAMILY_REGISTEEL)
+    [NATIONAL_DEX_REGISTEEL] = SPECIES_REGISTEEL,
+#endif
+#if (P_FAMILY_LATIAS)
+    [NATIONAL_DEX_LATIAS] = SPECIES_LATIAS,
+#endif
+#if (P_FAMILY_LATIOS)
+    [NATIONAL_DEX_LATIOS] = SPECIES_LATIOS,
+#endif
+#if (P_FAMILY_KYOGRE)
+    [NATIONAL_DEX_KYOGRE] = SPECIES_KYOGRE,
+#endif
+#if (P_FAMILY_GROUDON)
+    [NATIONAL_DEX_GROUDON] = SPECIES_GROUDON,
+#endif
+#if (P_FAMILY_RAYQUAZA)
+    [NATIONAL_DEX_RAYQUAZA] = SPECIES_RAYQUAZA,
+#endif
+#if (P_FAMILY_JIRACHI)
+    [NATIONAL_DEX_JIRACHI] = SPECIES_JIRACHI,
+#endif
+#if (P_FAMILY_DEOXYS)
+    [NATIONAL_DEX_DEOXYS] = SPECIES_DEOXYS_NORMAL,
+#endif
+#if (P_FAMILY_TURTWIG)
+    [NATIONAL_DEX_TURTWIG] = SPECIES_TURTWIG,
+#endif
+#if (P_FAMILY_TURTWIG)
+    [NATIONAL_DEX_GROTLE] = SPECIES_GROTLE,
+#endif
+#if (P_FAMILY_TURTWIG)
+    [NATIONAL_DEX_TORTERRA] = SPECIES_TORTERRA,
+#endif
+#if (P_FAMILY_CHIMCHAR)
+    [NATIONAL_DEX_CHIMCHAR] = SPECIES_CHIMCHAR,
+#endif
+#if (P_FAMILY_CHIMCHAR)
+    [NATIONAL_DEX_MONFERNO] = SPECIES_MONFERNO,
+#endif
+#if (P_FAMILY_CHIMCHAR)
+    [NATIONAL_DEX_INFERNAPE] = SPECIES_INFERNAPE,
+#endif
+#if (P_FAMILY_PIPLUP)
+    [NATIONAL_DEX_PIPLUP] = SPECIES_PIPLUP,
+#endif
+#if (P_FAMILY_PIPLUP)
+    [NATIONAL_DEX_PRINPLUP] = SPECIES_PRINPLUP,
+#endif
+#if (P_FAMILY_PIPLUP)
+    [NATIONAL_DEX_EMPOLEON] = SPECIES_EMPOLEON,
+#endif
+#if (P_FAMILY_STARLY)
+    [NATIONAL_DEX_STARLY] = SPECIES_STARLY,
+#endif
+#if (P_FAMILY_STARLY)
+    [NATIONAL_DEX_STARAVIA] = SPECIES_STARAVIA,
+#endif
+#if (P_FAMILY_STARLY)
+    [NATIONAL_DEX_STARAPTOR] = SPECIES_STARAPTOR,
+#endif
+#if (P_FAMILY_BIDOOF)
+    [NATIONAL_DEX_BIDOOF] = SPECIES_BIDOOF,
+#endif
+#if (P_FAMILY_BIDOOF)
+    [NATIONAL_DEX_BIBAREL] = SPECIES_BIBAREL,
+#endif
+#if (P_FAMILY_KRICKETOT)
+    [NATIONAL_DEX_KRICKETOT] = SPECIES_KRICKETOT,
+#endif
+#if (P_FAMILY_KRICKETOT)
+    [NATIONAL_DEX_KRICKETUNE] = SPECIES_KRICKETUNE,
+#endif
+#if (P_FAMILY_SHINX)
+    [NATIONAL_DEX_SHINX] = SPECIES_SHINX,
+#endif
+#if (P_FAMILY_SHINX)
+    [NATIONAL_DEX_LUXIO] = SPECIES_LUXIO,
+#endif
+#if (P_FAMILY_SHINX)
+    [NATIONAL_DEX_LUXRAY] = SPECIES_LUXRAY,
+#endif
+#if (P_FAMILY_ROSELIA) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_BUDEW] = SPECIES_BUDEW,
+#endif
+#if (P_FAMILY_ROSELIA) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ROSERADE] = SPECIES_ROSERADE,
+#endif
+#if (P_FAMILY_CRANIDOS)
+    [NATIONAL_DEX_CRANIDOS] = SPECIES_CRANIDOS,
+#endif
+#if (P_FAMILY_CRANIDOS)
+    [NATIONAL_DEX_RAMPARDOS] = SPECIES_RAMPARDOS,
+#endif
+#if (P_FAMILY_SHIELDON)
+    [NATIONAL_DEX_SHIELDON] = SPECIES_SHIELDON,
+#endif
+#if (P_FAMILY_SHIELDON)
+    [NATIONAL_DEX_BASTIODON] = SPECIES_BASTIODON,
+#endif
+#if (P_FAMILY_BURMY)
+    [NATIONAL_DEX_BURMY] = SPECIES_BURMY_PLANT,
+#endif
+#if (P_FAMILY_BURMY)
+    [NATIONAL_DEX_WORMADAM] = SPECIES_WORMADAM_PLANT,
+#endif
+#if (P_FAMILY_BURMY)
+    [NATIONAL_DEX_MOTHIM] = SPECIES_MOTHIM_PLANT,
+#endif
+#if (P_FAMILY_COMBEE)
+    [NATIONAL_DEX_COMBEE] = SPECIES_COMBEE,
+#endif
+#if (P_FAMILY_COMBEE)
+    [NATIONAL_DEX_VESPIQUEN] = SPECIES_VESPIQUEN,
+#endif
+#if (P_FAMILY_PACHIRISU)
+    [NATIONAL_DEX_PACHIRISU] = SPECIES_PACHIRISU,
+#endif
+#if (P_FAMILY_BUIZEL)
+    [NATIONAL_DEX_BUIZEL] = SPECIES_BUIZEL,
+#endif
+#if (P_FAMILY_BUIZEL)
+    [NATIONAL_DEX_FLOATZEL] = SPECIES_FLOATZEL,
+#endif
+#if (P_FAMILY_CHERUBI)
+    [NATIONAL_DEX_CHERUBI] = SPECIES_CHERUBI,
+#endif
+#if (P_FAMILY_CHERUBI)
+    [NATIONAL_DEX_CHERRIM] = SPECIES_CHERRIM_OVERCAST,
+#endif
+#if (P_FAMILY_SHELLOS)
+    [NATIONAL_DEX_SHELLOS] = SPECIES_SHELLOS_WEST,
+#endif
+#if (P_FAMILY_SHELLOS)
+    [NATIONAL_DEX_GASTRODON] = SPECIES_GASTRODON_WEST,
+#endif
+#if (P_FAMILY_AIPOM) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_AMBIPOM] = SPECIES_AMBIPOM,
+#endif
+#if (P_FAMILY_DRIFLOON)
+    [NATIONAL_DEX_DRIFLOON] = SPECIES_DRIFLOON,
+#endif
+#if (P_FAMILY_DRIFLOON)
+    [NATIONAL_DEX_DRIFBLIM] = SPECIES_DRIFBLIM,
+#endif
+#if (P_FAMILY_BUNEARY)
+    [NATIONAL_DEX_BUNEARY] = SPECIES_BUNEARY,
+#endif
+#if (P_FAMILY_BUNEARY)
+    [NATIONAL_DEX_LOPUNNY] = SPECIES_LOPUNNY,
+#endif
+#if (P_FAMILY_MISDREAVUS) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MISMAGIUS] = SPECIES_MISMAGIUS,
+#endif
+#if (P_FAMILY_MURKROW) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_HONCHKROW] = SPECIES_HONCHKROW,
+#endif
+#if (P_FAMILY_GLAMEOW)
+    [NATIONAL_DEX_GLAMEOW] = SPECIES_GLAMEOW,
+#endif
+#if (P_FAMILY_GLAMEOW)
+    [NATIONAL_DEX_PURUGLY] = SPECIES_PURUGLY,
+#endif
+#if (P_FAMILY_CHIMECHO) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_CHINGLING] = SPECIES_CHINGLING,
+#endif
+#if (P_FAMILY_STUNKY)
+    [NATIONAL_DEX_STUNKY] = SPECIES_STUNKY,
+#endif
+#if (P_FAMILY_STUNKY)
+    [NATIONAL_DEX_SKUNTANK] = SPECIES_SKUNTANK,
+#endif
+#if (P_FAMILY_BRONZOR)
+    [NATIONAL_DEX_BRONZOR] = SPECIES_BRONZOR,
+#endif
+#if (P_FAMILY_BRONZOR)
+    [NATIONAL_DEX_BRONZONG] = SPECIES_BRONZONG,
+#endif
+#if (P_FAMILY_SUDOWOODO) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_BONSLY] = SPECIES_BONSLY,
+#endif
+#if (P_FAMILY_MR_MIME) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MIME_JR] = SPECIES_MIME_JR,
+#endif
+#if (P_FAMILY_CHANSEY) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_HAPPINY] = SPECIES_HAPPINY,
+#endif
+#if (P_FAMILY_CHATOT)
+    [NATIONAL_DEX_CHATOT] = SPECIES_CHATOT,
+#endif
+#if (P_FAMILY_SPIRITOMB)
+    [NATIONAL_DEX_SPIRITOMB] = SPECIES_SPIRITOMB,
+#endif
+#if (P_FAMILY_GIBLE)
+    [NATIONAL_DEX_GIBLE] = SPECIES_GIBLE,
+#endif
+#if (P_FAMILY_GIBLE)
+    [NATIONAL_DEX_GABITE] = SPECIES_GABITE,
+#endif
+#if (P_FAMILY_GIBLE)
+    [NATIONAL_DEX_GARCHOMP] = SPECIES_GARCHOMP,
+#endif
+#if (P_FAMILY_SNORLAX) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MUNCHLAX] = SPECIES_MUNCHLAX,
+#endif
+#if (P_FAMILY_RIOLU)
+    [NATIONAL_DEX_RIOLU] = SPECIES_RIOLU,
+#endif
+#if (P_FAMILY_RIOLU)
+    [NATIONAL_DEX_LUCARIO] = SPECIES_LUCARIO,
+#endif
+#if (P_FAMILY_HIPPOPOTAS)
+    [NATIONAL_DEX_HIPPOPOTAS] = SPECIES_HIPPOPOTAS,
+#endif
+#if (P_FAMILY_HIPPOPOTAS)
+    [NATIONAL_DEX_HIPPOWDON] = SPECIES_HIPPOWDON,
+#endif
+#if (P_FAMILY_SKORUPI)
+    [NATIONAL_DEX_SKORUPI] = SPECIES_SKORUPI,
+#endif
+#if (P_FAMILY_SKORUPI)
+    [NATIONAL_DEX_DRAPION] = SPECIES_DRAPION,
+#endif
+#if (P_FAMILY_CROAGUNK)
+    [NATIONAL_DEX_CROAGUNK] = SPECIES_CROAGUNK,
+#endif
+#if (P_FAMILY_CROAGUNK)
+    [NATIONAL_DEX_TOXICROAK] = SPECIES_TOXICROAK,
+#endif
+#if (P_FAMILY_CARNIVINE)
+    [NATIONAL_DEX_CARNIVINE] = SPECIES_CARNIVINE,
+#endif
+#if (P_FAMILY_FINNEON)
+    [NATIONAL_DEX_FINNEON] = SPECIES_FINNEON,
+#endif
+#if (P_FAMILY_FINNEON)
+    [NATIONAL_DEX_LUMINEON] = SPECIES_LUMINEON,
+#endif
+#if (P_FAMILY_MANTINE) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MANTYKE] = SPECIES_MANTYKE,
+#endif
+#if (P_FAMILY_SNOVER)
+    [NATIONAL_DEX_SNOVER] = SPECIES_SNOVER,
+#endif
+#if (P_FAMILY_SNOVER)
+    [NATIONAL_DEX_ABOMASNOW] = SPECIES_ABOMASNOW,
+#endif
+#if (P_FAMILY_SNEASEL) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_WEAVILE] = SPECIES_WEAVILE,
+#endif
+#if (P_FAMILY_MAGNEMITE) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAGNEZONE] = SPECIES_MAGNEZONE,
+#endif
+#if (P_FAMILY_LICKITUNG) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_LICKILICKY] = SPECIES_LICKILICKY,
+#endif
+#if (P_FAMILY_RHYHORN) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_RHYPERIOR] = SPECIES_RHYPERIOR,
+#endif
+#if (P_FAMILY_TANGELA) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_TANGROWTH] = SPECIES_TANGROWTH,
+#endif
+#if (P_FAMILY_ELECTABUZZ) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ELECTIVIRE] = SPECIES_ELECTIVIRE,
+#endif
+#if (P_FAMILY_MAGMAR) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAGMORTAR] = SPECIES_MAGMORTAR,
+#endif
+#if (P_FAMILY_TOGEPI) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_TOGEKISS] = SPECIES_TOGEKISS,
+#endif
+#if (P_FAMILY_YANMA) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_YANMEGA] = SPECIES_YANMEGA,
+#endif
+#if (P_FAMILY_EEVEE) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_LEAFEON] = SPECIES_LEAFEON,
+#endif
+#if (P_FAMILY_EEVEE) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_GLACEON] = SPECIES_GLACEON,
+#endif
+#if (P_FAMILY_GLIGAR) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_GLISCOR] = SPECIES_GLISCOR,
+#endif
+#if (P_FAMILY_SWINUB) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAMOSWINE] = SPECIES_MAMOSWINE,
+#endif
+#if (P_FAMILY_PORYGON) && (P_GEN_2_CROSS_EVOS) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_PORYGON_Z] = SPECIES_PORYGON_Z,
+#endif
+#if (P_FAMILY_RALTS) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_GALLADE] = SPECIES_GALLADE,
+#endif
+#if (P_FAMILY_NOSEPASS) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_PROBOPASS] = SPECIES_PROBOPASS,
+#endif
+#if (P_FAMILY_DUSKULL) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_DUSKNOIR] = SPECIES_DUSKNOIR,
+#endif
+#if (P_FAMILY_SNORUNT) && (P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_FROSLASS] = SPECIES_FROSLASS,
+#endif
+#if (P_FAMILY_ROTOM)
+    [NATIONAL_DEX_ROTOM] = SPECIES_ROTOM,
+#endif
+#if (P_FAMILY_UXIE)
+    [NATIONAL_DEX_UXIE] = SPECIES_UXIE,
+#endif
+#if (P_FAMILY_MESPRIT)
+    [NATIONAL_DEX_MESPRIT] = SPECIES_MESPRIT,
+#endif
+#if (P_FAMILY_AZELF)
+    [NATIONAL_DEX_AZELF] = SPECIES_AZELF,
+#endif
+#if (P_FAMILY_DIALGA)
+    [NATIONAL_DEX_DIALGA] = SPECIES_DIALGA,
+#endif
+#if (P_FAMILY_PALKIA)
+    [NATIONAL_DEX_PALKIA] = SPECIES_PALKIA,
+#endif
+#if (P_FAMILY_HEATRAN)
+    [NATIONAL_DEX_HEATRAN] = SPECIES_HEATRAN,
+#endif
+#if (P_FAMILY_REGIGIGAS)
+    [NATIONAL_DEX_REGIGIGAS] = SPECIES_REGIGIGAS,
+#endif
+#if (P_FAMILY_GIRATINA)
+    [NATIONAL_DEX_GIRATINA] = SPECIES_GIRATINA_ALTERED,
+#endif
+#if (P_FAMILY_CRESSELIA)
+    [NATIONAL_DEX_CRESSELIA] = SPECIES_CRESSELIA,
+#endif
+#if (P_FAMILY_MANAPHY)
+    [NATIONAL_DEX_PHIONE] = SPECIES_PHIONE,
+#endif
+#if (P_FAMILY_MANAPHY)
+    [NATIONAL_DEX_MANAPHY] = SPECIES_MANAPHY,
+#endif
+#if (P_FAMILY_DARKRAI)
+    [NATIONAL_DEX_DARKRAI] = SPECIES_DARKRAI,
+#endif
+#if (P_FAMILY_SHAYMIN)
+    [NATIONAL_DEX_SHAYMIN] = SPECIES_SHAYMIN_LAND,
+#endif
+#if (P_FAMILY_ARCEUS)
+    [NATIONAL_DEX_ARCEUS] = SPECIES_ARCEUS_NORMAL,
+#endif
+#if (P_FAMILY_VICTINI)
+    [NATIONAL_DEX_VICTINI] = SPECIES_VICTINI,
+#endif
+#if (P_FAMILY_SNIVY)
+    [NATIONAL_DEX_SNIVY] = SPECIES_SNIVY,
+#endif
+#if (P_FAMILY_SNIVY)
+    [NATIONAL_DEX_SERVINE] = SPECIES_SERVINE,
+#endif
+#if (P_FAMILY_SNIVY)
+    [NATIONAL_DEX_SERPERIOR] = SPECIES_SERPERIOR,
+#endif
+#if (P_FAMILY_TEPIG)
+    [NATIONAL_DEX_TEPIG] = SPECIES_TEPIG,
+#endif
+#if (P_FAMILY_TEPIG)
+    [NATIONAL_DEX_PIGNITE] = SPECIES_PIGNITE,
+#endif
+#if (P_FAMILY_TEPIG)
+    [NATIONAL_DEX_EMBOAR] = SPECIES_EMBOAR,
+#endif
+#if (P_FAMILY_OSHAWOTT)
+    [NATIONAL_DEX_OSHAWOTT] = SPECIES_OSHAWOTT,
+#endif
+#if (P_FAMILY_OSHAWOTT)
+    [NATIONAL_DEX_DEWOTT] = SPECIES_DEWOTT,
+#endif
+#if (P_FAMILY_OSHAWOTT)
+    [NATIONAL_DEX_SAMUROTT] = SPECIES_SAMUROTT,
+#endif
+#if (P_FAMILY_PATRAT)
+    [NATIONAL_DEX_PATRAT] = SPECIES_PATRAT,
+#endif
+#if (P_FAMILY_PATRAT)
+    [NATIONAL_DEX_WATCHOG] = SPECIES_WATCHOG,
+#endif
+#if (P_FAMILY_LILLIPUP)
+    [NATIONAL_DEX_LILLIPUP] = SPECIES_LILLIPUP,
+#endif
+#if (P_FAMILY_LILLIPUP)
+    [NATIONAL_DEX_HERDIER] = SPECIES_HERDIER,
+#endif
+#if (P_FAMILY_LILLIPUP)
+    [NATIONAL_DEX_STOUTLAND] = SPECIES_STOUTLAND,
+#endif
+#if (P_FAMILY_PURRLOIN)
+    [NATIONAL_DEX_PURRLOIN] = SPECIES_PURRLOIN,
+#endif
+#if (P_FAMILY_PURRLOIN)
+    [NATIONAL_DEX_LIEPARD] = SPECIES_LIEPARD,
+#endif
+#if (P_FAMILY_PANSAGE)
+    [NATIONAL_DEX_PANSAGE] = SPECIES_PANSAGE,
+#endif
+#if (P_FAMILY_PANSAGE)
+    [NATIONAL_DEX_SIMISAGE] = SPECIES_SIMISAGE,
+#endif
+#if (P_FAMILY_PANSEAR)
+    [NATIONAL_DEX_PANSEAR] = SPECIES_PANSEAR,
+#endif
+#if (P_FAMILY_PANSEAR)
+    [NATIONAL_DEX_SIMISEAR] = SPECIES_SIMISEAR,
+#endif
+#if (P_FAMILY_PANPOUR)
+    [NATIONAL_DEX_PANPOUR] = SPECIES_PANPOUR,
+#endif
+#if (P_FAMILY_PANPOUR)
+    [NATIONAL_DEX_SIMIPOUR] = SPECIES_SIMIPOUR,
+#endif
+#if (P_FAMILY_MUNNA)
+    [NATIONAL_DEX_MUNNA] = SPECIES_MUNNA,
+#endif
+#if (P_FAMILY_MUNNA)
+    [NATIONAL_DEX_MUSHARNA] = SPECIES_MUSHARNA,
+#endif
+#if (P_FAMILY_PIDOVE)
+    [NATIONAL_DEX_PIDOVE] = SPECIES_PIDOVE,
+#endif
+#if (P_FAMILY_PIDOVE)
+    [NATIONAL_DEX_TRANQUILL] = SPECIES_TRANQUILL,
+#endif
+#if (P_FAMILY_PIDOVE)
+    [NATIONAL_DEX_UNFEZANT] = SPECIES_UNFEZANT,
+#endif
+#if (P_FAMILY_BLITZLE)
+    [NATIONAL_DEX_BLITZLE] = SPECIES_BLITZLE,
+#endif
+#if (P_FAMILY_BLITZLE)
+    [NATIONAL_DEX_ZEBSTRIKA] = SPECIES_ZEBSTRIKA,
+#endif
+#if (P_FAMILY_ROGGENROLA)
+    [NATIONAL_DEX_ROGGENROLA] = SPECIES_ROGGENROLA,
+#endif
+#if (P_FAMILY_ROGGENROLA)
+    [NATIONAL_DEX_BOLDORE] = SPECIES_BOLDORE,
+#endif
+#if (P_FAMILY_ROGGENROLA)
+    [NATIONAL_DEX_GIGALITH] = SPECIES_GIGALITH,
+#endif
+#if (P_FAMILY_WOOBAT)
+    [NATIONAL_DEX_WOOBAT] = SPECIES_WOOBAT,
+#endif
+#if (P_FAMILY_WOOBAT)
+    [NATIONAL_DEX_SWOOBAT] = SPECIES_SWOOBAT,
+#endif
+#if (P_FAMILY_DRILBUR)
+    [NATIONAL_DEX_DRILBUR] = SPECIES_DRILBUR,
+#endif
+#if (P_FAMILY_DRILBUR)
+    [NATIONAL_DEX_EXCADRILL] = SPECIES_EXCADRILL,
+#endif
+#if (P_FAMILY_AUDINO)
+    [NATIONAL_DEX_AUDINO] = SPECIES_AUDINO,
+#endif
+#if (P_FAMILY_TIMBURR)
+    [NATIONAL_DEX_TIMBURR] = SPECIES_TIMBURR,
+#endif
+#if (P_FAMILY_TIMBURR)
+    [NATIONAL_DEX_GURDURR] = SPECIES_GURDURR,
+#endif
+#if (P_FAMILY_TIMBURR)
+    [NATIONAL_DEX_CONKELDURR] = SPECIES_CONKELDURR,
+#endif
+#if (P_FAMILY_TYMPOLE)
+    [NATIONAL_DEX_TYMPOLE] = SPECIES_TYMPOLE,
+#endif
+#if (P_FAMILY_TYMPOLE)
+    [NATIONAL_DEX_PALPITOAD] = SPECIES_PALPITOAD,
+#endif
+#if (P_FAMILY_TYMPOLE)
+    [NATIONAL_DEX_SEISMITOAD] = SPECIES_SEISMITOAD,
+#endif
+#if (P_FAMILY_THROH)
+    [NATIONAL_DEX_THROH] = SPECIES_THROH,
+#endif
+#if (P_FAMILY_SAWK)
+    [NATIONAL_DEX_SAWK] = SPECIES_SAWK,
+#endif
+#if (P_FAMILY_SEWADDLE)
+    [NATIONAL_DEX_SEWADDLE] = SPECIES_SEWADDLE,
+#endif
+#if (P_FAMILY_SEWADDLE)
+    [NATIONAL_DEX_SWADLOON] = SPECIES_SWADLOON,
+#endif
+#if (P_FAMILY_SEWADDLE)
+    [NATIONAL_DEX_LEAVANNY] = SPECIES_LEAVANNY,
+#endif
+#if (P_FAMILY_VENIPEDE)
+    [NATIONAL_DEX_VENIPEDE] = SPECIES_VENIPEDE,
+#endif
+#if (P_FAMILY_VENIPEDE)
+    [NATIONAL_DEX_WHIRLIPEDE] = SPECIES_WHIRLIPEDE,
+#endif
+#if (P_FAMILY_VENIPEDE)
+    [NATIONAL_DEX_SCOLIPEDE] = SPECIES_SCOLIPEDE,
+#endif
+#if (P_FAMILY_COTTONEE)
+    [NATIONAL_DEX_COTTONEE] = SPECIES_COTTONEE,
+#endif
+#if (P_FAMILY_COTTONEE)
+    [NATIONAL_DEX_WHIMSICOTT] = SPECIES_WHIMSICOTT,
+#endif
+#if (P_FAMILY_PETILIL)
+    [NATIONAL_DEX_PETILIL] = SPECIES_PETILIL,
+#endif
+#if (P_FAMILY_PETILIL)
+    [NATIONAL_DEX_LILLIGANT] = SPECIES_LILLIGANT,
+#endif
+#if (P_FAMILY_BASCULIN)
+    [NATIONAL_DEX_BASCULIN] = SPECIES_BASCULIN_RED_STRIPED,
+#endif
+#if (P_FAMILY_SANDILE)
+    [NATIONAL_DEX_SANDILE] = SPECIES_SANDILE,
+#endif
+#if (P_FAMILY_SANDILE)
+    [NATIONAL_DEX_KROKOROK] = SPECIES_KROKOROK,
+#endif
+#if (P_FAMILY_SANDILE)
+    [NATIONAL_DEX_KROOKODILE] = SPECIES_KROOKODILE,
+#endif
+#if (P_FAMILY_DARUMAKA)
+    [NATIONAL_DEX_DARUMAKA] = SPECIES_DARUMAKA,
+#endif
+#if (P_FAMILY_DARUMAKA)
+    [NATIONAL_DEX_DARMANITAN] = SPECIES_DARMANITAN_STANDARD,
+#endif
+#if (P_FAMILY_MARACTUS)
+    [NATIONAL_DEX_MARACTUS] = SPECIES_MARACTUS,
+#endif
+#if (P_FAMILY_DWEBBLE)
+    [NATIONAL_DEX_DWEBBLE] = SPECIES_DWEBBLE,
+#endif
+#if (P_FAMILY_DWEBBLE)
+    [NATIONAL_DEX_CRUSTLE] = SPECIES_CRUSTLE,
+#endif
+#if (P_FAMILY_SCRAGGY)
+    [NATIONAL_DEX_SCRAGGY] = SPECIES_SCRAGGY,
+#endif
+#if (P_FAMILY_SCRAGGY)
+    [NATIONAL_DEX_SCRAFTY] = SPECIES_SCRAFTY,
+#endif
+#if (P_FAMILY_SIGILYPH)
+    [NATIONAL_DEX_SIGILYPH] = SPECIES_SIGILYPH,
+#endif
+#if (P_FAMILY_YAMASK)
+    [NATIONAL_DEX_YAMASK] = SPECIES_YAMASK,
+#endif
+#if (P_FAMILY_YAMASK)
+    [NATIONAL_DEX_COFAGRIGUS] = SPECIES_COFAGRIGUS,
+#endif
+#if (P_FAMILY_TIRTOUGA)
+    [NATIONAL_DEX_TIRTOUGA] = SPECIES_TIRTOUGA,
+#endif
+#if (P_FAMILY_TIRTOUGA)
+    [NATIONAL_DEX_CARRACOSTA] = SPECIES_CARRACOSTA,
+#endif
+#if (P_FAMILY_ARCHEN)
+    [NATIONAL_DEX_ARCHEN] = SPECIES_ARCHEN,
+#endif
+#if (P_FAMILY_ARCHEN)
+    [NATIONAL_DEX_ARCHEOPS] = SPECIES_ARCHEOPS,
+#endif
+#if (P_FAMILY_TRUBBISH)
+    [NATIONAL_DEX_TRUBBISH] = SPECIES_TRUBBISH,
+#endif
+#if (P_FAMILY_TRUBBISH)
+    [NATIONAL_DEX_GARBODOR] = SPECIES_GARBODOR,
+#endif
+#if (P_FAMILY_ZORUA)
+    [NATIONAL_DEX_ZORUA] = SPECIES_ZORUA,
+#endif
+#if (P_FAMILY_ZORUA)
+    [NATIONAL_DEX_ZOROARK] = SPECIES_ZOROARK,
+#endif
+#if (P_FAMILY_MINCCINO)
+    [NATIONAL_DEX_MINCCINO] = SPECIES_MINCCINO,
+#endif
+#if (P_FAMILY_MINCCINO)
+    [NATIONAL_DEX_CINCCINO] = SPECIES_CINCCINO,
+#endif
+#if (P_FAMILY_GOTHITA)
+    [NATIONAL_DEX_GOTHITA] = SPECIES_GOTHITA,
+#endif
+#if (P_FAMILY_GOTHITA)
+    [NATIONAL_DEX_GOTHORITA] = SPECIES_GOTHORITA,
+#endif
+#if (P_FAMILY_GOTHITA)
+    [NATIONAL_DEX_GOTHITELLE] = SPECIES_GOTHITELLE,
+#endif
+#if (P_FAMILY_SOLOSIS)
+    [NATIONAL_DEX_SOLOSIS] = SPECIES_SOLOSIS,
+#endif
+#if (P_FAMILY_SOLOSIS)
+    [NATIONAL_DEX_DUOSION] = SPECIES_DUOSION,
+#endif
+#if (P_FAMILY_SOLOSIS)
+    [NATIONAL_DEX_REUNICLUS] = SPECIES_REUNICLUS,
+#endif
+#if (P_FAMILY_DUCKLETT)
+    [NATIONAL_DEX_DUCKLETT] = SPECIES_DUCKLETT,
+#endif
+#if (P_FAMILY_DUCKLETT)
+    [NATIONAL_DEX_SWANNA] = SPECIES_SWANNA,
+#endif
+#if (P_FAMILY_VANILLITE)
+    [NATIONAL_DEX_VANILLITE] = SPECIES_VANILLITE,
+#endif
+#if (P_FAMILY_VANILLITE)
+    [NATIONAL_DEX_VANILLISH] = SPECIES_VANILLISH,
+#endif
+#if (P_FAMILY_VANILLITE)
+    [NATIONAL_DEX_VANILLUXE] = SPECIES_VANILLUXE,
+#endif
+#if (P_FAMILY_DEERLING)
+    [NATIONAL_DEX_DEERLING] = SPECIES_DEERLING_SPRING,
+#endif
+#if (P_FAMILY_DEERLING)
+    [NATIONAL_DEX_SAWSBUCK] = SPECIES_SAWSBUCK_SPRING,
+#endif
+#if (P_FAMILY_EMOLGA)
+    [NATIONAL_DEX_EMOLGA] = SPECIES_EMOLGA,
+#endif
+#if (P_FAMILY_KARRABLAST)
+    [NATIONAL_DEX_KARRABLAST] = SPECIES_KARRABLAST,
+#endif
+#if (P_FAMILY_KARRABLAST)
+    [NATIONAL_DEX_ESCAVALIER] = SPECIES_ESCAVALIER,
+#endif
+#if (P_FAMILY_FOONGUS)
+    [NATIONAL_DEX_FOONGUS] = SPECIES_FOONGUS,
+#endif
+#if (P_FAMILY_FOONGUS)
+    [NATIONAL_DEX_AMOONGUSS] = SPECIES_AMOONGUSS,
+#endif
+#if (P_FAMILY_FRILLISH)
+    [NATIONAL_DEX_FRILLISH] = SPECIES_FRILLISH,
+#endif
+#if (P_FAMILY_FRILLISH)
+    [NATIONAL_DEX_JELLICENT] = SPECIES_JELLICENT,
+#endif
+#if (P_FAMILY_ALOMOMOLA)
+    [NATIONAL_DEX_ALOMOMOLA] = SPECIES_ALOMOMOLA,
+#endif
+#if (P_FAMILY_JOLTIK)
+    [NATIONAL_DEX_JOLTIK] = SPECIES_JOLTIK,
+#endif
+#if (P_FAMILY_JOLTIK)
+    [NATIONAL_DEX_GALVANTULA] = SPECIES_GALVANTULA,
+#endif
+#if (P_FAMILY_FERROSEED)
+    [NATIONAL_DEX_FERROSEED] = SPECIES_FERROSEED,
+#endif
+#if (P_FAMILY_FERROSEED)
+    [NATIONAL_DEX_FERROTHORN] = SPECIES_FERROTHORN,
+#endif
+#if (P_FAMILY_KLINK)
+    [NATIONAL_DEX_KLINK] = SPECIES_KLINK,
+#endif
+#if (P_FAMILY_KLINK)
+    [NATIONAL_DEX_KLANG] = SPECIES_KLANG,
+#endif
+#if (P_FAMILY_KLINK)
+    [NATIONAL_DEX_KLINKLANG] = SPECIES_KLINKLANG,
+#endif
+#if (P_FAMILY_TYNAMO)
+    [NATIONAL_DEX_TYNAMO] = SPECIES_TYNAMO,
+#endif
+#if (P_FAMILY_TYNAMO)
+    [NATIONAL_DEX_EELEKTRIK] = SPECIES_EELEKTRIK,
+#endif
+#if (P_FAMILY_TYNAMO)
+    [NATIONAL_DEX_EELEKTROSS] = SPECIES_EELEKTROSS,
+#endif
+#if (P_FAMILY_ELGYEM)
+    [NATIONAL_DEX_ELGYEM] = SPECIES_ELGYEM,
+#endif
+#if (P_FAMILY_ELGYEM)
+    [NATIONAL_DEX_BEHEEYEM] = SPECIES_BEHEEYEM,
+#endif
+#if (P_FAMILY_LITWICK)
+    [NATIONAL_DEX_LITWICK] = SPECIES_LITWICK,
+#endif
+#if (P_FAMILY_LITWICK)
+    [NATIONAL_DEX_LAMPENT] = SPECIES_LAMPENT,
+#endif
+#if (P_FAMILY_LITWICK)
+    [NATIONAL_DEX_CHANDELURE] = SPECIES_CHANDELURE,
+#endif
+#if (P_FAMILY_AXEW)
+    [NATIONAL_DEX_AXEW] = SPECIES_AXEW,
+#endif
+#if (P_FAMILY_AXEW)
+    [NATIONAL_DEX_FRAXURE] = SPECIES_FRAXURE,
+#endif
+#if (P_FAMILY_AXEW)
+    [NATIONAL_DEX_HAXORUS] = SPECIES_HAXORUS,
+#endif
+#if (P_FAMILY_CUBCHOO)
+    [NATIONAL_DEX_CUBCHOO] = SPECIES_CUBCHOO,
+#endif
+#if (P_FAMILY_CUBCHOO)
+    [NATIONAL_DEX_BEARTIC] = SPECIES_BEARTIC,
+#endif
+#if (P_FAMILY_CRYOGONAL)
+    [NATIONAL_DEX_CRYOGONAL] = SPECIES_CRYOGONAL,
+#endif
+#if (P_FAMILY_SHELMET)
+    [NATIONAL_DEX_SHELMET] = SPECIES_SHELMET,
+#endif
+#if (P_FAMILY_SHELMET)
+    [NATIONAL_DEX_ACCELGOR] = SPECIES_ACCELGOR,
+#endif
+#if (P_FAMILY_STUNFISK)
+    [NATIONAL_DEX_STUNFISK] = SPECIES_STUNFISK,
+#endif
+#if (P_FAMILY_MIENFOO)
+    [NATIONAL_DEX_MIENFOO] = SPECIES_MIENFOO,
+#endif
+#if (P_FAMILY_MIENFOO)
+    [NATIONAL_DEX_MIENSHAO] = SPECIES_MIENSHAO,
+#endif
+#if (P_FAMILY_DRUDDIGON)
+    [NATIONAL_DEX_DRUDDIGON] = SPECIES_DRUDDIGON,
+#endif
+#if (P_FAMILY_GOLETT)
+    [NATIONAL_DEX_GOLETT] = SPECIES_GOLETT,
+#endif
+#if (P_FAMILY_GOLETT)
+    [NATIONAL_DEX_GOLURK] = SPECIES_GOLURK,
+#endif
+#if (P_FAMILY_PAWNIARD)
+    [NATIONAL_DEX_PAWNIARD] = SPECIES_PAWNIARD,
+#endif
+#if (P_FAMILY_PAWNIARD)
+    [NATIONAL_DEX_BISHARP] = SPECIES_BISHARP,
+#endif
+#if (P_FAMILY_BOUFFALANT)
+    [NATIONAL_DEX_BOUFFALANT] = SPECIES_BOUFFALANT,
+#endif
+#if (P_FAMILY_RUFFLET)
+    [NATIONAL_DEX_RUFFLET] = SPECIES_RUFFLET,
+#endif
+#if (P_FAMILY_RUFFLET)
+    [NATIONAL_DEX_BRAVIARY] = SPECIES_BRAVIARY,
+#endif
+#if (P_FAMILY_VULLABY)
+    [NATIONAL_DEX_VULLABY] = SPECIES_VULLABY,
+#endif
+#if (P_FAMILY_VULLABY)
+    [NATIONAL_DEX_MANDIBUZZ] = SPECIES_MANDIBUZZ,
+#endif
+#if (P_FAMILY_HEATMOR)
+    [NATIONAL_DEX_HEATMOR] = SPECIES_HEATMOR,
+#endif
+#if (P_FAMILY_DURANT)
+    [NATIONAL_DEX_DURANT] = SPECIES_DURANT,
+#endif
+#if (P_FAMILY_DEINO)
+    [NATIONAL_DEX_DEINO] = SPECIES_DEINO,
+#endif
+#if (P_FAMILY_DEINO)
+    [NATIONAL_DEX_ZWEILOUS] = SPECIES_ZWEILOUS,
+#endif
+#if (P_FAMILY_DEINO)
+    [NATIONAL_DEX_HYDREIGON] = SPECIES_HYDREIGON,
+#endif
+#if (P_FAMILY_LARVESTA)
+    [NATIONAL_DEX_LARVESTA] = SPECIES_LARVESTA,
+#endif
+#if (P_FAMILY_LARVESTA)
+    [NATIONAL_DEX_VOLCARONA] = SPECIES_VOLCARONA,
+#endif
+#if (P_FAMILY_COBALION)
+    [NATIONAL_DEX_COBALION] = SPECIES_COBALION,
+#endif
+#if (P_FAMILY_TERRAKION)
+    [NATIONAL_DEX_TERRAKION] = SPECIES_TERRAKION,
+#endif
+#if (P_FAMILY_VIRIZION)
+    [NATIONAL_DEX_VIRIZION] = SPECIES_VIRIZION,
+#endif
+#if (P_FAMILY_TORNADUS)
+    [NATIONAL_DEX_TORNADUS] = SPECIES_TORNADUS_INCARNATE,
+#endif
+#if (P_FAMILY_THUNDURUS)
+    [NATIONAL_DEX_THUNDURUS] = SPECIES_THUNDURUS_INCARNATE,
+#endif
+#if (P_FAMILY_RESHIRAM)
+    [NATIONAL_DEX_RESHIRAM] = SPECIES_RESHIRAM,
+#endif
+#if (P_FAMILY_ZEKROM)
+    [NATIONAL_DEX_ZEKROM] = SPECIES_ZEKROM,
+#endif
+#if (P_FAMILY_LANDORUS)
+    [NATIONAL_DEX_LANDORUS] = SPECIES_LANDORUS_INCARNATE,
+#endif
+#if (P_FAMILY_KYUREM)
+    [NATIONAL_DEX_KYUREM] = SPECIES_KYUREM,
+#endif
+#if (P_FAMILY_KELDEO)
+    [NATIONAL_DEX_KELDEO] = SPECIES_KELDEO_ORDINARY,
+#endif
+#if (P_FAMILY_MELOETTA)
+    [NATIONAL_DEX_MELOETTA] = SPECIES_MELOETTA_ARIA,
+#endif
+#if (P_FAMILY_GENESECT)
+    [NATIONAL_DEX_GENESECT] = SPECIES_GENESECT,
+#endif
+#if (P_FAMILY_CHESPIN)
+    [NATIONAL_DEX_CHESPIN] = SPECIES_CHESPIN,
+#endif
+#if (P_FAMILY_CHESPIN)
+    [NATIONAL_DEX_QUILLADIN] = SPECIES_QUILLADIN,
+#endif
+#if (P_FAMILY_CHESPIN)
+    [NATIONAL_DEX_CHESNAUGHT] = SPECIES_CHESNAUGHT,
+#endif
+#if (P_FAMILY_FENNEKIN)
+    [NATIONAL_DEX_FENNEKIN] = SPECIES_FENNEKIN,
+#endif
+#if (P_FAMILY_FENNEKIN)
+    [NATIONAL_DEX_BRAIXEN] = SPECIES_BRAIXEN,
+#endif
+#if (P_FAMILY_FENNEKIN)
+    [NATIONAL_DEX_DELPHOX] = SPECIES_DELPHOX,
+#endif
+#if (P_FAMILY_FROAKIE)
+    [NATIONAL_DEX_FROAKIE] = SPECIES_FROAKIE,
+#endif
+#if (P_FAMILY_FROAKIE)
+    [NATIONAL_DEX_FROGADIER] = SPECIES_FROGADIER,
+#endif
+#if (P_FAMILY_FROAKIE)
+    [NATIONAL_DEX_GRENINJA] = SPECIES_GRENINJA,
+#endif
+#if (P_FAMILY_BUNNELBY)
+    [NATIONAL_DEX_BUNNELBY] = SPECIES_BUNNELBY,
+#endif
+#if (P_FAMILY_BUNNELBY)
+    [NATIONAL_DEX_DIGGERSBY] = SPECIES_DIGGERSBY,
+#endif
+#if (P_FAMILY_FLETCHLING)
+    [NATIONAL_DEX_FLETCHLING] = SPECIES_FLETCHLING,
+#endif
+#if (P_FAMILY_FLETCHLING)
+    [NATIONAL_DEX_FLETCHINDER] = SPECIES_FLETCHINDER,
+#endif
+#if (P_FAMILY_FLETCHLING)
+    [NATIONAL_DEX_TALONFLAME] = SPECIES_TALONFLAME,
+#endif
+#if (P_FAMILY_SCATTERBUG)
+    [NATIONAL_DEX_SCATTERBUG] = SPECIES_SCATTERBUG_ICY_SNOW,
+#endif
+#if (P_FAMILY_SCATTERBUG)
+    [NATIONAL_DEX_SPEWPA] = SPECIES_SPEWPA_ICY_SNOW,
+#endif
+#if (P_FAMILY_SCATTERBUG)
+    [NATIONAL_DEX_VIVILLON] = SPECIES_VIVILLON_ICY_SNOW,
+#endif
+#if (P_FAMILY_LITLEO)
+    [NATIONAL_DEX_LITLEO] = SPECIES_LITLEO,
+#endif
+#if (P_FAMILY_LITLEO)
+    [NATIONAL_DEX_PYROAR] = SPECIES_PYROAR,
+#endif
+#if (P_FAMILY_FLABEBE)
+    [NATIONAL_DEX_FLABEBE] = SPECIES_FLABEBE_RED,
+#endif
+#if (P_FAMILY_FLABEBE)
+    [NATIONAL_DEX_FLOETTE] = SPECIES_FLOETTE_RED,
+#endif
+#if (P_FAMILY_FLABEBE)
+    [NATIONAL_DEX_FLORGES] = SPECIES_FLORGES_RED,
+#endif
+#if (P_FAMILY_SKIDDO)
+    [NATIONAL_DEX_SKIDDO] = SPECIES_SKIDDO,
+#endif
+#if (P_FAMILY_SKIDDO)
+    [NATIONAL_DEX_GOGOAT] = SPECIES_GOGOAT,
+#endif
+#if (P_FAMILY_PANCHAM)
+    [NATIONAL_DEX_PANCHAM] = SPECIES_PANCHAM,
+#endif
+#if (P_FAMILY_PANCHAM)
+    [NATIONAL_DEX_PANGORO] = SPECIES_PANGORO,
+#endif
+#if (P_FAMILY_FURFROU)
+    [NATIONAL_DEX_FURFROU] = SPECIES_FURFROU_NATURAL,
+#endif
+#if (P_FAMILY_ESPURR)
+    [NATIONAL_DEX_ESPURR] = SPECIES_ESPURR,
+#endif
+#if (P_FAMILY_ESPURR)
+    [NATIONAL_DEX_MEOWSTIC] = SPECIES_MEOWSTIC_M,
+#endif
+#if (P_FAMILY_HONEDGE)
+    [NATIONAL_DEX_HONEDGE] = SPECIES_HONEDGE,
+#endif
+#if (P_FAMILY_HONEDGE)
+    [NATIONAL_DEX_DOUBLADE] = SPECIES_DOUBLADE,
+#endif
+#if (P_FAMILY_HONEDGE)
+    [NATIONAL_DEX_AEGISLASH] = SPECIES_AEGISLASH_SHIELD,
+#endif
+#if (P_FAMILY_SPRITZEE)
+    [NATIONAL_DEX_SPRITZEE] = SPECIES_SPRITZEE,
+#endif
+#if (P_FAMILY_SPRITZEE)
+    [NATIONAL_DEX_AROMATISSE] = SPECIES_AROMATISSE,
+#endif
+#if (P_FAMILY_SWIRLIX)
+    [NATIONAL_DEX_SWIRLIX] = SPECIES_SWIRLIX,
+#endif
+#if (P_FAMILY_SWIRLIX)
+    [NATIONAL_DEX_SLURPUFF] = SPECIES_SLURPUFF,
+#endif
+#if (P_FAMILY_INKAY)
+    [NATIONAL_DEX_INKAY] = SPECIES_INKAY,
+#endif
+#if (P_FAMILY_INKAY)
+    [NATIONAL_DEX_MALAMAR] = SPECIES_MALAMAR,
+#endif
+#if (P_FAMILY_BINACLE)
+    [NATIONAL_DEX_BINACLE] = SPECIES_BINACLE,
+#endif
+#if (P_FAMILY_BINACLE)
+    [NATIONAL_DEX_BARBARACLE] = SPECIES_BARBARACLE,
+#endif
+#if (P_FAMILY_SKRELP)
+    [NATIONAL_DEX_SKRELP] = SPECIES_SKRELP,
+#endif
+#if (P_FAMILY_SKRELP)
+    [NATIONAL_DEX_DRAGALGE] = SPECIES_DRAGALGE,
+#endif
+#if (P_FAMILY_CLAUNCHER)
+    [NATIONAL_DEX_CLAUNCHER] = SPECIES_CLAUNCHER,
+#endif
+#if (P_FAMILY_CLAUNCHER)
+    [NATIONAL_DEX_CLAWITZER] = SPECIES_CLAWITZER,
+#endif
+#if (P_FAMILY_HELIOPTILE)
+    [NATIONAL_DEX_HELIOPTILE] = SPECIES_HELIOPTILE,
+#endif
+#if (P_FAMILY_HELIOPTILE)
+    [NATIONAL_DEX_HELIOLISK] = SPECIES_HELIOLISK,
+#endif
+#if (P_FAMILY_TYRUNT)
+    [NATIONAL_DEX_TYRUNT] = SPECIES_TYRUNT,
+#endif
+#if (P_FAMILY_TYRUNT)
+    [NATIONAL_DEX_TYRANTRUM] = SPECIES_TYRANTRUM,
+#endif
+#if (P_FAMILY_AMAURA)
+    [NATIONAL_DEX_AMAURA] = SPECIES_AMAURA,
+#endif
+#if (P_FAMILY_AMAURA)
+    [NATIONAL_DEX_AURORUS] = SPECIES_AURORUS,
+#endif
+#if (P_FAMILY_EEVEE) && (P_GEN_6_CROSS_EVOS)
+    [NATIONAL_DEX_SYLVEON] = SPECIES_SYLVEON,
+#endif
+#if (P_FAMILY_HAWLUCHA)
+    [NATIONAL_DEX_HAWLUCHA] = SPECIES_HAWLUCHA,
+#endif
+#if (P_FAMILY_DEDENNE)
+    [NATIONAL_DEX_DEDENNE] = SPECIES_DEDENNE,
+#endif
+#if (P_FAMILY_CARBINK)
+    [NATIONAL_DEX_CARBINK] = SPECIES_CARBINK,
+#endif
+#if (P_FAMILY_GOOMY)
+    [NATIONAL_DEX_GOOMY] = SPECIES_GOOMY,
+#endif
+#if (P_FAMILY_GOOMY)
+    [NATIONAL_DEX_SLIGGOO] = SPECIES_SLIGGOO,
+#endif
+#if (P_FAMILY_GOOMY)
+    [NATIONAL_DEX_GOODRA] = SPECIES_GOODRA,
+#endif
+#if (P_FAMILY_KLEFKI)
+    [NATIONAL_DEX_KLEFKI] = SPECIES_KLEFKI,
+#endif
+#if (P_FAMILY_PHANTUMP)
+    [NATIONAL_DEX_PHANTUMP] = SPECIES_PHANTUMP,
+#endif
+#if (P_FAMILY_PHANTUMP)
+    [NATIONAL_DEX_TREVENANT] = SPECIES_TREVENANT,
+#endif
+#if (P_FAMILY_PUMPKABOO)
+    [NATIONAL_DEX_PUMPKABOO] = SPECIES_PUMPKABOO_AVERAGE,
+#endif
+#if (P_FAMILY_PUMPKABOO)
+    [NATIONAL_DEX_GOURGEIST] = SPECIES_GOURGEIST_AVERAGE,
+#endif
+#if (P_FAMILY_BERGMITE)
+    [NATIONAL_DEX_BERGMITE] = SPECIES_BERGMITE,
+#endif
+#if (P_FAMILY_BERGMITE)
+    [NATIONAL_DEX_AVALUGG] = SPECIES_AVALUGG,
+#endif
+#if (P_FAMILY_NOIBAT)
+    [NATIONAL_DEX_NOIBAT] = SPECIES_NOIBAT,
+#endif
+#if (P_FAMILY_NOIBAT)
+    [NATIONAL_DEX_NOIVERN] = SPECIES_NOIVERN,
+#endif
+#if (P_FAMILY_XERNEAS)
+    [NATIONAL_DEX_XERNEAS] = SPECIES_XERNEAS_NEUTRAL,
+#endif
+#if (P_FAMILY_YVELTAL)
+    [NATIONAL_DEX_YVELTAL] = SPECIES_YVELTAL,
+#endif
+#if (P_FAMILY_ZYGARDE)
+    [NATIONAL_DEX_ZYGARDE] = SPECIES_ZYGARDE_50,
+#endif
+#if (P_FAMILY_DIANCIE)
+    [NATIONAL_DEX_DIANCIE] = SPECIES_DIANCIE,
+#endif
+#if (P_FAMILY_HOOPA)
+    [NATIONAL_DEX_HOOPA] = SPECIES_HOOPA_CONFINED,
+#endif
+#if (P_FAMILY_VOLCANION)
+    [NATIONAL_DEX_VOLCANION] = SPECIES_VOLCANION,
+#endif
+#if (P_FAMILY_ROWLET)
+    [NATIONAL_DEX_ROWLET] = SPECIES_ROWLET,
+#endif
+#if (P_FAMILY_ROWLET)
+    [NATIONAL_DEX_DARTRIX] = SPECIES_DARTRIX,
+#endif
+#if (P_FAMILY_ROWLET)
+    [NATIONAL_DEX_DECIDUEYE] = SPECIES_DECIDUEYE,
+#endif
+#if (P_FAMILY_LITTEN)
+    [NATIONAL_DEX_LITTEN] = SPECIES_LITTEN,
+#endif
+#if (P_FAMILY_LITTEN)
+    [NATIONAL_DEX_TORRACAT] = SPECIES_TORRACAT,
+#endif
+#if (P_FAMILY_LITTEN)
+    [NATIONAL_DEX_INCINEROAR] = SPECIES_INCINEROAR,
+#endif
+#if (P_FAMILY_POPPLIO)
+    [NATIONAL_DEX_POPPLIO] = SPECIES_POPPLIO,
+#endif
+#if (P_FAMILY_POPPLIO)
+    [NATIONAL_DEX_BRIONNE] = SPECIES_BRIONNE,
+#endif
+#if (P_FAMILY_POPPLIO)
+    [NATIONAL_DEX_PRIMARINA] = SPECIES_PRIMARINA,
+#endif
+#if (P_FAMILY_PIKIPEK)
+    [NATIONAL_DEX_PIKIPEK] = SPECIES_PIKIPEK,
+#endif
+#if (P_FAMILY_PIKIPEK)
+    [NATIONAL_DEX_TRUMBEAK] = SPECIES_TRUMBEAK,
+#endif
+#if (P_FAMILY_PIKIPEK)
+    [NATIONAL_DEX_TOUCANNON] = SPECIES_TOUCANNON,
+#endif
+#if (P_FAMILY_YUNGOOS)
+    [NATIONAL_DEX_YUNGOOS] = SPECIES_YUNGOOS,
+#endif
+#if (P_FAMILY_YUNGOOS)
+    [NATIONAL_DEX_GUMSHOOS] = SPECIES_GUMSHOOS,
+#endif
+#if (P_FAMILY_GRUBBIN)
+    [NATIONAL_DEX_GRUBBIN] = SPECIES_GRUBBIN,
+#endif
+#if (P_FAMILY_GRUBBIN)
+    [NATIONAL_DEX_CHARJABUG] = SPECIES_CHARJABUG,
+#endif
+#if (P_FAMILY_GRUBBIN)
+    [NATIONAL_DEX_VIKAVOLT] = SPECIES_VIKAVOLT,
+#endif
+#if (P_FAMILY_CRABRAWLER)
+    [NATIONAL_DEX_CRABRAWLER] = SPECIES_CRABRAWLER,
+#endif
+#if (P_FAMILY_CRABRAWLER)
+    [NATIONAL_DEX_CRABOMINABLE] = SPECIES_CRABOMINABLE,
+#endif
+#if (P_FAMILY_ORICORIO)
+    [NATIONAL_DEX_ORICORIO] = SPECIES_ORICORIO_BAILE,
+#endif
+#if (P_FAMILY_CUTIEFLY)
+    [NATIONAL_DEX_CUTIEFLY] = SPECIES_CUTIEFLY,
+#endif
+#if (P_FAMILY_CUTIEFLY)
+    [NATIONAL_DEX_RIBOMBEE] = SPECIES_RIBOMBEE,
+#endif
+#if (P_FAMILY_ROCKRUFF)
+    [NATIONAL_DEX_ROCKRUFF] = SPECIES_ROCKRUFF,
+#endif
+#if (P_FAMILY_ROCKRUFF)
+    [NATIONAL_DEX_LYCANROC] = SPECIES_LYCANROC_MIDDAY,
+#endif
+#if (P_FAMILY_WISHIWASHI)
+    [NATIONAL_DEX_WISHIWASHI] = SPECIES_WISHIWASHI_SOLO,
+#endif
+#if (P_FAMILY_MAREANIE)
+    [NATIONAL_DEX_MAREANIE] = SPECIES_MAREANIE,
+#endif
+#if (P_FAMILY_MAREANIE)
+    [NATIONAL_DEX_TOXAPEX] = SPECIES_TOXAPEX,
+#endif
+#if (P_FAMILY_MUDBRAY)
+    [NATIONAL_DEX_MUDBRAY] = SPECIES_MUDBRAY,
+#endif
+#if (P_FAMILY_MUDBRAY)
+    [NATIONAL_DEX_MUDSDALE] = SPECIES_MUDSDALE,
+#endif
+#if (P_FAMILY_DEWPIDER)
+    [NATIONAL_DEX_DEWPIDER] = SPECIES_DEWPIDER,
+#endif
+#if (P_FAMILY_DEWPIDER)
+    [NATIONAL_DEX_ARAQUANID] = SPECIES_ARAQUANID,
+#endif
+#if (P_FAMILY_FOMANTIS)
+    [NATIONAL_DEX_FOMANTIS] = SPECIES_FOMANTIS,
+#endif
+#if (P_FAMILY_FOMANTIS)
+    [NATIONAL_DEX_LURANTIS] = SPECIES_LURANTIS,
+#endif
+#if (P_FAMILY_MORELULL)
+    [NATIONAL_DEX_MORELULL] = SPECIES_MORELULL,
+#endif
+#if (P_FAMILY_MORELULL)
+    [NATIONAL_DEX_SHIINOTIC] = SPECIES_SHIINOTIC,
+#endif
+#if (P_FAMILY_SALANDIT)
+    [NATIONAL_DEX_SALANDIT] = SPECIES_SALANDIT,
+#endif
+#if (P_FAMILY_SALANDIT)
+    [NATIONAL_DEX_SALAZZLE] = SPECIES_SALAZZLE,
+#endif
+#if (P_FAMILY_STUFFUL)
+    [NATIONAL_DEX_STUFFUL] = SPECIES_STUFFUL,
+#endif
+#if (P_FAMILY_STUFFUL)
+    [NATIONAL_DEX_BEWEAR] = SPECIES_BEWEAR,
+#endif
+#if (P_FAMILY_BOUNSWEET)
+    [NATIONAL_DEX_BOUNSWEET] = SPECIES_BOUNSWEET,
+#endif
+#if (P_FAMILY_BOUNSWEET)
+    [NATIONAL_DEX_STEENEE] = SPECIES_STEENEE,
+#endif
+#if (P_FAMILY_BOUNSWEET)
+    [NATIONAL_DEX_TSAREENA] = SPECIES_TSAREENA,
+#endif
+#if (P_FAMILY_COMFEY)
+    [NATIONAL_DEX_COMFEY] = SPECIES_COMFEY,
+#endif
+#if (P_FAMILY_ORANGURU)
+    [NATIONAL_DEX_ORANGURU] = SPECIES_ORANGURU,
+#endif
+#if (P_FAMILY_PASSIMIAN)
+    [NATIONAL_DEX_PASSIMIAN] = SPECIES_PASSIMIAN,
+#endif
+#if (P_FAMILY_WIMPOD)
+    [NATIONAL_DEX_WIMPOD] = SPECIES_WIMPOD,
+#endif
+#if (P_FAMILY_WIMPOD)
+    [NATIONAL_DEX_GOLISOPOD] = SPECIES_GOLISOPOD,
+#endif
+#if (P_FAMILY_SANDYGAST)
+    [NATIONAL_DEX_SANDYGAST] = SPECIES_SANDYGAST,
+#endif
+#if (P_FAMILY_SANDYGAST)
+    [NATIONAL_DEX_PALOSSAND] = SPECIES_PALOSSAND,
+#endif
+#if (P_FAMILY_PYUKUMUKU)
+    [NATIONAL_DEX_PYUKUMUKU] = SPECIES_PYUKUMUKU,
+#endif
+#if (P_FAMILY_TYPE_NULL)
+    [NATIONAL_DEX_TYPE_NULL] = SPECIES_TYPE_NULL,
+#endif
+#if (P_FAMILY_TYPE_NULL)
+    [NATIONAL_DEX_SILVALLY] = SPECIES_SILVALLY_NORMAL,
+#endif
+#if (P_FAMILY_MINIOR)
+    [NATIONAL_DEX_MINIOR] = SPECIES_MINIOR_METEOR_RED,
+#endif
+#if (P_FAMILY_KOMALA)
+    [NATIONAL_DEX_KOMALA] = SPECIES_KOMALA,
+#endif
+#if (P_FAMILY_TURTONATOR)
+    [NATIONAL_DEX_TURTONATOR] = SPECIES_TURTONATOR,
+#endif
+#if (P_FAMILY_TOGEDEMARU)
+    [NATIONAL_DEX_TOGEDEMARU] = SPECIES_TOGEDEMARU,
+#endif
+#if (P_FAMILY_MIMIKYU)
+    [NATIONAL_DEX_MIMIKYU] = SPECIES_MIMIKYU_DISGUISED,
+#endif
+#if (P_FAMILY_BRUXISH)
+    [NATIONAL_DEX_BRUXISH] = SPECIES_BRUXISH,
+#endif
+#if (P_FAMILY_DRAMPA)
+    [NATIONAL_DEX_DRAMPA] = SPECIES_DRAMPA,
+#endif
+#if (P_FAMILY_DHELMISE)
+    [NATIONAL_DEX_DHELMISE] = SPECIES_DHELMISE,
+#endif
+#if (P_FAMILY_JANGMO_O)
+    [NATIONAL_DEX_JANGMO_O] = SPECIES_JANGMO_O,
+#endif
+#if (P_FAMILY_JANGMO_O)
+    [NATIONAL_DEX_HAKAMO_O] = SPECIES_HAKAMO_O,
+#endif
+#if (P_FAMILY_JANGMO_O)
+    [NATIONAL_DEX_KOMMO_O] = SPECIES_KOMMO_O,
+#endif
+#if (P_FAMILY_TAPU_KOKO)
+    [NATIONAL_DEX_TAPU_KOKO] = SPECIES_TAPU_KOKO,
+#endif
+#if (P_FAMILY_TAPU_LELE)
+    [NATIONAL_DEX_TAPU_LELE] = SPECIES_TAPU_LELE,
+#endif
+#if (P_FAMILY_TAPU_BULU)
+    [NATIONAL_DEX_TAPU_BULU] = SPECIES_TAPU_BULU,
+#endif
+#if (P_FAMILY_TAPU_FINI)
+    [NATIONAL_DEX_TAPU_FINI] = SPECIES_TAPU_FINI,
+#endif
+#if (P_FAMILY_COSMOG)
+    [NATIONAL_DEX_COSMOG] = SPECIES_COSMOG,
+#endif
+#if (P_FAMILY_COSMOG)
+    [NATIONAL_DEX_COSMOEM] = SPECIES_COSMOEM,
+#endif
+#if (P_FAMILY_COSMOG)
+    [NATIONAL_DEX_SOLGALEO] = SPECIES_SOLGALEO,
+#endif
+#if (P_FAMILY_COSMOG)
+    [NATIONAL_DEX_LUNALA] = SPECIES_LUNALA,
+#endif
+#if (P_FAMILY_NIHILEGO)
+    [NATIONAL_DEX_NIHILEGO] = SPECIES_NIHILEGO,
+#endif
+#if (P_FAMILY_BUZZWOLE)
+    [NATIONAL_DEX_BUZZWOLE] = SPECIES_BUZZWOLE,
+#endif
+#if (P_FAMILY_PHEROMOSA)
+    [NATIONAL_DEX_PHEROMOSA] = SPECIES_PHEROMOSA,
+#endif
+#if (P_FAMILY_XURKITREE)
+    [NATIONAL_DEX_XURKITREE] = SPECIES_XURKITREE,
+#endif
+#if (P_FAMILY_CELESTEELA)
+    [NATIONAL_DEX_CELESTEELA] = SPECIES_CELESTEELA,
+#endif
+#if (P_FAMILY_KARTANA)
+    [NATIONAL_DEX_KARTANA] = SPECIES_KARTANA,
+#endif
+#if (P_FAMILY_GUZZLORD)
+    [NATIONAL_DEX_GUZZLORD] = SPECIES_GUZZLORD,
+#endif
+#if (P_FAMILY_NECROZMA)
+    [NATIONAL_DEX_NECROZMA] = SPECIES_NECROZMA,
+#endif
+#if (P_FAMILY_MAGEARNA)
+    [NATIONAL_DEX_MAGEARNA] = SPECIES_MAGEARNA,
+#endif
+#if (P_FAMILY_MARSHADOW)
+    [NATIONAL_DEX_MARSHADOW] = SPECIES_MARSHADOW,
+#endif
+#if (P_FAMILY_POIPOLE)
+    [NATIONAL_DEX_POIPOLE] = SPECIES_POIPOLE,
+#endif
+#if (P_FAMILY_POIPOLE)
+    [NATIONAL_DEX_NAGANADEL] = SPECIES_NAGANADEL,
+#endif
+#if (P_FAMILY_STAKATAKA)
+    [NATIONAL_DEX_STAKATAKA] = SPECIES_STAKATAKA,
+#endif
+#if (P_FAMILY_BLACEPHALON)
+    [NATIONAL_DEX_BLACEPHALON] = SPECIES_BLACEPHALON,
+#endif
+#if (P_FAMILY_ZERAORA)
+    [NATIONAL_DEX_ZERAORA] = SPECIES_ZERAORA,
+#endif
+#if (P_FAMILY_MELTAN)
+    [NATIONAL_DEX_MELTAN] = SPECIES_MELTAN,
+#endif
+#if (P_FAMILY_MELTAN)
+    [NATIONAL_DEX_MELMETAL] = SPECIES_MELMETAL,
+#endif
+#if (P_FAMILY_GROOKEY)
+    [NATIONAL_DEX_GROOKEY] = SPECIES_GROOKEY,
+#endif
+#if (P_FAMILY_GROOKEY)
+    [NATIONAL_DEX_THWACKEY] = SPECIES_THWACKEY,
+#endif
+#if (P_FAMILY_GROOKEY)
+    [NATIONAL_DEX_RILLABOOM] = SPECIES_RILLABOOM,
+#endif
+#if (P_FAMILY_SCORBUNNY)
+    [NATIONAL_DEX_SCORBUNNY] = SPECIES_SCORBUNNY,
+#endif
+#if (P_FAMILY_SCORBUNNY)
+    [NATIONAL_DEX_RABOOT] = SPECIES_RABOOT,
+#endif
+#if (P_FAMILY_SCORBUNNY)
+    [NATIONAL_DEX_CINDERACE] = SPECIES_CINDERACE,
+#endif
+#if (P_FAMILY_SOBBLE)
+    [NATIONAL_DEX_SOBBLE] = SPECIES_SOBBLE,
+#endif
+#if (P_FAMILY_SOBBLE)
+    [NATIONAL_DEX_DRIZZILE] = SPECIES_DRIZZILE,
+#endif
+#if (P_FAMILY_SOBBLE)
+    [NATIONAL_DEX_INTELEON] = SPECIES_INTELEON,
+#endif
+#if (P_FAMILY_SKWOVET)
+    [NATIONAL_DEX_SKWOVET] = SPECIES_SKWOVET,
+#endif
+#if (P_FAMILY_SKWOVET)
+    [NATIONAL_DEX_GREEDENT] = SPECIES_GREEDENT,
+#endif
+#if (P_FAMILY_ROOKIDEE)
+    [NATIONAL_DEX_ROOKIDEE] = SPECIES_ROOKIDEE,
+#endif
+#if (P_FAMILY_ROOKIDEE)
+    [NATIONAL_DEX_CORVISQUIRE] = SPECIES_CORVISQUIRE,
+#endif
+#if (P_FAMILY_ROOKIDEE)
+    [NATIONAL_DEX_CORVIKNIGHT] = SPECIES_CORVIKNIGHT,
+#endif
+#if (P_FAMILY_BLIPBUG)
+    [NATIONAL_DEX_BLIPBUG] = SPECIES_BLIPBUG,
+#endif
+#if (P_FAMILY_BLIPBUG)
+    [NATIONAL_DEX_DOTTLER] = SPECIES_DOTTLER,
+#endif
+#if (P_FAMILY_BLIPBUG)
+    [NATIONAL_DEX_ORBEETLE] = SPECIES_ORBEETLE,
+#endif
+#if (P_FAMILY_NICKIT)
+    [NATIONAL_DEX_NICKIT] = SPECIES_NICKIT,
+#endif
+#if (P_FAMILY_NICKIT)
+    [NATIONAL_DEX_THIEVUL] = SPECIES_THIEVUL,
+#endif
+#if (P_FAMILY_GOSSIFLEUR)
+    [NATIONAL_DEX_GOSSIFLEUR] = SPECIES_GOSSIFLEUR,
+#endif
+#if (P_FAMILY_GOSSIFLEUR)
+    [NATIONAL_DEX_ELDEGOSS] = SPECIES_ELDEGOSS,
+#endif
+#if (P_FAMILY_WOOLOO)
+    [NATIONAL_DEX_WOOLOO] = SPECIES_WOOLOO,
+#endif
+#if (P_FAMILY_WOOLOO)
+    [NATIONAL_DEX_DUBWOOL] = SPECIES_DUBWOOL,
+#endif
+#if (P_FAMILY_CHEWTLE)
+    [NATIONAL_DEX_CHEWTLE] = SPECIES_CHEWTLE,
+#endif
+#if (P_FAMILY_CHEWTLE)
+    [NATIONAL_DEX_DREDNAW] = SPECIES_DREDNAW,
+#endif
+#if (P_FAMILY_YAMPER)
+    [NATIONAL_DEX_YAMPER] = SPECIES_YAMPER,
+#endif
+#if (P_FAMILY_YAMPER)
+    [NATIONAL_DEX_BOLTUND] = SPECIES_BOLTUND,
+#endif
+#if (P_FAMILY_ROLYCOLY)
+    [NATIONAL_DEX_ROLYCOLY] = SPECIES_ROLYCOLY,
+#endif
+#if (P_FAMILY_ROLYCOLY)
+    [NATIONAL_DEX_CARKOL] = SPECIES_CARKOL,
+#endif
+#if (P_FAMILY_ROLYCOLY)
+    [NATIONAL_DEX_COALOSSAL] = SPECIES_COALOSSAL,
+#endif
+#if (P_FAMILY_APPLIN)
+    [NATIONAL_DEX_APPLIN] = SPECIES_APPLIN,
+#endif
+#if (P_FAMILY_APPLIN)
+    [NATIONAL_DEX_FLAPPLE] = SPECIES_FLAPPLE,
+#endif
+#if (P_FAMILY_APPLIN)
+    [NATIONAL_DEX_APPLETUN] = SPECIES_APPLETUN,
+#endif
+#if (P_FAMILY_SILICOBRA)
+    [NATIONAL_DEX_SILICOBRA] = SPECIES_SILICOBRA,
+#endif
+#if (P_FAMILY_SILICOBRA)
+    [NATIONAL_DEX_SANDACONDA] = SPECIES_SANDACONDA,
+#endif
+#if (P_FAMILY_CRAMORANT)
+    [NATIONAL_DEX_CRAMORANT] = SPECIES_CRAMORANT,
+#endif
+#if (P_FAMILY_ARROKUDA)
+    [NATIONAL_DEX_ARROKUDA] = SPECIES_ARROKUDA,
+#endif
+#if (P_FAMILY_ARROKUDA)
+    [NATIONAL_DEX_BARRASKEWDA] = SPECIES_BARRASKEWDA,
+#endif
+#if (P_FAMILY_TOXEL)
+    [NATIONAL_DEX_TOXEL] = SPECIES_TOXEL,
+#endif
+#if (P_FAMILY_TOXEL)
+    [NATIONAL_DEX_TOXTRICITY] = SPECIES_TOXTRICITY_AMPED,
+#endif
+#if (P_FAMILY_SIZZLIPEDE)
+    [NATIONAL_DEX_SIZZLIPEDE] = SPECIES_SIZZLIPEDE,
+#endif
+#if (P_FAMILY_SIZZLIPEDE)
+    [NATIONAL_DEX_CENTISKORCH] = SPECIES_CENTISKORCH,
+#endif
+#if (P_FAMILY_CLOBBOPUS)
+    [NATIONAL_DEX_CLOBBOPUS] = SPECIES_CLOBBOPUS,
+#endif
+#if (P_FAMILY_CLOBBOPUS)
+    [NATIONAL_DEX_GRAPPLOCT] = SPECIES_GRAPPLOCT,
+#endif
+#if (P_FAMILY_SINISTEA)
+    [NATIONAL_DEX_SINISTEA] = SPECIES_SINISTEA_PHONY,
+#endif
+#if (P_FAMILY_SINISTEA)
+    [NATIONAL_DEX_POLTEAGEIST] = SPECIES_POLTEAGEIST_PHONY,
+#endif
+#if (P_FAMILY_HATENNA)
+    [NATIONAL_DEX_HATENNA] = SPECIES_HATENNA,
+#endif
+#if (P_FAMILY_HATENNA)
+    [NATIONAL_DEX_HATTREM] = SPECIES_HATTREM,
+#endif
+#if (P_FAMILY_HATENNA)
+    [NATIONAL_DEX_HATTERENE] = SPECIES_HATTERENE,
+#endif
+#if (P_FAMILY_IMPIDIMP)
+    [NATIONAL_DEX_IMPIDIMP] = SPECIES_IMPIDIMP,
+#endif
+#if (P_FAMILY_IMPIDIMP)
+    [NATIONAL_DEX_MORGREM] = SPECIES_MORGREM,
+#endif
+#if (P_FAMILY_IMPIDIMP)
+    [NATIONAL_DEX_GRIMMSNARL] = SPECIES_GRIMMSNARL,
+#endif
+#if (P_FAMILY_ZIGZAGOON) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_OBSTAGOON] = SPECIES_OBSTAGOON,
+#endif
+#if (P_FAMILY_MEOWTH) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_PERRSERKER] = SPECIES_PERRSERKER,
+#endif
+#if (P_FAMILY_CORSOLA) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_CURSOLA] = SPECIES_CURSOLA,
+#endif
+#if (P_FAMILY_FARFETCHD) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_SIRFETCHD] = SPECIES_SIRFETCHD,
+#endif
+#if (P_FAMILY_MR_MIME) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_MR_RIME] = SPECIES_MR_RIME,
+#endif
+#if (P_FAMILY_YAMASK) && (P_GALARIAN_FORMS)
+    [NATIONAL_DEX_RUNERIGUS] = SPECIES_RUNERIGUS,
+#endif
+#if (P_FAMILY_MILCERY)
+    [NATIONAL_DEX_MILCERY] = SPECIES_MILCERY,
+#endif
+#if (P_FAMILY_MILCERY)
+    [NATIONAL_DEX_ALCREMIE] = SPECIES_ALCREMIE_STRAWBERRY_VANILLA_CREAM,
+#endif
+#if (P_FAMILY_FALINKS)
+    [NATIONAL_DEX_FALINKS] = SPECIES_FALINKS,
+#endif
+#if (P_FAMILY_PINCURCHIN)
+    [NATIONAL_DEX_PINCURCHIN] = SPECIES_PINCURCHIN,
+#endif
+#if (P_FAMILY_SNOM)
+    [NATIONAL_DEX_SNOM] = SPECIES_SNOM,
+#endif
+#if (P_FAMILY_SNOM)
+    [NATIONAL_DEX_FROSMOTH] = SPECIES_FROSMOTH,
+#endif
+#if (P_FAMILY_STONJOURNER)
+    [NATIONAL_DEX_STONJOURNER] = SPECIES_STONJOURNER,
+#endif
+#if (P_FAMILY_EISCUE)
+    [NATIONAL_DEX_EISCUE] = SPECIES_EISCUE_ICE,
+#endif
+#if (P_FAMILY_INDEEDEE)
+    [NATIONAL_DEX_INDEEDEE] = SPECIES_INDEEDEE_M,
+#endif
+#if (P_FAMILY_MORPEKO)
+    [NATIONAL_DEX_MORPEKO] = SPECIES_MORPEKO_FULL_BELLY,
+#endif
+#if (P_FAMILY_CUFANT)
+    [NATIONAL_DEX_CUFANT] = SPECIES_CUFANT,
+#endif
+#if (P_FAMILY_CUFANT)
+    [NATIONAL_DEX_COPPERAJAH] = SPECIES_COPPERAJAH,
+#endif
+#if (P_FAMILY_DRACOZOLT)
+    [NATIONAL_DEX_DRACOZOLT] = SPECIES_DRACOZOLT,
+#endif
+#if (P_FAMILY_ARCTOZOLT)
+    [NATIONAL_DEX_ARCTOZOLT] = SPECIES_ARCTOZOLT,
+#endif
+#if (P_FAMILY_DRACOVISH)
+    [NATIONAL_DEX_DRACOVISH] = SPECIES_DRACOVISH,
+#endif
+#if (P_FAMILY_ARCTOVISH)
+    [NATIONAL_DEX_ARCTOVISH] = SPECIES_ARCTOVISH,
+#endif
+#if (P_FAMILY_DURALUDON)
+    [NATIONAL_DEX_DURALUDON] = SPECIES_DURALUDON,
+#endif
+#if (P_FAMILY_DREEPY)
+    [NATIONAL_DEX_DREEPY] = SPECIES_DREEPY,
+#endif
+#if (P_FAMILY_DREEPY)
+    [NATIONAL_DEX_DRAKLOAK] = SPECIES_DRAKLOAK,
+#endif
+#if (P_FAMILY_DREEPY)
+    [NATIONAL_DEX_DRAGAPULT] = SPECIES_DRAGAPULT,
+#endif
+#if (P_FAMILY_ZACIAN)
+    [NATIONAL_DEX_ZACIAN] = SPECIES_ZACIAN_HERO,
+#endif
+#if (P_FAMILY_ZAMAZENTA)
+    [NATIONAL_DEX_ZAMAZENTA] = SPECIES_ZAMAZENTA_HERO,
+#endif
+#if (P_FAMILY_ETERNATUS)
+    [NATIONAL_DEX_ETERNATUS] = SPECIES_ETERNATUS,
+#endif
+#if (P_FAMILY_KUBFU)
+    [NATIONAL_DEX_KUBFU] = SPECIES_KUBFU,
+#endif
+#if (P_FAMILY_KUBFU)
+    [NATIONAL_DEX_URSHIFU] = SPECIES_URSHIFU_SINGLE_STRIKE,
+#endif
+#if (P_FAMILY_ZARUDE)
+    [NATIONAL_DEX_ZARUDE] = SPECIES_ZARUDE,
+#endif
+#if (P_FAMILY_REGIELEKI)
+    [NATIONAL_DEX_REGIELEKI] = SPECIES_REGIELEKI,
+#endif
+#if (P_FAMILY_REGIDRAGO)
+    [NATIONAL_DEX_REGIDRAGO] = SPECIES_REGIDRAGO,
+#endif
+#if (P_FAMILY_GLASTRIER)
+    [NATIONAL_DEX_GLASTRIER] = SPECIES_GLASTRIER,
+#endif
+#if (P_FAMILY_SPECTRIER)
+    [NATIONAL_DEX_SPECTRIER] = SPECIES_SPECTRIER,
+#endif
+#if (P_FAMILY_CALYREX)
+    [NATIONAL_DEX_CALYREX] = SPECIES_CALYREX,
+#endif
+#if (P_FAMILY_STANTLER) && (P_GEN_8_CROSS_EVOS)
+    [NATIONAL_DEX_WYRDEER] = SPECIES_WYRDEER,
+#endif
+#if (P_FAMILY_SCYTHER) && (P_GEN_8_CROSS_EVOS)
+    [NATIONAL_DEX_KLEAVOR] = SPECIES_KLEAVOR,
+#endif
+#if (P_FAMILY_TEDDIURSA) && (P_GEN_8_CROSS_EVOS)
+    [NATIONAL_DEX_URSALUNA] = SPECIES_URSALUNA,
+#endif
+#if (P_FAMILY_BASCULIN) && (P_HISUIAN_FORMS)
+    [NATIONAL_DEX_BASCULEGION] = SPECIES_BASCULEGION_M,
+#endif
+#if (P_FAMILY_SNEASEL) && (P_HISUIAN_FORMS)
+    [NATIONAL_DEX_SNEASLER] = SPECIES_SNEASLER,
+#endif
+#if (P_FAMILY_QWILFISH) && (P_HISUIAN_FORMS)
+    [NATIONAL_DEX_OVERQWIL] = SPECIES_OVERQWIL,
+#endif
+#if (P_FAMILY_ENAMORUS)
+    [NATIONAL_DEX_ENAMORUS] = SPECIES_ENAMORUS_INCARNATE,
+#endif
+#if (P_FAMILY_SPRIGATITO)
+    [NATIONAL_DEX_SPRIGATITO] = SPECIES_SPRIGATITO,
+#endif
+#if (P_FAMILY_SPRIGATITO)
+    [NATIONAL_DEX_FLORAGATO] = SPECIES_FLORAGATO,
+#endif
+#if (P_FAMILY_SPRIGATITO)
+    [NATIONAL_DEX_MEOWSCARADA] = SPECIES_MEOWSCARADA,
+#endif
+#if (P_FAMILY_FUECOCO)
+    [NATIONAL_DEX_FUECOCO] = SPECIES_FUECOCO,
+#endif
+#if (P_FAMILY_FUECOCO)
+    [NATIONAL_DEX_CROCALOR] = SPECIES_CROCALOR,
+#endif
+#if (P_FAMILY_FUECOCO)
+    [NATIONAL_DEX_SKELEDIRGE] = SPECIES_SKELEDIRGE,
+#endif
+#if (P_FAMILY_QUAXLY)
+    [NATIONAL_DEX_QUAXLY] = SPECIES_QUAXLY,
+#endif
+#if (P_FAMILY_QUAXLY)
+    [NATIONAL_DEX_QUAXWELL] = SPECIES_QUAXWELL,
+#endif
+#if (P_FAMILY_QUAXLY)
+    [NATIONAL_DEX_QUAQUAVAL] = SPECIES_QUAQUAVAL,
+#endif
+#if (P_FAMILY_LECHONK)
+    [NATIONAL_DEX_LECHONK] = SPECIES_LECHONK,
+#endif
+#if (P_FAMILY_LECHONK)
+    [NATIONAL_DEX_OINKOLOGNE] = SPECIES_OINKOLOGNE_M,
+#endif
+#if (P_FAMILY_TAROUNTULA)
+    [NATIONAL_DEX_TAROUNTULA] = SPECIES_TAROUNTULA,
+#endif
+#if (P_FAMILY_TAROUNTULA)
+    [NATIONAL_DEX_SPIDOPS] = SPECIES_SPIDOPS,
+#endif
+#if (P_FAMILY_NYMBLE)
+    [NATIONAL_DEX_NYMBLE] = SPECIES_NYMBLE,
+#endif
+#if (P_FAMILY_NYMBLE)
+    [NATIONAL_DEX_LOKIX] = SPECIES_LOKIX,
+#endif
+#if (P_FAMILY_PAWMI)
+    [NATIONAL_DEX_PAWMI] = SPECIES_PAWMI,
+#endif
+#if (P_FAMILY_PAWMI)
+    [NATIONAL_DEX_PAWMO] = SPECIES_PAWMO,
+#endif
+#if (P_FAMILY_PAWMI)
+    [NATIONAL_DEX_PAWMOT] = SPECIES_PAWMOT,
+#endif
+#if (P_FAMILY_TANDEMAUS)
+    [NATIONAL_DEX_TANDEMAUS] = SPECIES_TANDEMAUS,
+#endif
+#if (P_FAMILY_TANDEMAUS)
+    [NATIONAL_DEX_MAUSHOLD] = SPECIES_MAUSHOLD_THREE,
+#endif
+#if (P_FAMILY_FIDOUGH)
+    [NATIONAL_DEX_FIDOUGH] = SPECIES_FIDOUGH,
+#endif
+#if (P_FAMILY_FIDOUGH)
+    [NATIONAL_DEX_DACHSBUN] = SPECIES_DACHSBUN,
+#endif
+#if (P_FAMILY_SMOLIV)
+    [NATIONAL_DEX_SMOLIV] = SPECIES_SMOLIV,
+#endif
+#if (P_FAMILY_SMOLIV)
+    [NATIONAL_DEX_DOLLIV] = SPECIES_DOLLIV,
+#endif
+#if (P_FAMILY_SMOLIV)
+    [NATIONAL_DEX_ARBOLIVA] = SPECIES_ARBOLIVA,
+#endif
+#if (P_FAMILY_SQUAWKABILLY)
+    [NATIONAL_DEX_SQUAWKABILLY] = SPECIES_SQUAWKABILLY_GREEN,
+#endif
+#if (P_FAMILY_NACLI)
+    [NATIONAL_DEX_NACLI] = SPECIES_NACLI,
+#endif
+#if (P_FAMILY_NACLI)
+    [NATIONAL_DEX_NACLSTACK] = SPECIES_NACLSTACK,
+#endif
+#if (P_FAMILY_NACLI)
+    [NATIONAL_DEX_GARGANACL] = SPECIES_GARGANACL,
+#endif
+#if (P_FAMILY_CHARCADET)
+    [NATIONAL_DEX_CHARCADET] = SPECIES_CHARCADET,
+#endif
+#if (P_FAMILY_CHARCADET)
+    [NATIONAL_DEX_ARMAROUGE] = SPECIES_ARMAROUGE,
+#endif
+#if (P_FAMILY_CHARCADET)
+    [NATIONAL_DEX_CERULEDGE] = SPECIES_CERULEDGE,
+#endif
+#if (P_FAMILY_TADBULB)
+    [NATIONAL_DEX_TADBULB] = SPECIES_TADBULB,
+#endif
+#if (P_FAMILY_TADBULB)
+    [NATIONAL_DEX_BELLIBOLT] = SPECIES_BELLIBOLT,
+#endif
+#if (P_FAMILY_WATTREL)
+    [NATIONAL_DEX_WATTREL] = SPECIES_WATTREL,
+#endif
+#if (P_FAMILY_WATTREL)
+    [NATIONAL_DEX_KILOWATTREL] = SPECIES_KILOWATTREL,
+#endif
+#if (P_FAMILY_MASCHIFF)
+    [NATIONAL_DEX_MASCHIFF] = SPECIES_MASCHIFF,
+#endif
+#if (P_FAMILY_MASCHIFF)
+    [NATIONAL_DEX_MABOSSTIFF] = SPECIES_MABOSSTIFF,
+#endif
+#if (P_FAMILY_SHROODLE)
+    [NATIONAL_DEX_SHROODLE] = SPECIES_SHROODLE,
+#endif
+#if (P_FAMILY_SHROODLE)
+    [NATIONAL_DEX_GRAFAIAI] = SPECIES_GRAFAIAI,
+#endif
+#if (P_FAMILY_BRAMBLIN)
+    [NATIONAL_DEX_BRAMBLIN] = SPECIES_BRAMBLIN,
+#endif
+#if (P_FAMILY_BRAMBLIN)
+    [NATIONAL_DEX_BRAMBLEGHAST] = SPECIES_BRAMBLEGHAST,
+#endif
+#if (P_FAMILY_TOEDSCOOL)
+    [NATIONAL_DEX_TOEDSCOOL] = SPECIES_TOEDSCOOL,
+#endif
+#if (P_FAMILY_TOEDSCOOL)
+    [NATIONAL_DEX_TOEDSCRUEL] = SPECIES_TOEDSCRUEL,
+#endif
+#if (P_FAMILY_KLAWF)
+    [NATIONAL_DEX_KLAWF] = SPECIES_KLAWF,
+#endif
+#if (P_FAMILY_CAPSAKID)
+    [NATIONAL_DEX_CAPSAKID] = SPECIES_CAPSAKID,
+#endif
+#if (P_FAMILY_CAPSAKID)
+    [NATIONAL_DEX_SCOVILLAIN] = SPECIES_SCOVILLAIN,
+#endif
+#if (P_FAMILY_RELLOR)
+    [NATIONAL_DEX_RELLOR] = SPECIES_RELLOR,
+#endif
+#if (P_FAMILY_RELLOR)
+    [NATIONAL_DEX_RABSCA] = SPECIES_RABSCA,
+#endif
+#if (P_FAMILY_FLITTLE)
+    [NATIONAL_DEX_FLITTLE] = SPECIES_FLITTLE,
+#endif
+#if (P_FAMILY_FLITTLE)
+    [NATIONAL_DEX_ESPATHRA] = SPECIES_ESPATHRA,
+#endif
+#if (P_FAMILY_TINKATINK)
+    [NATIONAL_DEX_TINKATINK] = SPECIES_TINKATINK,
+#endif
+#if (P_FAMILY_TINKATINK)
+    [NATIONAL_DEX_TINKATUFF] = SPECIES_TINKATUFF,
+#endif
+#if (P_FAMILY_TINKATINK)
+    [NATIONAL_DEX_TINKATON] = SPECIES_TINKATON,
+#endif
+#if (P_FAMILY_WIGLETT)
+    [NATIONAL_DEX_WIGLETT] = SPECIES_WIGLETT,
+#endif
+#if (P_FAMILY_WIGLETT)
+    [NATIONAL_DEX_WUGTRIO] = SPECIES_WUGTRIO,
+#endif
+#if (P_FAMILY_BOMBIRDIER)
+    [NATIONAL_DEX_BOMBIRDIER] = SPECIES_BOMBIRDIER,
+#endif
+#if (P_FAMILY_FINIZEN)
+    [NATIONAL_DEX_FINIZEN] = SPECIES_FINIZEN,
+#endif
+#if (P_FAMILY_FINIZEN)
+    [NATIONAL_DEX_PALAFIN] = SPECIES_PALAFIN_ZERO,
+#endif
+#if (P_FAMILY_VAROOM)
+    [NATIONAL_DEX_VAROOM] = SPECIES_VAROOM,
+#endif
+#if (P_FAMILY_VAROOM)
+    [NATIONAL_DEX_REVAVROOM] = SPECIES_REVAVROOM,
+#endif
+#if (P_FAMILY_CYCLIZAR)
+    [NATIONAL_DEX_CYCLIZAR] = SPECIES_CYCLIZAR,
+#endif
+#if (P_FAMILY_ORTHWORM)
+    [NATIONAL_DEX_ORTHWORM] = SPECIES_ORTHWORM,
+#endif
+#if (P_FAMILY_GLIMMET)
+    [NATIONAL_DEX_GLIMMET] = SPECIES_GLIMMET,
+#endif
+#if (P_FAMILY_GLIMMET)
+    [NATIONAL_DEX_GLIMMORA] = SPECIES_GLIMMORA,
+#endif
+#if (P_FAMILY_GREAVARD)
+    [NATIONAL_DEX_GREAVARD] = SPECIES_GREAVARD,
+#endif
+#if (P_FAMILY_GREAVARD)
+    [NATIONAL_DEX_HOUNDSTONE] = SPECIES_HOUNDSTONE,
+#endif
+#if (P_FAMILY_FLAMIGO)
+    [NATIONAL_DEX_FLAMIGO] = SPECIES_FLAMIGO,
+#endif
+#if (P_FAMILY_CETODDLE)
+    [NATIONAL_DEX_CETODDLE] = SPECIES_CETODDLE,
+#endif
+#if (P_FAMILY_CETODDLE)
+    [NATIONAL_DEX_CETITAN] = SPECIES_CETITAN,
+#endif
+#if (P_FAMILY_VELUZA)
+    [NATIONAL_DEX_VELUZA] = SPECIES_VELUZA,
+#endif
+#if (P_FAMILY_DONDOZO)
+    [NATIONAL_DEX_DONDOZO] = SPECIES_DONDOZO,
+#endif
+#if (P_FAMILY_TATSUGIRI)
+    [NATIONAL_DEX_TATSUGIRI] = SPECIES_TATSUGIRI_CURLY,
+#endif
+#if (P_FAMILY_MANKEY) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_ANNIHILAPE] = SPECIES_ANNIHILAPE,
+#endif
+#if (P_FAMILY_WOOPER) && (P_PALDEAN_FORMS)
+    [NATIONAL_DEX_CLODSIRE] = SPECIES_CLODSIRE,
+#endif
+#if (P_FAMILY_GIRAFARIG) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_FARIGIRAF] = SPECIES_FARIGIRAF,
+#endif
+#if (P_FAMILY_DUNSPARCE) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_DUDUNSPARCE] = SPECIES_DUDUNSPARCE_TWO_SEGMENT,
+#endif
+#if (P_FAMILY_PAWNIARD) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_KINGAMBIT] = SPECIES_KINGAMBIT,
+#endif
+#if (P_FAMILY_GREAT_TUSK)
+    [NATIONAL_DEX_GREAT_TUSK] = SPECIES_GREAT_TUSK,
+#endif
+#if (P_FAMILY_SCREAM_TAIL)
+    [NATIONAL_DEX_SCREAM_TAIL] = SPECIES_SCREAM_TAIL,
+#endif
+#if (P_FAMILY_BRUTE_BONNET)
+    [NATIONAL_DEX_BRUTE_BONNET] = SPECIES_BRUTE_BONNET,
+#endif
+#if (P_FAMILY_FLUTTER_MANE)
+    [NATIONAL_DEX_FLUTTER_MANE] = SPECIES_FLUTTER_MANE,
+#endif
+#if (P_FAMILY_SLITHER_WING)
+    [NATIONAL_DEX_SLITHER_WING] = SPECIES_SLITHER_WING,
+#endif
+#if (P_FAMILY_SANDY_SHOCKS)
+    [NATIONAL_DEX_SANDY_SHOCKS] = SPECIES_SANDY_SHOCKS,
+#endif
+#if (P_FAMILY_IRON_TREADS)
+    [NATIONAL_DEX_IRON_TREADS] = SPECIES_IRON_TREADS,
+#endif
+#if (P_FAMILY_IRON_BUNDLE)
+    [NATIONAL_DEX_IRON_BUNDLE] = SPECIES_IRON_BUNDLE,
+#endif
+#if (P_FAMILY_IRON_HANDS)
+    [NATIONAL_DEX_IRON_HANDS] = SPECIES_IRON_HANDS,
+#endif
+#if (P_FAMILY_IRON_JUGULIS)
+    [NATIONAL_DEX_IRON_JUGULIS] = SPECIES_IRON_JUGULIS,
+#endif
+#if (P_FAMILY_IRON_MOTH)
+    [NATIONAL_DEX_IRON_MOTH] = SPECIES_IRON_MOTH,
+#endif
+#if (P_FAMILY_IRON_THORNS)
+    [NATIONAL_DEX_IRON_THORNS] = SPECIES_IRON_THORNS,
+#endif
+#if (P_FAMILY_FRIGIBAX)
+    [NATIONAL_DEX_FRIGIBAX] = SPECIES_FRIGIBAX,
+#endif
+#if (P_FAMILY_FRIGIBAX)
+    [NATIONAL_DEX_ARCTIBAX] = SPECIES_ARCTIBAX,
+#endif
+#if (P_FAMILY_FRIGIBAX)
+    [NATIONAL_DEX_BAXCALIBUR] = SPECIES_BAXCALIBUR,
+#endif
+#if (P_FAMILY_GIMMIGHOUL)
+    [NATIONAL_DEX_GIMMIGHOUL] = SPECIES_GIMMIGHOUL_CHEST,
+#endif
+#if (P_FAMILY_GIMMIGHOUL)
+    [NATIONAL_DEX_GHOLDENGO] = SPECIES_GHOLDENGO,
+#endif
+#if (P_FAMILY_WO_CHIEN)
+    [NATIONAL_DEX_WO_CHIEN] = SPECIES_WO_CHIEN,
+#endif
+#if (P_FAMILY_CHIEN_PAO)
+    [NATIONAL_DEX_CHIEN_PAO] = SPECIES_CHIEN_PAO,
+#endif
+#if (P_FAMILY_TING_LU)
+    [NATIONAL_DEX_TING_LU] = SPECIES_TING_LU,
+#endif
+#if (P_FAMILY_CHI_YU)
+    [NATIONAL_DEX_CHI_YU] = SPECIES_CHI_YU,
+#endif
+#if (P_FAMILY_ROARING_MOON)
+    [NATIONAL_DEX_ROARING_MOON] = SPECIES_ROARING_MOON,
+#endif
+#if (P_FAMILY_IRON_VALIANT)
+    [NATIONAL_DEX_IRON_VALIANT] = SPECIES_IRON_VALIANT,
+#endif
+#if (P_FAMILY_KORAIDON)
+    [NATIONAL_DEX_KORAIDON] = SPECIES_KORAIDON,
+#endif
+#if (P_FAMILY_MIRAIDON)
+    [NATIONAL_DEX_MIRAIDON] = SPECIES_MIRAIDON,
+#endif
+#if (P_FAMILY_WALKING_WAKE)
+    [NATIONAL_DEX_WALKING_WAKE] = SPECIES_WALKING_WAKE,
+#endif
+#if (P_FAMILY_IRON_LEAVES)
+    [NATIONAL_DEX_IRON_LEAVES] = SPECIES_IRON_LEAVES,
+#endif
+#if (P_FAMILY_APPLIN) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_DIPPLIN] = SPECIES_DIPPLIN,
+#endif
+#if (P_FAMILY_POLTCHAGEIST)
+    [NATIONAL_DEX_POLTCHAGEIST] = SPECIES_POLTCHAGEIST_COUNTERFEIT,
+#endif
+#if (P_FAMILY_POLTCHAGEIST)
+    [NATIONAL_DEX_SINISTCHA] = SPECIES_SINISTCHA_UNREMARKABLE,
+#endif
+#if (P_FAMILY_OKIDOGI)
+    [NATIONAL_DEX_OKIDOGI] = SPECIES_OKIDOGI,
+#endif
+#if (P_FAMILY_MUNKIDORI)
+    [NATIONAL_DEX_MUNKIDORI] = SPECIES_MUNKIDORI,
+#endif
+#if (P_FAMILY_FEZANDIPITI)
+    [NATIONAL_DEX_FEZANDIPITI] = SPECIES_FEZANDIPITI,
+#endif
+#if (P_FAMILY_OGERPON)
+    [NATIONAL_DEX_OGERPON] = SPECIES_OGERPON_TEAL,
+#endif
+#if (P_FAMILY_DURALUDON) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_ARCHALUDON] = SPECIES_ARCHALUDON,
+#endif
+#if (P_FAMILY_APPLIN) && (P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_HYDRAPPLE] = SPECIES_HYDRAPPLE,
+#endif
+#if (P_FAMILY_GOUGING_FIRE)
+    [NATIONAL_DEX_GOUGING_FIRE] = SPECIES_GOUGING_FIRE,
+#endif
+#if (P_FAMILY_RAGING_BOLT)
+    [NATIONAL_DEX_RAGING_BOLT] = SPECIES_RAGING_BOLT,
+#endif
+#if (P_FAMILY_IRON_BOULDER)
+    [NATIONAL_DEX_IRON_BOULDER] = SPECIES_IRON_BOULDER,
+#endif
+#if (P_FAMILY_IRON_CROWN)
+    [NATIONAL_DEX_IRON_CROWN] = SPECIES_IRON_CROWN,
+#endif
+#if (P_FAMILY_TERAPAGOS)
+    [NATIONAL_DEX_TERAPAGOS] = SPECIES_TERAPAGOS_NORMAL,
+#endif
+#if (P_FAMILY_PECHARUNT)
+    [NATIONAL_DEX_PECHARUNT] = SPECIES_PECHARUNT,
+#endif
+};
+
+static const u16 sNationalToKantoDexNum[NATIONAL_DEX_END] =
+{
+    [NATIONAL_DEX_BULBASAUR] = KANTO_DEX_BULBASAUR,
+    [NATIONAL_DEX_IVYSAUR] = KANTO_DEX_IVYSAUR,
+    [NATIONAL_DEX_VENUSAUR] = KANTO_DEX_VENUSAUR,
+    [NATIONAL_DEX_CHARMANDER] = KANTO_DEX_CHARMANDER,
+    [NATIONAL_DEX_CHARMELEON] = KANTO_DEX_CHARMELEON,
+    [NATIONAL_DEX_CHARIZARD] = KANTO_DEX_CHARIZARD,
+    [NATIONAL_DEX_SQUIRTLE] = KANTO_DEX_SQUIRTLE,
+    [NATIONAL_DEX_WARTORTLE] = KANTO_DEX_WARTORTLE,
+    [NATIONAL_DEX_BLASTOISE] = KANTO_DEX_BLASTOISE,
+    [NATIONAL_DEX_CATERPIE] = KANTO_DEX_CATERPIE,
+    [NATIONAL_DEX_METAPOD] = KANTO_DEX_METAPOD,
+    [NATIONAL_DEX_BUTTERFREE] = KANTO_DEX_BUTTERFREE,
+    [NATIONAL_DEX_WEEDLE] = KANTO_DEX_WEEDLE,
+    [NATIONAL_DEX_KAKUNA] = KANTO_DEX_KAKUNA,
+    [NATIONAL_DEX_BEEDRILL] = KANTO_DEX_BEEDRILL,
+    [NATIONAL_DEX_PIDGEY] = KANTO_DEX_PIDGEY,
+    [NATIONAL_DEX_PIDGEOTTO] = KANTO_DEX_PIDGEOTTO,
+    [NATIONAL_DEX_PIDGEOT] = KANTO_DEX_PIDGEOT,
+    [NATIONAL_DEX_RATTATA] = KANTO_DEX_RATTATA,
+    [NATIONAL_DEX_RATICATE] = KANTO_DEX_RATICATE,
+    [NATIONAL_DEX_SPEAROW] = KANTO_DEX_SPEAROW,
+    [NATIONAL_DEX_FEAROW] = KANTO_DEX_FEAROW,
+    [NATIONAL_DEX_EKANS] = KANTO_DEX_EKANS,
+    [NATIONAL_DEX_ARBOK] = KANTO_DEX_ARBOK,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_PICHU] = KANTO_DEX_PICHU,
+#endif
+    [NATIONAL_DEX_PIKACHU] = KANTO_DEX_PIKACHU,
+    [NATIONAL_DEX_RAICHU] = KANTO_DEX_RAICHU,
+    [NATIONAL_DEX_SANDSHREW] = KANTO_DEX_SANDSHREW,
+    [NATIONAL_DEX_SANDSLASH] = KANTO_DEX_SANDSLASH,
+    [NATIONAL_DEX_NIDORAN_F] = KANTO_DEX_NIDORAN_F,
+    [NATIONAL_DEX_NIDORINA] = KANTO_DEX_NIDORINA,
+    [NATIONAL_DEX_NIDOQUEEN] = KANTO_DEX_NIDOQUEEN,
+    [NATIONAL_DEX_NIDORAN_M] = KANTO_DEX_NIDORAN_M,
+    [NATIONAL_DEX_NIDORINO] = KANTO_DEX_NIDORINO,
+    [NATIONAL_DEX_NIDOKING] = KANTO_DEX_NIDOKING,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_CLEFFA] = KANTO_DEX_CLEFFA,
+#endif
+    [NATIONAL_DEX_CLEFAIRY] = KANTO_DEX_CLEFAIRY,
+    [NATIONAL_DEX_CLEFABLE] = KANTO_DEX_CLEFABLE,
+    [NATIONAL_DEX_VULPIX] = KANTO_DEX_VULPIX,
+    [NATIONAL_DEX_NINETALES] = KANTO_DEX_NINETALES,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_IGGLYBUFF] = KANTO_DEX_IGGLYBUFF,
+#endif
+    [NATIONAL_DEX_JIGGLYPUFF] = KANTO_DEX_JIGGLYPUFF,
+    [NATIONAL_DEX_WIGGLYTUFF] = KANTO_DEX_WIGGLYTUFF,
+    [NATIONAL_DEX_ZUBAT] = KANTO_DEX_ZUBAT,
+    [NATIONAL_DEX_GOLBAT] = KANTO_DEX_GOLBAT,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_CROBAT] = KANTO_DEX_CROBAT,
+#endif
+    [NATIONAL_DEX_ODDISH] = KANTO_DEX_ODDISH,
+    [NATIONAL_DEX_GLOOM] = KANTO_DEX_GLOOM,
+    [NATIONAL_DEX_VILEPLUME] = KANTO_DEX_VILEPLUME,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_BELLOSSOM] = KANTO_DEX_BELLOSSOM,
+#endif
+    [NATIONAL_DEX_PARAS] = KANTO_DEX_PARAS,
+    [NATIONAL_DEX_PARASECT] = KANTO_DEX_PARASECT,
+    [NATIONAL_DEX_VENONAT] = KANTO_DEX_VENONAT,
+    [NATIONAL_DEX_VENOMOTH] = KANTO_DEX_VENOMOTH,
+    [NATIONAL_DEX_DIGLETT] = KANTO_DEX_DIGLETT,
+    [NATIONAL_DEX_DUGTRIO] = KANTO_DEX_DUGTRIO,
+    [NATIONAL_DEX_MEOWTH] = KANTO_DEX_MEOWTH,
+    [NATIONAL_DEX_PERSIAN] = KANTO_DEX_PERSIAN,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GALARIAN_FORMS)
+    [NATIONAL_DEX_PERRSERKER] = KANTO_DEX_PERRSERKER,
+#endif
+    [NATIONAL_DEX_PSYDUCK] = KANTO_DEX_PSYDUCK,
+    [NATIONAL_DEX_GOLDUCK] = KANTO_DEX_GOLDUCK,
+    [NATIONAL_DEX_MANKEY] = KANTO_DEX_MANKEY,
+    [NATIONAL_DEX_PRIMEAPE] = KANTO_DEX_PRIMEAPE,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_ANNIHILAPE] = KANTO_DEX_ANNIHILAPE,
+#endif
+    [NATIONAL_DEX_GROWLITHE] = KANTO_DEX_GROWLITHE,
+    [NATIONAL_DEX_ARCANINE] = KANTO_DEX_ARCANINE,
+    [NATIONAL_DEX_POLIWAG] = KANTO_DEX_POLIWAG,
+    [NATIONAL_DEX_POLIWHIRL] = KANTO_DEX_POLIWHIRL,
+    [NATIONAL_DEX_POLIWRATH] = KANTO_DEX_POLIWRATH,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_POLITOED] = KANTO_DEX_POLITOED,
+#endif
+    [NATIONAL_DEX_ABRA] = KANTO_DEX_ABRA,
+    [NATIONAL_DEX_KADABRA] = KANTO_DEX_KADABRA,
+    [NATIONAL_DEX_ALAKAZAM] = KANTO_DEX_ALAKAZAM,
+    [NATIONAL_DEX_MACHOP] = KANTO_DEX_MACHOP,
+    [NATIONAL_DEX_MACHOKE] = KANTO_DEX_MACHOKE,
+    [NATIONAL_DEX_MACHAMP] = KANTO_DEX_MACHAMP,
+    [NATIONAL_DEX_BELLSPROUT] = KANTO_DEX_BELLSPROUT,
+    [NATIONAL_DEX_WEEPINBELL] = KANTO_DEX_WEEPINBELL,
+    [NATIONAL_DEX_VICTREEBEL] = KANTO_DEX_VICTREEBEL,
+    [NATIONAL_DEX_TENTACOOL] = KANTO_DEX_TENTACOOL,
+    [NATIONAL_DEX_TENTACRUEL] = KANTO_DEX_TENTACRUEL,
+    [NATIONAL_DEX_GEODUDE] = KANTO_DEX_GEODUDE,
+    [NATIONAL_DEX_GRAVELER] = KANTO_DEX_GRAVELER,
+    [NATIONAL_DEX_GOLEM] = KANTO_DEX_GOLEM,
+    [NATIONAL_DEX_PONYTA] = KANTO_DEX_PONYTA,
+    [NATIONAL_DEX_RAPIDASH] = KANTO_DEX_RAPIDASH,
+    [NATIONAL_DEX_SLOWPOKE] = KANTO_DEX_SLOWPOKE,
+    [NATIONAL_DEX_SLOWBRO] = KANTO_DEX_SLOWBRO,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SLOWKING] = KANTO_DEX_SLOWKING,
+#endif
+    [NATIONAL_DEX_MAGNEMITE] = KANTO_DEX_MAGNEMITE,
+    [NATIONAL_DEX_MAGNETON] = KANTO_DEX_MAGNETON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAGNEZONE] = KANTO_DEX_MAGNEZONE,
+#endif
+    [NATIONAL_DEX_FARFETCHD] = KANTO_DEX_FARFETCHD,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GALARIAN_FORMS)
+    [NATIONAL_DEX_SIRFETCHD] = KANTO_DEX_SIRFETCHD,
+#endif
+    [NATIONAL_DEX_DODUO] = KANTO_DEX_DODUO,
+    [NATIONAL_DEX_DODRIO] = KANTO_DEX_DODRIO,
+    [NATIONAL_DEX_SEEL] = KANTO_DEX_SEEL,
+    [NATIONAL_DEX_DEWGONG] = KANTO_DEX_DEWGONG,
+    [NATIONAL_DEX_GRIMER] = KANTO_DEX_GRIMER,
+    [NATIONAL_DEX_MUK] = KANTO_DEX_MUK,
+    [NATIONAL_DEX_SHELLDER] = KANTO_DEX_SHELLDER,
+    [NATIONAL_DEX_CLOYSTER] = KANTO_DEX_CLOYSTER,
+    [NATIONAL_DEX_GASTLY] = KANTO_DEX_GASTLY,
+    [NATIONAL_DEX_HAUNTER] = KANTO_DEX_HAUNTER,
+    [NATIONAL_DEX_GENGAR] = KANTO_DEX_GENGAR,
+    [NATIONAL_DEX_ONIX] = KANTO_DEX_ONIX,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_STEELIX] = KANTO_DEX_STEELIX,
+#endif
+    [NATIONAL_DEX_DROWZEE] = KANTO_DEX_DROWZEE,
+    [NATIONAL_DEX_HYPNO] = KANTO_DEX_HYPNO,
+    [NATIONAL_DEX_KRABBY] = KANTO_DEX_KRABBY,
+    [NATIONAL_DEX_KINGLER] = KANTO_DEX_KINGLER,
+    [NATIONAL_DEX_VOLTORB] = KANTO_DEX_VOLTORB,
+    [NATIONAL_DEX_ELECTRODE] = KANTO_DEX_ELECTRODE,
+    [NATIONAL_DEX_EXEGGCUTE] = KANTO_DEX_EXEGGCUTE,
+    [NATIONAL_DEX_EXEGGUTOR] = KANTO_DEX_EXEGGUTOR,
+    [NATIONAL_DEX_CUBONE] = KANTO_DEX_CUBONE,
+    [NATIONAL_DEX_MAROWAK] = KANTO_DEX_MAROWAK,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_TYROGUE] = KANTO_DEX_TYROGUE,
+#endif
+    [NATIONAL_DEX_HITMONLEE] = KANTO_DEX_HITMONLEE,
+    [NATIONAL_DEX_HITMONCHAN] = KANTO_DEX_HITMONCHAN,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_HITMONTOP] = KANTO_DEX_HITMONTOP,
+#endif
+    [NATIONAL_DEX_LICKITUNG] = KANTO_DEX_LICKITUNG,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_LICKILICKY] = KANTO_DEX_LICKILICKY,
+#endif
+    [NATIONAL_DEX_KOFFING] = KANTO_DEX_KOFFING,
+    [NATIONAL_DEX_WEEZING] = KANTO_DEX_WEEZING,
+    [NATIONAL_DEX_RHYHORN] = KANTO_DEX_RHYHORN,
+    [NATIONAL_DEX_RHYDON] = KANTO_DEX_RHYDON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_RHYPERIOR] = KANTO_DEX_RHYPERIOR,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_HAPPINY] = KANTO_DEX_HAPPINY,
+#endif
+    [NATIONAL_DEX_CHANSEY] = KANTO_DEX_CHANSEY,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_BLISSEY] = KANTO_DEX_BLISSEY,
+#endif
+    [NATIONAL_DEX_TANGELA] = KANTO_DEX_TANGELA,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_TANGROWTH] = KANTO_DEX_TANGROWTH,
+#endif
+    [NATIONAL_DEX_KANGASKHAN] = KANTO_DEX_KANGASKHAN,
+    [NATIONAL_DEX_HORSEA] = KANTO_DEX_HORSEA,
+    [NATIONAL_DEX_SEADRA] = KANTO_DEX_SEADRA,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_KINGDRA] = KANTO_DEX_KINGDRA,
+#endif
+    [NATIONAL_DEX_GOLDEEN] = KANTO_DEX_GOLDEEN,
+    [NATIONAL_DEX_SEAKING] = KANTO_DEX_SEAKING,
+    [NATIONAL_DEX_STARYU] = KANTO_DEX_STARYU,
+    [NATIONAL_DEX_STARMIE] = KANTO_DEX_STARMIE,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MIME_JR] = KANTO_DEX_MIME_JR,
+#endif
+    [NATIONAL_DEX_MR_MIME] = KANTO_DEX_MR_MIME,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GALARIAN_FORMS)
+    [NATIONAL_DEX_MR_RIME] = KANTO_DEX_MR_RIME,
+#endif
+    [NATIONAL_DEX_SCYTHER] = KANTO_DEX_SCYTHER,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SCIZOR] = KANTO_DEX_SCIZOR,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_8_CROSS_EVOS)
+    [NATIONAL_DEX_KLEAVOR] = KANTO_DEX_KLEAVOR,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_SMOOCHUM] = KANTO_DEX_SMOOCHUM,
+#endif
+    [NATIONAL_DEX_JYNX] = KANTO_DEX_JYNX,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_ELEKID] = KANTO_DEX_ELEKID,
+#endif
+    [NATIONAL_DEX_ELECTABUZZ] = KANTO_DEX_ELECTABUZZ,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ELECTIVIRE] = KANTO_DEX_ELECTIVIRE,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_MAGBY] = KANTO_DEX_MAGBY,
+#endif
+    [NATIONAL_DEX_MAGMAR] = KANTO_DEX_MAGMAR,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAGMORTAR] = KANTO_DEX_MAGMORTAR,
+#endif
+    [NATIONAL_DEX_PINSIR] = KANTO_DEX_PINSIR,
+    [NATIONAL_DEX_TAUROS] = KANTO_DEX_TAUROS,
+    [NATIONAL_DEX_MAGIKARP] = KANTO_DEX_MAGIKARP,
+    [NATIONAL_DEX_GYARADOS] = KANTO_DEX_GYARADOS,
+    [NATIONAL_DEX_LAPRAS] = KANTO_DEX_LAPRAS,
+    [NATIONAL_DEX_DITTO] = KANTO_DEX_DITTO,
+    [NATIONAL_DEX_EEVEE] = KANTO_DEX_EEVEE,
+    [NATIONAL_DEX_VAPOREON] = KANTO_DEX_VAPOREON,
+    [NATIONAL_DEX_JOLTEON] = KANTO_DEX_JOLTEON,
+    [NATIONAL_DEX_FLAREON] = KANTO_DEX_FLAREON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_ESPEON] = KANTO_DEX_ESPEON,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_UMBREON] = KANTO_DEX_UMBREON,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_LEAFEON] = KANTO_DEX_LEAFEON,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_GLACEON] = KANTO_DEX_GLACEON,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_6_CROSS_EVOS)
+    [NATIONAL_DEX_SYLVEON] = KANTO_DEX_SYLVEON,
+#endif
+    [NATIONAL_DEX_PORYGON] = KANTO_DEX_PORYGON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_2_CROSS_EVOS)
+    [NATIONAL_DEX_PORYGON2] = KANTO_DEX_PORYGON2,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_PORYGON_Z] = KANTO_DEX_PORYGON_Z,
+#endif
+    [NATIONAL_DEX_OMANYTE] = KANTO_DEX_OMANYTE,
+    [NATIONAL_DEX_OMASTAR] = KANTO_DEX_OMASTAR,
+    [NATIONAL_DEX_KABUTO] = KANTO_DEX_KABUTO,
+    [NATIONAL_DEX_KABUTOPS] = KANTO_DEX_KABUTOPS,
+    [NATIONAL_DEX_AERODACTYL] = KANTO_DEX_AERODACTYL,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MUNCHLAX] = KANTO_DEX_MUNCHLAX,
+#endif
+    [NATIONAL_DEX_SNORLAX] = KANTO_DEX_SNORLAX,
+    [NATIONAL_DEX_ARTICUNO] = KANTO_DEX_ARTICUNO,
+    [NATIONAL_DEX_ZAPDOS] = KANTO_DEX_ZAPDOS,
+    [NATIONAL_DEX_MOLTRES] = KANTO_DEX_MOLTRES,
+    [NATIONAL_DEX_DRATINI] = KANTO_DEX_DRATINI,
+    [NATIONAL_DEX_DRAGONAIR] = KANTO_DEX_DRAGONAIR,
+    [NATIONAL_DEX_DRAGONITE] = KANTO_DEX_DRAGONITE,
+    [NATIONAL_DEX_MEWTWO] = KANTO_DEX_MEWTWO,
+    [NATIONAL_DEX_MEW] = KANTO_DEX_MEW,
+};
+
+static const u16 sNationalToHoennDexNum[NATIONAL_DEX_END] =
+{
+    [NATIONAL_DEX_TREECKO] = HOENN_DEX_TREECKO,
+    [NATIONAL_DEX_GROVYLE] = HOENN_DEX_GROVYLE,
+    [NATIONAL_DEX_SCEPTILE] = HOENN_DEX_SCEPTILE,
+    [NATIONAL_DEX_TORCHIC] = HOENN_DEX_TORCHIC,
+    [NATIONAL_DEX_COMBUSKEN] = HOENN_DEX_COMBUSKEN,
+    [NATIONAL_DEX_BLAZIKEN] = HOENN_DEX_BLAZIKEN,
+    [NATIONAL_DEX_MUDKIP] = HOENN_DEX_MUDKIP,
+    [NATIONAL_DEX_MARSHTOMP] = HOENN_DEX_MARSHTOMP,
+    [NATIONAL_DEX_SWAMPERT] = HOENN_DEX_SWAMPERT,
+    [NATIONAL_DEX_POOCHYENA] = HOENN_DEX_POOCHYENA,
+    [NATIONAL_DEX_MIGHTYENA] = HOENN_DEX_MIGHTYENA,
+    [NATIONAL_DEX_ZIGZAGOON] = HOENN_DEX_ZIGZAGOON,
+    [NATIONAL_DEX_LINOONE] = HOENN_DEX_LINOONE,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GALARIAN_FORMS)
+    [NATIONAL_DEX_OBSTAGOON] = HOENN_DEX_OBSTAGOON,
+#endif
+    [NATIONAL_DEX_WURMPLE] = HOENN_DEX_WURMPLE,
+    [NATIONAL_DEX_SILCOON] = HOENN_DEX_SILCOON,
+    [NATIONAL_DEX_BEAUTIFLY] = HOENN_DEX_BEAUTIFLY,
+    [NATIONAL_DEX_CASCOON] = HOENN_DEX_CASCOON,
+    [NATIONAL_DEX_DUSTOX] = HOENN_DEX_DUSTOX,
+    [NATIONAL_DEX_LOTAD] = HOENN_DEX_LOTAD,
+    [NATIONAL_DEX_LOMBRE] = HOENN_DEX_LOMBRE,
+    [NATIONAL_DEX_LUDICOLO] = HOENN_DEX_LUDICOLO,
+    [NATIONAL_DEX_SEEDOT] = HOENN_DEX_SEEDOT,
+    [NATIONAL_DEX_NUZLEAF] = HOENN_DEX_NUZLEAF,
+    [NATIONAL_DEX_SHIFTRY] = HOENN_DEX_SHIFTRY,
+    [NATIONAL_DEX_TAILLOW] = HOENN_DEX_TAILLOW,
+    [NATIONAL_DEX_SWELLOW] = HOENN_DEX_SWELLOW,
+    [NATIONAL_DEX_WINGULL] = HOENN_DEX_WINGULL,
+    [NATIONAL_DEX_PELIPPER] = HOENN_DEX_PELIPPER,
+    [NATIONAL_DEX_RALTS] = HOENN_DEX_RALTS,
+    [NATIONAL_DEX_KIRLIA] = HOENN_DEX_KIRLIA,
+    [NATIONAL_DEX_GARDEVOIR] = HOENN_DEX_GARDEVOIR,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_GALLADE] = HOENN_DEX_GALLADE,
+#endif
+    [NATIONAL_DEX_SURSKIT] = HOENN_DEX_SURSKIT,
+    [NATIONAL_DEX_MASQUERAIN] = HOENN_DEX_MASQUERAIN,
+    [NATIONAL_DEX_SHROOMISH] = HOENN_DEX_SHROOMISH,
+    [NATIONAL_DEX_BRELOOM] = HOENN_DEX_BRELOOM,
+    [NATIONAL_DEX_SLAKOTH] = HOENN_DEX_SLAKOTH,
+    [NATIONAL_DEX_VIGOROTH] = HOENN_DEX_VIGOROTH,
+    [NATIONAL_DEX_SLAKING] = HOENN_DEX_SLAKING,
+    [NATIONAL_DEX_ABRA] = HOENN_DEX_ABRA,
+    [NATIONAL_DEX_KADABRA] = HOENN_DEX_KADABRA,
+    [NATIONAL_DEX_ALAKAZAM] = HOENN_DEX_ALAKAZAM,
+    [NATIONAL_DEX_NINCADA] = HOENN_DEX_NINCADA,
+    [NATIONAL_DEX_NINJASK] = HOENN_DEX_NINJASK,
+    [NATIONAL_DEX_SHEDINJA] = HOENN_DEX_SHEDINJA,
+    [NATIONAL_DEX_WHISMUR] = HOENN_DEX_WHISMUR,
+    [NATIONAL_DEX_LOUDRED] = HOENN_DEX_LOUDRED,
+    [NATIONAL_DEX_EXPLOUD] = HOENN_DEX_EXPLOUD,
+    [NATIONAL_DEX_MAKUHITA] = HOENN_DEX_MAKUHITA,
+    [NATIONAL_DEX_HARIYAMA] = HOENN_DEX_HARIYAMA,
+    [NATIONAL_DEX_GOLDEEN] = HOENN_DEX_GOLDEEN,
+    [NATIONAL_DEX_SEAKING] = HOENN_DEX_SEAKING,
+    [NATIONAL_DEX_MAGIKARP] = HOENN_DEX_MAGIKARP,
+    [NATIONAL_DEX_GYARADOS] = HOENN_DEX_GYARADOS,
+    [NATIONAL_DEX_AZURILL] = HOENN_DEX_AZURILL,
+    [NATIONAL_DEX_MARILL] = HOENN_DEX_MARILL,
+    [NATIONAL_DEX_AZUMARILL] = HOENN_DEX_AZUMARILL,
+    [NATIONAL_DEX_GEODUDE] = HOENN_DEX_GEODUDE,
+    [NATIONAL_DEX_GRAVELER] = HOENN_DEX_GRAVELER,
+    [NATIONAL_DEX_GOLEM] = HOENN_DEX_GOLEM,
+    [NATIONAL_DEX_NOSEPASS] = HOENN_DEX_NOSEPASS,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_PROBOPASS] = HOENN_DEX_PROBOPASS,
+#endif
+    [NATIONAL_DEX_SKITTY] = HOENN_DEX_SKITTY,
+    [NATIONAL_DEX_DELCATTY] = HOENN_DEX_DELCATTY,
+    [NATIONAL_DEX_ZUBAT] = HOENN_DEX_ZUBAT,
+    [NATIONAL_DEX_GOLBAT] = HOENN_DEX_GOLBAT,
+    [NATIONAL_DEX_CROBAT] = HOENN_DEX_CROBAT,
+    [NATIONAL_DEX_TENTACOOL] = HOENN_DEX_TENTACOOL,
+    [NATIONAL_DEX_TENTACRUEL] = HOENN_DEX_TENTACRUEL,
+    [NATIONAL_DEX_SABLEYE] = HOENN_DEX_SABLEYE,
+    [NATIONAL_DEX_MAWILE] = HOENN_DEX_MAWILE,
+    [NATIONAL_DEX_ARON] = HOENN_DEX_ARON,
+    [NATIONAL_DEX_LAIRON] = HOENN_DEX_LAIRON,
+    [NATIONAL_DEX_AGGRON] = HOENN_DEX_AGGRON,
+    [NATIONAL_DEX_MACHOP] = HOENN_DEX_MACHOP,
+    [NATIONAL_DEX_MACHOKE] = HOENN_DEX_MACHOKE,
+    [NATIONAL_DEX_MACHAMP] = HOENN_DEX_MACHAMP,
+    [NATIONAL_DEX_MEDITITE] = HOENN_DEX_MEDITITE,
+    [NATIONAL_DEX_MEDICHAM] = HOENN_DEX_MEDICHAM,
+    [NATIONAL_DEX_ELECTRIKE] = HOENN_DEX_ELECTRIKE,
+    [NATIONAL_DEX_MANECTRIC] = HOENN_DEX_MANECTRIC,
+    [NATIONAL_DEX_PLUSLE] = HOENN_DEX_PLUSLE,
+    [NATIONAL_DEX_MINUN] = HOENN_DEX_MINUN,
+    [NATIONAL_DEX_MAGNEMITE] = HOENN_DEX_MAGNEMITE,
+    [NATIONAL_DEX_MAGNETON] = HOENN_DEX_MAGNETON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_MAGNEZONE] = HOENN_DEX_MAGNEZONE,
+#endif
+    [NATIONAL_DEX_VOLTORB] = HOENN_DEX_VOLTORB,
+    [NATIONAL_DEX_ELECTRODE] = HOENN_DEX_ELECTRODE,
+    [NATIONAL_DEX_VOLBEAT] = HOENN_DEX_VOLBEAT,
+    [NATIONAL_DEX_ILLUMISE] = HOENN_DEX_ILLUMISE,
+    [NATIONAL_DEX_ODDISH] = HOENN_DEX_ODDISH,
+    [NATIONAL_DEX_GLOOM] = HOENN_DEX_GLOOM,
+    [NATIONAL_DEX_VILEPLUME] = HOENN_DEX_VILEPLUME,
+    [NATIONAL_DEX_BELLOSSOM] = HOENN_DEX_BELLOSSOM,
+    [NATIONAL_DEX_DODUO] = HOENN_DEX_DODUO,
+    [NATIONAL_DEX_DODRIO] = HOENN_DEX_DODRIO,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_BUDEW] = HOENN_DEX_BUDEW,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ROSELIA] = HOENN_DEX_ROSELIA,
+#elif !(P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ROSELIA] = HOENN_DEX_ROSELIA,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_ROSERADE] = HOENN_DEX_ROSERADE,
+#endif
+    [NATIONAL_DEX_GULPIN] = HOENN_DEX_GULPIN,
+    [NATIONAL_DEX_SWALOT] = HOENN_DEX_SWALOT,
+    [NATIONAL_DEX_CARVANHA] = HOENN_DEX_CARVANHA,
+    [NATIONAL_DEX_SHARPEDO] = HOENN_DEX_SHARPEDO,
+    [NATIONAL_DEX_WAILMER] = HOENN_DEX_WAILMER,
+    [NATIONAL_DEX_WAILORD] = HOENN_DEX_WAILORD,
+    [NATIONAL_DEX_NUMEL] = HOENN_DEX_NUMEL,
+    [NATIONAL_DEX_CAMERUPT] = HOENN_DEX_CAMERUPT,
+    [NATIONAL_DEX_SLUGMA] = HOENN_DEX_SLUGMA,
+    [NATIONAL_DEX_MAGCARGO] = HOENN_DEX_MAGCARGO,
+    [NATIONAL_DEX_TORKOAL] = HOENN_DEX_TORKOAL,
+    [NATIONAL_DEX_GRIMER] = HOENN_DEX_GRIMER,
+    [NATIONAL_DEX_MUK] = HOENN_DEX_MUK,
+    [NATIONAL_DEX_KOFFING] = HOENN_DEX_KOFFING,
+    [NATIONAL_DEX_WEEZING] = HOENN_DEX_WEEZING,
+    [NATIONAL_DEX_SPOINK] = HOENN_DEX_SPOINK,
+    [NATIONAL_DEX_GRUMPIG] = HOENN_DEX_GRUMPIG,
+    [NATIONAL_DEX_SANDSHREW] = HOENN_DEX_SANDSHREW,
+    [NATIONAL_DEX_SANDSLASH] = HOENN_DEX_SANDSLASH,
+    [NATIONAL_DEX_SPINDA] = HOENN_DEX_SPINDA,
+    [NATIONAL_DEX_SKARMORY] = HOENN_DEX_SKARMORY,
+    [NATIONAL_DEX_TRAPINCH] = HOENN_DEX_TRAPINCH,
+    [NATIONAL_DEX_VIBRAVA] = HOENN_DEX_VIBRAVA,
+    [NATIONAL_DEX_FLYGON] = HOENN_DEX_FLYGON,
+    [NATIONAL_DEX_CACNEA] = HOENN_DEX_CACNEA,
+    [NATIONAL_DEX_CACTURNE] = HOENN_DEX_CACTURNE,
+    [NATIONAL_DEX_SWABLU] = HOENN_DEX_SWABLU,
+    [NATIONAL_DEX_ALTARIA] = HOENN_DEX_ALTARIA,
+    [NATIONAL_DEX_ZANGOOSE] = HOENN_DEX_ZANGOOSE,
+    [NATIONAL_DEX_SEVIPER] = HOENN_DEX_SEVIPER,
+    [NATIONAL_DEX_LUNATONE] = HOENN_DEX_LUNATONE,
+    [NATIONAL_DEX_SOLROCK] = HOENN_DEX_SOLROCK,
+    [NATIONAL_DEX_BARBOACH] = HOENN_DEX_BARBOACH,
+    [NATIONAL_DEX_WHISCASH] = HOENN_DEX_WHISCASH,
+    [NATIONAL_DEX_CORPHISH] = HOENN_DEX_CORPHISH,
+    [NATIONAL_DEX_CRAWDAUNT] = HOENN_DEX_CRAWDAUNT,
+    [NATIONAL_DEX_BALTOY] = HOENN_DEX_BALTOY,
+    [NATIONAL_DEX_CLAYDOL] = HOENN_DEX_CLAYDOL,
+    [NATIONAL_DEX_LILEEP] = HOENN_DEX_LILEEP,
+    [NATIONAL_DEX_CRADILY] = HOENN_DEX_CRADILY,
+    [NATIONAL_DEX_ANORITH] = HOENN_DEX_ANORITH,
+    [NATIONAL_DEX_ARMALDO] = HOENN_DEX_ARMALDO,
+    [NATIONAL_DEX_IGGLYBUFF] = HOENN_DEX_IGGLYBUFF,
+    [NATIONAL_DEX_JIGGLYPUFF] = HOENN_DEX_JIGGLYPUFF,
+    [NATIONAL_DEX_WIGGLYTUFF] = HOENN_DEX_WIGGLYTUFF,
+    [NATIONAL_DEX_FEEBAS] = HOENN_DEX_FEEBAS,
+    [NATIONAL_DEX_MILOTIC] = HOENN_DEX_MILOTIC,
+    [NATIONAL_DEX_CASTFORM] = HOENN_DEX_CASTFORM,
+    [NATIONAL_DEX_STARYU] = HOENN_DEX_STARYU,
+    [NATIONAL_DEX_STARMIE] = HOENN_DEX_STARMIE,
+    [NATIONAL_DEX_KECLEON] = HOENN_DEX_KECLEON,
+    [NATIONAL_DEX_SHUPPET] = HOENN_DEX_SHUPPET,
+    [NATIONAL_DEX_BANETTE] = HOENN_DEX_BANETTE,
+    [NATIONAL_DEX_DUSKULL] = HOENN_DEX_DUSKULL,
+    [NATIONAL_DEX_DUSCLOPS] = HOENN_DEX_DUSCLOPS,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_DUSKNOIR] = HOENN_DEX_DUSKNOIR,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_TROPIUS] = HOENN_DEX_TROPIUS,
+#elif !(P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_TROPIUS] = HOENN_DEX_TROPIUS,
+#endif
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_CHINGLING] = HOENN_DEX_CHINGLING,
+#endif
+    [NATIONAL_DEX_CHIMECHO] = HOENN_DEX_CHIMECHO,
+    [NATIONAL_DEX_ABSOL] = HOENN_DEX_ABSOL,
+    [NATIONAL_DEX_VULPIX] = HOENN_DEX_VULPIX,
+    [NATIONAL_DEX_NINETALES] = HOENN_DEX_NINETALES,
+    [NATIONAL_DEX_PICHU] = HOENN_DEX_PICHU,
+    [NATIONAL_DEX_PIKACHU] = HOENN_DEX_PIKACHU,
+    [NATIONAL_DEX_RAICHU] = HOENN_DEX_RAICHU,
+    [NATIONAL_DEX_PSYDUCK] = HOENN_DEX_PSYDUCK,
+    [NATIONAL_DEX_GOLDUCK] = HOENN_DEX_GOLDUCK,
+    [NATIONAL_DEX_WYNAUT] = HOENN_DEX_WYNAUT,
+    [NATIONAL_DEX_WOBBUFFET] = HOENN_DEX_WOBBUFFET,
+    [NATIONAL_DEX_NATU] = HOENN_DEX_NATU,
+    [NATIONAL_DEX_XATU] = HOENN_DEX_XATU,
+    [NATIONAL_DEX_GIRAFARIG] = HOENN_DEX_GIRAFARIG,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_9_CROSS_EVOS)
+    [NATIONAL_DEX_FARIGIRAF] = HOENN_DEX_FARIGIRAF,
+#endif
+    [NATIONAL_DEX_PHANPY] = HOENN_DEX_PHANPY,
+    [NATIONAL_DEX_DONPHAN] = HOENN_DEX_DONPHAN,
+    [NATIONAL_DEX_PINSIR] = HOENN_DEX_PINSIR,
+    [NATIONAL_DEX_HERACROSS] = HOENN_DEX_HERACROSS,
+    [NATIONAL_DEX_RHYHORN] = HOENN_DEX_RHYHORN,
+    [NATIONAL_DEX_RHYDON] = HOENN_DEX_RHYDON,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_RHYPERIOR] = HOENN_DEX_RHYPERIOR,
+#endif
+    [NATIONAL_DEX_SNORUNT] = HOENN_DEX_SNORUNT,
+    [NATIONAL_DEX_GLALIE] = HOENN_DEX_GLALIE,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GEN_4_CROSS_EVOS)
+    [NATIONAL_DEX_FROSLASS] = HOENN_DEX_FROSLASS,
+#endif
+    [NATIONAL_DEX_SPHEAL] = HOENN_DEX_SPHEAL,
+    [NATIONAL_DEX_SEALEO] = HOENN_DEX_SEALEO,
+    [NATIONAL_DEX_WALREIN] = HOENN_DEX_WALREIN,
+    [NATIONAL_DEX_CLAMPERL] = HOENN_DEX_CLAMPERL,
+    [NATIONAL_DEX_HUNTAIL] = HOENN_DEX_HUNTAIL,
+    [NATIONAL_DEX_GOREBYSS] = HOENN_DEX_GOREBYSS,
+    [NATIONAL_DEX_RELICANTH] = HOENN_DEX_RELICANTH,
+    [NATIONAL_DEX_CORSOLA] = HOENN_DEX_CORSOLA,
+#if (P_NEW_EVOS_IN_REGIONAL_DEX && P_GALARIAN_FORMS)
+    [NATIONAL_DEX_CURSOLA] = HOENN_DEX_CURSOLA,
+#endif
+    [NATIONAL_DEX_CHINCHOU] = HOENN_DEX_CHINCHOU,
+    [NATIONAL_DEX_LANTURN] = HOENN_DEX_LANTURN,
+    [NATIONAL_DEX_LUVDISC] = HOENN_DEX_LUVDISC,
+    [NATIONAL_DEX_HORSEA] = HOENN_DEX_HORSEA,
+    [NATIONAL_DEX_SEADRA] = HOENN_DEX_SEADRA,
+    [NATIONAL_DEX_KINGDRA] = HOENN_DEX_KINGDRA,
+    [NATIONAL_DEX_BAGON] = HOENN_DEX_BAGON,
+    [NATIONAL_DEX_SHELGON] = HOENN_DEX_SHELGON,
+    [NATIONAL_DEX_SALAMENCE] = HOENN_DEX_SALAMENCE,
+    [NATIONAL_DEX_BELDUM] = HOENN_DEX_BELDUM,
+    [NATIONAL_DEX_METANG] = HOENN_DEX_METANG,
+    [NATIONAL_DEX_METAGROSS] = HOENN_DEX_METAGROSS,
+    [NATIONAL_DEX_REGIROCK] = HOENN_DEX_REGIROCK,
+    [NATIONAL_DEX_REGICE] = HOENN_DEX_REGICE,
+    [NATIONAL_DEX_REGISTEEL] = HOENN_DEX_REGISTEEL,
+    [NATIONAL_DEX_LATIAS] = HOENN_DEX_LATIAS,
+    [NATIONAL_DEX_LATIOS] = HOENN_DEX_LATIOS,
+    [NATIONAL_DEX_KYOGRE] = HOENN_DEX_KYOGRE,
+    [NATIONAL_DEX_GROUDON] = HOENN_DEX_GROUDON,
+    [NATIONAL_DEX_RAYQUAZA] = HOENN_DEX_RAYQUAZA,
+    [NATIONAL_DEX_JIRACHI] = HOENN_DEX_JIRACHI,
+    [NATIONAL_DEX_DEOXYS] = HOENN_DEX_DEOXYS,
+};
@@ -0,0 +1,227 @@
+//
+// DO NOT MODIFY THIS FILE! It is auto-generated from src/data/region_map/region_map_sections.json and Inja template src/data/region_map/region_map_sections.json.txt
+//
+
+#ifndef GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
+#define GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
+
+
+static const u8 sMapName_PALLET_TOWN[] = _("PALLET TOWN");
+static const u8 sMapName_VIRIDIAN_CITY[] = _("VIRIDIAN CITY");
+static const u8 sMapName_PEWTER_CITY[] = _("PEWTER CITY");
+static const u8 sMapName_CERULEAN_CITY[] = _("CERULEAN CITY");
+static const u8 sMapName_LAVENDER_TOWN[] = _("LAVENDER TOWN");
+static const u8 sMapName_VERMILION_CITY[] = _("VERMILION CITY");
+static const u8 sMapName_CELADON_CITY[] = _("CELADON CITY");
+static const u8 sMapName_FUCHSIA_CITY[] = _("FUCHSIA CITY");
+static const u8 sMapName_CINNABAR_ISLAND[] = _("CINNABAR ISLAND");
+static const u8 sMapName_INDIGO_PLATEAU[] = _("INDIGO PLATEAU");
+static const u8 sMapName_SAFFRON_CITY[] = _("SAFFRON CITY");
+static const u8 sMapName_ROUTE_4[] = _("ROUTE 4");
+static const u8 sMapName_ROUTE_10[] = _("ROUTE 10");
+static const u8 sMapName_ROUTE_1[] = _("ROUTE 1");
+static const u8 sMapName_ROUTE_2[] = _("ROUTE 2");
+static const u8 sMapName_ROUTE_3[] = _("ROUTE 3");
+static const u8 sMapName_ROUTE_5[] = _("ROUTE 5");
+static const u8 sMapName_ROUTE_6[] = _("ROUTE 6");
+static const u8 sMapName_ROUTE_7[] = _("ROUTE 7");
+static const u8 sMapName_ROUTE_8[] = _("ROUTE 8");
+static const u8 sMapName_ROUTE_9[] = _("ROUTE 9");
+static const u8 sMapName_ROUTE_11[] = _("ROUTE 11");
+static const u8 sMapName_ROUTE_12[] = _("ROUTE 12");
+static const u8 sMapName_ROUTE_13[] = _("ROUTE 13");
+static const u8 sMapName_ROUTE_14[] = _("ROUTE 14");
+static const u8 sMapName_ROUTE_15[] = _("ROUTE 15");
+static const u8 sMapName_ROUTE_16[] = _("ROUTE 16");
+static const u8 sMapName_ROUTE_17[] = _("ROUTE 17");
+static const u8 sMapName_ROUTE_18[] = _("ROUTE 18");
+static const u8 sMapName_ROUTE_19[] = _("ROUTE 19");
+static const u8 sMapName_ROUTE_20[] = _("ROUTE 20");
+static const u8 sMapName_ROUTE_21[] = _("ROUTE 21");
+static const u8 sMapName_ROUTE_22[] = _("ROUTE 22");
+static const u8 sMapName_ROUTE_23[] = _("ROUTE 23");
+static const u8 sMapName_ROUTE_24[] = _("ROUTE 24");
+static const u8 sMapName_ROUTE_25[] = _("ROUTE 25");
+static const u8 sMapName_VIRIDIAN_FOREST[] = _("VIRIDIAN FOREST");
+static const u8 sMapName_MT__MOON[] = _("MT. MOON");
+static const u8 sMapName_S_S__ANNE[] = _("S.S. ANNE");
+static const u8 sMapName_UNDERGROUND_PATH[] = _("UNDERGROUND PATH");
+static const u8 sMapName_DIGLETT_S_CAVE[] = _("DIGLETT'S CAVE");
+static const u8 sMapName_VICTORY_ROAD[] = _("VICTORY ROAD");
+static const u8 sMapName_ROCKET_HIDEOUT[] = _("ROCKET HIDEOUT");
+static const u8 sMapName_SILPH_CO_[] = _("SILPH CO.");
+static const u8 sMapName_POK__MON_MANSION[] = _("POKéMON MANSION");
+static const u8 sMapName_SAFARI_ZONE[] = _("SAFARI ZONE");
+static const u8 sMapName_POK__MON_LEAGUE[] = _("POKéMON LEAGUE");
+static const u8 sMapName_ROCK_TUNNEL[] = _("ROCK TUNNEL");
+static const u8 sMapName_SEAFOAM_ISLANDS[] = _("SEAFOAM ISLANDS");
+static const u8 sMapName_POK__MON_TOWER[] = _("POKéMON TOWER");
+static const u8 sMapName_CERULEAN_CAVE[] = _("CERULEAN CAVE");
+static const u8 sMapName_POWER_PLANT[] = _("POWER PLANT");
+static const u8 sMapName_ONE_ISLAND[] = _("ONE ISLAND");
+static const u8 sMapName_TWO_ISLAND[] = _("TWO ISLAND");
+static const u8 sMapName_THREE_ISLAND[] = _("THREE ISLAND");
+static const u8 sMapName_FOUR_ISLAND[] = _("FOUR ISLAND");
+static const u8 sMapName_FIVE_ISLAND[] = _("FIVE ISLAND");
+static const u8 sMapName_SEVEN_ISLAND[] = _("SEVEN ISLAND");
+static const u8 sMapName_SIX_ISLAND[] = _("SIX ISLAND");
+static const u8 sMapName_KINDLE_ROAD[] = _("KINDLE ROAD");
+static const u8 sMapName_TREASURE_BEACH[] = _("TREASURE BEACH");
+static const u8 sMapName_CAPE_BRINK[] = _("CAPE BRINK");
+static const u8 sMapName_BOND_BRIDGE[] = _("BOND BRIDGE");
+static const u8 sMapName_THREE_ISLE_PORT[] = _("THREE ISLE PORT");
+static const u8 sMapName_SEVII_ISLE_6[] = _("SEVII ISLE 6");
+static const u8 sMapName_SEVII_ISLE_7[] = _("SEVII ISLE 7");
+static const u8 sMapName_SEVII_ISLE_8[] = _("SEVII ISLE 8");
+static const u8 sMapName_SEVII_ISLE_9[] = _("SEVII ISLE 9");
+static const u8 sMapName_RESORT_GORGEOUS[] = _("RESORT GORGEOUS");
+static const u8 sMapName_WATER_LABYRINTH[] = _("WATER LABYRINTH");
+static const u8 sMapName_FIVE_ISLE_MEADOW[] = _("FIVE ISLE MEADOW");
+static const u8 sMapName_MEMORIAL_PILLAR[] = _("MEMORIAL PILLAR");
+static const u8 sMapName_OUTCAST_ISLAND[] = _("OUTCAST ISLAND");
+static const u8 sMapName_GREEN_PATH[] = _("GREEN PATH");
+static const u8 sMapName_WATER_PATH[] = _("WATER PATH");
+static const u8 sMapName_RUIN_VALLEY[] = _("RUIN VALLEY");
+static const u8 sMapName_TRAINER_TOWER[] = _("TRAINER TOWER");
+static const u8 sMapName_CANYON_ENTRANCE[] = _("CANYON ENTRANCE");
+static const u8 sMapName_SEVAULT_CANYON[] = _("SEVAULT CANYON");
+static const u8 sMapName_TANOBY_RUINS[] = _("TANOBY RUINS");
+static const u8 sMapName_SEVII_ISLE_22[] = _("SEVII ISLE 22");
+static const u8 sMapName_SEVII_ISLE_23[] = _("SEVII ISLE 23");
+static const u8 sMapName_SEVII_ISLE_24[] = _("SEVII ISLE 24");
+static const u8 sMapName_NAVEL_ROCK[] = _("NAVEL ROCK");
+static const u8 sMapName_MT__EMBER[] = _("MT. EMBER");
+static const u8 sMapName_BERRY_FOREST[] = _("BERRY FOREST");
+static const u8 sMapName_ICEFALL_CAVE[] = _("ICEFALL CAVE");
+static const u8 sMapName_ROCKET_WAREHOUSE[] = _("ROCKET WAREHOUSE");
+static const u8 sMapName_DOTTED_HOLE[] = _("DOTTED HOLE");
+static const u8 sMapName_LOST_CAVE[] = _("LOST CAVE");
+static const u8 sMapName_PATTERN_BUSH[] = _("PATTERN BUSH");
+static const u8 sMapName_ALTERING_CAVE[] = _("ALTERING CAVE");
+static const u8 sMapName_TANOBY_CHAMBERS[] = _("TANOBY CHAMBERS");
+static const u8 sMapName_THREE_ISLE_PATH[] = _("THREE ISLE PATH");
+static const u8 sMapName_TANOBY_KEY[] = _("TANOBY KEY");
+static const u8 sMapName_BIRTH_ISLAND[] = _("BIRTH ISLAND");
+static const u8 sMapName_MONEAN_CHAMBER[] = _("MONEAN CHAMBER");
+static const u8 sMapName_LIPTOO_CHAMBER[] = _("LIPTOO CHAMBER");
+static const u8 sMapName_WEEPTH_CHAMBER[] = _("WEEPTH CHAMBER");
+static const u8 sMapName_DILFORD_CHAMBER[] = _("DILFORD CHAMBER");
+static const u8 sMapName_SCUFIB_CHAMBER[] = _("SCUFIB CHAMBER");
+static const u8 sMapName_RIXY_CHAMBER[] = _("RIXY CHAMBER");
+static const u8 sMapName_VIAPOIS_CHAMBER[] = _("VIAPOIS CHAMBER");
+static const u8 sMapName_EMBER_SPA[] = _("EMBER SPA");
+static const u8 sMapName_CELADON_DEPT_[] = _("CELADON DEPT.");
+
+const struct RegionMapLocation gRegionMapEntries[] = {
+    [MAPSEC_PALLET_TOWN - KANTO_MAPSEC_START] = { 4, 11, 1, 1, sMapName_PALLET_TOWN},
+    [MAPSEC_VIRIDIAN_CITY - KANTO_MAPSEC_START] = { 4, 8, 1, 1, sMapName_VIRIDIAN_CITY},
+    [MAPSEC_PEWTER_CITY - KANTO_MAPSEC_START] = { 4, 4, 1, 1, sMapName_PEWTER_CITY},
+    [MAPSEC_CERULEAN_CITY - KANTO_MAPSEC_START] = { 14, 3, 1, 1, sMapName_CERULEAN_CITY},
+    [MAPSEC_LAVENDER_TOWN - KANTO_MAPSEC_START] = { 18, 6, 1, 1, sMapName_LAVENDER_TOWN},
+    [MAPSEC_VERMILION_CITY - KANTO_MAPSEC_START] = { 14, 9, 1, 1, sMapName_VERMILION_CITY},
+    [MAPSEC_CELADON_CITY - KANTO_MAPSEC_START] = { 11, 6, 1, 1, sMapName_CELADON_CITY},
+    [MAPSEC_FUCHSIA_CITY - KANTO_MAPSEC_START] = { 12, 12, 1, 1, sMapName_FUCHSIA_CITY},
+    [MAPSEC_CINNABAR_ISLAND - KANTO_MAPSEC_START] = { 4, 14, 1, 1, sMapName_CINNABAR_ISLAND},
+    [MAPSEC_INDIGO_PLATEAU - KANTO_MAPSEC_START] = { 2, 3, 1, 1, sMapName_INDIGO_PLATEAU},
+    [MAPSEC_SAFFRON_CITY - KANTO_MAPSEC_START] = { 14, 6, 1, 1, sMapName_SAFFRON_CITY},
+    [MAPSEC_ROUTE_4_POKECENTER - KANTO_MAPSEC_START] = { 8, 3, 1, 1, sMapName_ROUTE_4},
+    [MAPSEC_ROUTE_10_POKECENTER - KANTO_MAPSEC_START] = { 18, 3, 1, 1, sMapName_ROUTE_10},
+    [MAPSEC_ROUTE_1 - KANTO_MAPSEC_START] = { 4, 9, 1, 2, sMapName_ROUTE_1},
+    [MAPSEC_ROUTE_2 - KANTO_MAPSEC_START] = { 4, 5, 1, 3, sMapName_ROUTE_2},
+    [MAPSEC_ROUTE_3 - KANTO_MAPSEC_START] = { 5, 4, 4, 1, sMapName_ROUTE_3},
+    [MAPSEC_ROUTE_4 - KANTO_MAPSEC_START] = { 8, 3, 6, 1, sMapName_ROUTE_4},
+    [MAPSEC_ROUTE_5 - KANTO_MAPSEC_START] = { 14, 4, 1, 2, sMapName_ROUTE_5},
+    [MAPSEC_ROUTE_6 - KANTO_MAPSEC_START] = { 14, 7, 1, 2, sMapName_ROUTE_6},
+    [MAPSEC_ROUTE_7 - KANTO_MAPSEC_START] = { 12, 6, 2, 1, sMapName_ROUTE_7},
+    [MAPSEC_ROUTE_8 - KANTO_MAPSEC_START] = { 15, 6, 3, 1, sMapName_ROUTE_8},
+    [MAPSEC_ROUTE_9 - KANTO_MAPSEC_START] = { 15, 3, 3, 1, sMapName_ROUTE_9},
+    [MAPSEC_ROUTE_10 - KANTO_MAPSEC_START] = { 18, 3, 1, 3, sMapName_ROUTE_10},
+    [MAPSEC_ROUTE_11 - KANTO_MAPSEC_START] = { 15, 9, 3, 1, sMapName_ROUTE_11},
+    [MAPSEC_ROUTE_12 - KANTO_MAPSEC_START] = { 18, 7, 1, 5, sMapName_ROUTE_12},
+    [MAPSEC_ROUTE_13 - KANTO_MAPSEC_START] = { 16, 11, 2, 1, sMapName_ROUTE_13},
+    [MAPSEC_ROUTE_14 - KANTO_MAPSEC_START] = { 15, 11, 1, 2, sMapName_ROUTE_14},
+    [MAPSEC_ROUTE_15 - KANTO_MAPSEC_START] = { 13, 12, 2, 1, sMapName_ROUTE_15},
+    [MAPSEC_ROUTE_16 - KANTO_MAPSEC_START] = { 7, 6, 4, 1, sMapName_ROUTE_16},
+    [MAPSEC_ROUTE_17 - KANTO_MAPSEC_START] = { 7, 7, 1, 5, sMapName_ROUTE_17},
+    [MAPSEC_ROUTE_18 - KANTO_MAPSEC_START] = { 7, 12, 5, 1, sMapName_ROUTE_18},
+    [MAPSEC_ROUTE_19 - KANTO_MAPSEC_START] = { 12, 13, 1, 2, sMapName_ROUTE_19},
+    [MAPSEC_ROUTE_20 - KANTO_MAPSEC_START] = { 5, 14, 7, 1, sMapName_ROUTE_20},
+    [MAPSEC_ROUTE_21 - KANTO_MAPSEC_START] = { 4, 12, 1, 2, sMapName_ROUTE_21},
+    [MAPSEC_ROUTE_22 - KANTO_MAPSEC_START] = { 2, 8, 2, 1, sMapName_ROUTE_22},
+    [MAPSEC_ROUTE_23 - KANTO_MAPSEC_START] = { 2, 4, 1, 4, sMapName_ROUTE_23},
+    [MAPSEC_ROUTE_24 - KANTO_MAPSEC_START] = { 14, 1, 1, 2, sMapName_ROUTE_24},
+    [MAPSEC_ROUTE_25 - KANTO_MAPSEC_START] = { 15, 1, 2, 1, sMapName_ROUTE_25},
+    [MAPSEC_VIRIDIAN_FOREST - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_VIRIDIAN_FOREST},
+    [MAPSEC_MT_MOON - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_MT__MOON},
+    [MAPSEC_S_S_ANNE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_S_S__ANNE},
+    [MAPSEC_UNDERGROUND_PATH - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_UNDERGROUND_PATH},
+    [MAPSEC_UNDERGROUND_PATH_2 - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_UNDERGROUND_PATH},
+    [MAPSEC_DIGLETTS_CAVE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_DIGLETT_S_CAVE},
+    [MAPSEC_KANTO_VICTORY_ROAD - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_VICTORY_ROAD},
+    [MAPSEC_ROCKET_HIDEOUT - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_ROCKET_HIDEOUT},
+    [MAPSEC_SILPH_CO - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_SILPH_CO_},
+    [MAPSEC_POKEMON_MANSION - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_POK__MON_MANSION},
+    [MAPSEC_KANTO_SAFARI_ZONE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_SAFARI_ZONE},
+    [MAPSEC_POKEMON_LEAGUE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_POK__MON_LEAGUE},
+    [MAPSEC_ROCK_TUNNEL - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_ROCK_TUNNEL},
+    [MAPSEC_SEAFOAM_ISLANDS - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_SEAFOAM_ISLANDS},
+    [MAPSEC_POKEMON_TOWER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_POK__MON_TOWER},
+    [MAPSEC_CERULEAN_CAVE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_CERULEAN_CAVE},
+    [MAPSEC_POWER_PLANT - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_POWER_PLANT},
+    [MAPSEC_ONE_ISLAND - KANTO_MAPSEC_START] = { 1, 8, 1, 1, sMapName_ONE_ISLAND},
+    [MAPSEC_TWO_ISLAND - KANTO_MAPSEC_START] = { 9, 9, 1, 1, sMapName_TWO_ISLAND},
+    [MAPSEC_THREE_ISLAND - KANTO_MAPSEC_START] = { 18, 12, 1, 1, sMapName_THREE_ISLAND},
+    [MAPSEC_FOUR_ISLAND - KANTO_MAPSEC_START] = { 3, 4, 1, 1, sMapName_FOUR_ISLAND},
+    [MAPSEC_FIVE_ISLAND - KANTO_MAPSEC_START] = { 16, 11, 1, 1, sMapName_FIVE_ISLAND},
+    [MAPSEC_SEVEN_ISLAND - KANTO_MAPSEC_START] = { 5, 8, 1, 1, sMapName_SEVEN_ISLAND},
+    [MAPSEC_SIX_ISLAND - KANTO_MAPSEC_START] = { 17, 5, 1, 1, sMapName_SIX_ISLAND},
+    [MAPSEC_KINDLE_ROAD - KANTO_MAPSEC_START] = { 2, 3, 1, 6, sMapName_KINDLE_ROAD},
+    [MAPSEC_TREASURE_BEACH - KANTO_MAPSEC_START] = { 1, 9, 1, 2, sMapName_TREASURE_BEACH},
+    [MAPSEC_CAPE_BRINK - KANTO_MAPSEC_START] = { 9, 7, 1, 2, sMapName_CAPE_BRINK},
+    [MAPSEC_BOND_BRIDGE - KANTO_MAPSEC_START] = { 13, 12, 4, 1, sMapName_BOND_BRIDGE},
+    [MAPSEC_THREE_ISLE_PORT - KANTO_MAPSEC_START] = { 18, 13, 2, 1, sMapName_THREE_ISLE_PORT},
+    [MAPSEC_SEVII_ISLE_6 - KANTO_MAPSEC_START] = { 4, 3, 1, 1, sMapName_SEVII_ISLE_6},
+    [MAPSEC_SEVII_ISLE_7 - KANTO_MAPSEC_START] = { 5, 4, 1, 1, sMapName_SEVII_ISLE_7},
+    [MAPSEC_SEVII_ISLE_8 - KANTO_MAPSEC_START] = { 1, 4, 3, 1, sMapName_SEVII_ISLE_8},
+    [MAPSEC_SEVII_ISLE_9 - KANTO_MAPSEC_START] = { 4, 5, 1, 2, sMapName_SEVII_ISLE_9},
+    [MAPSEC_RESORT_GORGEOUS - KANTO_MAPSEC_START] = { 16, 9, 3, 1, sMapName_RESORT_GORGEOUS},
+    [MAPSEC_WATER_LABYRINTH - KANTO_MAPSEC_START] = { 14, 10, 3, 1, sMapName_WATER_LABYRINTH},
+    [MAPSEC_FIVE_ISLE_MEADOW - KANTO_MAPSEC_START] = { 17, 10, 1, 3, sMapName_FIVE_ISLE_MEADOW},
+    [MAPSEC_MEMORIAL_PILLAR - KANTO_MAPSEC_START] = { 18, 12, 1, 3, sMapName_MEMORIAL_PILLAR},
+    [MAPSEC_OUTCAST_ISLAND - KANTO_MAPSEC_START] = { 15, 0, 1, 3, sMapName_OUTCAST_ISLAND},
+    [MAPSEC_GREEN_PATH - KANTO_MAPSEC_START] = { 15, 3, 3, 1, sMapName_GREEN_PATH},
+    [MAPSEC_WATER_PATH - KANTO_MAPSEC_START] = { 18, 3, 1, 5, sMapName_WATER_PATH},
+    [MAPSEC_RUIN_VALLEY - KANTO_MAPSEC_START] = { 16, 7, 2, 2, sMapName_RUIN_VALLEY},
+    [MAPSEC_TRAINER_TOWER - KANTO_MAPSEC_START] = { 5, 6, 1, 2, sMapName_TRAINER_TOWER},
+    [MAPSEC_CANYON_ENTRANCE - KANTO_MAPSEC_START] = { 5, 9, 1, 1, sMapName_CANYON_ENTRANCE},
+    [MAPSEC_SEVAULT_CANYON - KANTO_MAPSEC_START] = { 6, 9, 1, 3, sMapName_SEVAULT_CANYON},
+    [MAPSEC_TANOBY_RUINS - KANTO_MAPSEC_START] = { 3, 12, 7, 1, sMapName_TANOBY_RUINS},
+    [MAPSEC_SEVII_ISLE_22 - KANTO_MAPSEC_START] = { 9, 12, 1, 3, sMapName_SEVII_ISLE_22},
+    [MAPSEC_SEVII_ISLE_23 - KANTO_MAPSEC_START] = { 3, 14, 6, 1, sMapName_SEVII_ISLE_23},
+    [MAPSEC_SEVII_ISLE_24 - KANTO_MAPSEC_START] = { 2, 12, 1, 3, sMapName_SEVII_ISLE_24},
+    [MAPSEC_NAVEL_ROCK_FRLG - KANTO_MAPSEC_START] = { 10, 8, 1, 1, sMapName_NAVEL_ROCK},
+    [MAPSEC_MT_EMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_MT__EMBER},
+    [MAPSEC_BERRY_FOREST - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_BERRY_FOREST},
+    [MAPSEC_ICEFALL_CAVE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_ICEFALL_CAVE},
+    [MAPSEC_ROCKET_WAREHOUSE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_ROCKET_WAREHOUSE},
+    [MAPSEC_TRAINER_TOWER_2 - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_TRAINER_TOWER},
+    [MAPSEC_DOTTED_HOLE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_DOTTED_HOLE},
+    [MAPSEC_LOST_CAVE - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_LOST_CAVE},
+    [MAPSEC_PATTERN_BUSH - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_PATTERN_BUSH},
+    [MAPSEC_ALTERING_CAVE_FRLG - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_ALTERING_CAVE},
+    [MAPSEC_TANOBY_CHAMBERS - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_TANOBY_CHAMBERS},
+    [MAPSEC_THREE_ISLE_PATH - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_THREE_ISLE_PATH},
+    [MAPSEC_TANOBY_KEY - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_TANOBY_KEY},
+    [MAPSEC_BIRTH_ISLAND_FRLG - KANTO_MAPSEC_START] = { 18, 13, 1, 1, sMapName_BIRTH_ISLAND},
+    [MAPSEC_MONEAN_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_MONEAN_CHAMBER},
+    [MAPSEC_LIPTOO_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_LIPTOO_CHAMBER},
+    [MAPSEC_WEEPTH_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_WEEPTH_CHAMBER},
+    [MAPSEC_DILFORD_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_DILFORD_CHAMBER},
+    [MAPSEC_SCUFIB_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_SCUFIB_CHAMBER},
+    [MAPSEC_RIXY_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_RIXY_CHAMBER},
+    [MAPSEC_VIAPOIS_CHAMBER - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_VIAPOIS_CHAMBER},
+    [MAPSEC_EMBER_SPA - KANTO_MAPSEC_START] = { 0, 0, 1, 1, sMapName_EMBER_SPA},
+    [MAPSEC_SPECIAL_AREA - KANTO_MAPSEC_START] = { 0, 0, 0, 0, sMapName_CELADON_DEPT_},
+};
+
+#endif // GUARD_DATA_REGION_MAP_REGION_MAP_ENTRIES_H
\ No newline at end of file
@@ -5,8 +5,10 @@
 #include "decompress_error_handler.h"
 #include "pokemon.h"
 #include "pokemon_sprite_visualizer.h"
+#include "sprite_cache.h"
 #include "text.h"
 #include "menu.h"
+#include "task.h"
 
 EWRAM_DATA ALIGNED(4) u8 gDecompressionBuffer[0x4000] = {0};
 
@@ -208,7 +210,8 @@ static inline u32 DoLoadCompressedSpriteSheet(const struct CompressedSpriteSheet
 
 u32 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 {
-    void *buffer = malloc_and_decompress(src->data, NULL);
+    void *buffer = Alloc(GetDecompressedDataSize(src->data));
+    DecompressDataWithHeaderWramCached(src->data, buffer);
     u32 ret = DoLoadCompressedSpriteSheet(src, buffer);
     Free(buffer);
 
@@ -217,7 +220,7 @@ u32 LoadCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
 
 u32 LoadCompressedSpriteSheetOverrideBuffer(const struct CompressedSpriteSheet *src, void *buffer)
 {
-    DecompressDataWithHeaderWram(src->data, buffer);
+    DecompressDataWithHeaderWramCached(src->data, buffer);
     return DoLoadCompressedSpriteSheet(src, buffer);
 }
 
@@ -1130,25 +1133,25 @@ void LoadSpecialPokePic(void *dest, s32 species, u32 personality, bool8 isFrontP
     {
     #if P_GENDER_DIFFERENCES
         if (gSpeciesInfo[species].frontPicFemale != NULL && IsPersonalityFemale(species, personality))
-            DecompressDataWithHeaderWram(gSpeciesInfo[species].frontPicFemale, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[species].frontPicFemale, dest);
         else
     #endif
         if (gSpeciesInfo[species].frontPic != NULL)
-            DecompressDataWithHeaderWram(gSpeciesInfo[species].frontPic, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[species].frontPic, dest);
         else
-            DecompressDataWithHeaderWram(gSpeciesInfo[SPECIES_NONE].frontPic, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[SPECIES_NONE].frontPic, dest);
     }
     else
     {
     #if P_GENDER_DIFFERENCES
         if (gSpeciesInfo[species].backPicFemale != NULL && IsPersonalityFemale(species, personality))
-            DecompressDataWithHeaderWram(gSpeciesInfo[species].backPicFemale, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[species].backPicFemale, dest);
         else
     #endif
         if (gSpeciesInfo[species].backPic != NULL)
-            DecompressDataWithHeaderWram(gSpeciesInfo[species].backPic, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[species].backPic, dest);
         else
-            DecompressDataWithHeaderWram(gSpeciesInfo[SPECIES_NONE].backPic, dest);
+            DecompressDataWithHeaderWramCached(gSpeciesInfo[SPECIES_NONE].backPic, dest);
     }
 
     DrawSpindaSpots(species, personality, dest, isFrontPic);
@@ -1328,7 +1331,7 @@ bool8 LoadCompressedSpriteSheetUsingHeap(const struct CompressedSpriteSheet *src
     void *buffer;
 
     buffer = AllocZeroed(GetDecompressedDataSize(&src->data[0]));
-    DecompressDataWithHeaderWram(src->data, buffer);
+    DecompressDataWithHeaderWramCached(src->data, buffer);
 
     dest.data = buffer;
     dest.size = src->size;
@@ -1354,3 +1357,384 @@ void FastLZ77UnCompWram(const u32 *src, void *dest)
     CopyFuncToIwram(funcBuffer, LZ77UnCompWRAMOptimized, LZ77UnCompWRAMOptimized_end);
     SwitchToArmCallFastLZ77(src, dest, (void *) funcBuffer);
 }
+
+//  Streamed decompression
+//  Splits the decompression of a single asset into steps so that large graphics can be
+//  loaded over several frames. The tANS coded lo and symbol streams are decoded in one
+//  step each, after which the instructions are decoded DECOMPRESSION_STREAM_CHUNK halfwords
+//  at a time until the step's work limit or cycle budget runs out.
+//  LZ77 and tilemap data is always decompressed in a single step.
+
+#define DECOMPRESSION_STREAM_CHUNK  256
+#define CYCLES_PER_SCANLINE         1232
+#define SCANLINES_PER_FRAME         228
+
+#define tStream 0
+
+//  Same as DecodeInstructions, but stops once destEnd is reached and keeps
+//  the state of a partially written copy or raw run in the stream
+ARM_FUNC __attribute__((noinline, no_reorder)) __attribute__((optimize("-O3"))) static void DecodeInstructionsSlice(struct DecompressionStream *stream, u16 *destEnd)
+{
+    u16 *dest = stream->dest;
+    const u8 *loVec = stream->loVec;
+    const u16 *symVec = stream->symVec;
+    u32 copyLength = stream->copyLength;
+    u32 rawLength = stream->rawLength;
+
+    while (dest < destEnd)
+    {
+        if (copyLength != 0)
+        {
+            //  An offset of 1 is a fill of the previous value, which copying forwards also produces
+            const u16 *from = dest - stream->copyOffset;
+            u32 count = destEnd - dest;
+            if (count > copyLength)
+                count = copyLength;
+            copyLength -= count;
+            do {
+                *dest++ = *from++;
+            } while (--count != 0);
+        }
+        else if (rawLength != 0)
+        {
+            u32 count = destEnd - dest;
+            if (count > rawLength)
+                count = rawLength;
+            rawLength -= count;
+            do {
+                *dest++ = *symVec++;
+            } while (--count != 0);
+        }
+        else if (loVec < stream->loVecEnd)
+        {
+            u32 currOffset, currLength;
+
+            if (loVec[0] & CONTINUE_BIT)
+            {
+                currLength = (loVec[0] & FIRST_LO_MASK) | (loVec[1] << 7);
+                currOffset = loVec[2] & FIRST_LO_MASK;
+                if (loVec[2] & CONTINUE_BIT)
+                {
+                    currOffset |= loVec[3] << 7;
+                    loVec += 4;
+                }
+                else
+                {
+                    loVec += 3;
+                }
+            }
+            else
+            {
+                currLength = loVec[0] & FIRST_LO_MASK;
+                currOffset = loVec[1] & FIRST_LO_MASK;
+                if (loVec[1] & CONTINUE_BIT)
+                {
+                    currOffset |= (loVec[2] << 7);
+                    loVec += 3;
+                }
+                else
+                {
+                    loVec += 2;
+                }
+            }
+
+            if (currLength != 0)
+            {
+                *dest++ = *symVec++;
+                copyLength = currLength;
+                stream->copyOffset = currOffset;
+            }
+            else
+            {
+                rawLength = currOffset;
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    stream->dest = dest;
+    stream->loVec = loVec;
+    stream->symVec = symVec;
+    stream->copyLength = copyLength;
+    stream->rawLength = rawLength;
+}
+
+//  Dark Egg magic
+ARM_FUNC __attribute__((no_reorder)) static void SwitchToArmCallDecodeInstructionsSlice(struct DecompressionStream *stream, u16 *destEnd, void (*decodeFunction)(struct DecompressionStream *stream, u16 *destEnd))
+{
+    decodeFunction(stream, destEnd);
+}
+
+static bool32 IsStreamOverBudget(u32 startLine, u32 cycleBudget)
+{
+    if (cycleBudget == 0)
+        return FALSE;
+    return (REG_VCOUNT + SCANLINES_PER_FRAME - startLine) % SCANLINES_PER_FRAME >= cycleBudget / CYCLES_PER_SCANLINE;
+}
+
+static void DecodeStreamLO(struct DecompressionStream *stream)
+{
+    sCurrState = stream->currState;
+    sBitIndex = stream->bitIndex;
+    DecodeLOtANS(stream->dataPtr, stream->loFreqs, (u8 *)stream->loVec, stream->loSize);
+
+    //  The symbol bitstream continues where the lo one ends
+    stream->dataPtr = sDataPtr;
+    stream->currState = sCurrState;
+    stream->bitIndex = sBitIndex;
+}
+
+static void DecodeStreamSyms(struct DecompressionStream *stream)
+{
+    sCurrState = stream->currState;
+    sBitIndex = stream->bitIndex;
+    if (isModeSymDelta(stream->mode))
+        DecodeSymDeltatANS(stream->dataPtr, stream->symFreqs, (u16 *)stream->symVec, stream->symSize);
+    else
+        DecodeSymtANS(stream->dataPtr, stream->symFreqs, (u16 *)stream->symVec, stream->symSize);
+}
+
+static u32 DecodeStreamInstructions(struct DecompressionStream *stream, u32 maxWork, u32 startLine, u32 cycleBudget)
+{
+    u32 funcBuffer[400];
+    u32 work = 0;
+
+    CopyFuncToIwram(funcBuffer, DecodeInstructionsSlice, SwitchToArmCallDecodeInstructionsSlice);
+    do
+    {
+        u32 count = DECOMPRESSION_STREAM_CHUNK;
+        if (maxWork - work < count)
+            count = maxWork - work;
+        SwitchToArmCallDecodeInstructionsSlice(stream, stream->dest + count, (void *) funcBuffer);
+        work += count;
+
+        if (stream->loVec >= stream->loVecEnd && stream->copyLength == 0 && stream->rawLength == 0)
+        {
+            Free(stream->buffer);
+            stream->buffer = NULL;
+            stream->state = STREAM_DONE;
+            break;
+        }
+    } while (work < maxWork && !IsStreamOverBudget(startLine, cycleBudget));
+
+    return work;
+}
+
+//  Same layout handling as SmolDecompressData
+static void InitSmolDecompressionStream(struct DecompressionStream *stream, const struct SmolHeader *header, const u32 *data)
+{
+    const u8 *leftoverPos = (const u8 *)data;
+    bool32 loEncoded = isModeLoEncoded(header->mode);
+    bool32 symEncoded = isModeSymEncoded(header->mode);
+
+    stream->loSize = header->loSize;
+    stream->symSize = header->symSize;
+    stream->currState = header->initialState;
+    stream->bitIndex = 0;
+    stream->dataPtr = data;
+
+    if (loEncoded)
+    {
+        stream->loFreqs = stream->dataPtr;
+        stream->dataPtr += 3;
+        leftoverPos += 12;
+    }
+    if (symEncoded)
+    {
+        stream->symFreqs = stream->dataPtr;
+        stream->dataPtr += 3;
+        leftoverPos += 12;
+    }
+
+    if (loEncoded || symEncoded)
+    {
+        u32 alignedLoSize = stream->loSize % 2 == 1 ? stream->loSize + 1 : stream->loSize;
+        u32 alignedSymSize = stream->symSize % 2 == 1 ? stream->symSize + 1 : stream->symSize;
+        stream->buffer = Alloc((alignedSymSize*2) + alignedLoSize);
+        stream->symVec = stream->buffer;
+        stream->loVec = stream->buffer + alignedSymSize*2;
+        leftoverPos += 4*header->bitstreamSize;
+    }
+
+    if (symEncoded == FALSE)
+    {
+        stream->symVec = (const u16 *)leftoverPos;
+        leftoverPos += stream->symSize*2;
+    }
+    if (loEncoded == FALSE)
+        stream->loVec = leftoverPos;
+    stream->loVecEnd = stream->loVec + stream->loSize;
+
+    if (loEncoded)
+        stream->state = STREAM_DECODE_LO;
+    else if (symEncoded)
+        stream->state = STREAM_DECODE_SYMS;
+    else
+        stream->state = STREAM_DECODE_INSTRUCTIONS;
+}
+
+//  Prepares decompressing src into dest, which may be in VRAM.
+//  If numSteps isn't 0, the work is spread evenly over that many calls to ContinueDecompressionStream
+void InitDecompressionStream(struct DecompressionStream *stream, const u32 *src, void *dest, u32 numSteps)
+{
+    union CompressionHeader header;
+    u32 totalWork;
+
+    CpuCopy32(src, &header, 8);
+    memset(stream, 0, sizeof(*stream));
+    stream->src = src;
+    stream->dest = dest;
+    stream->mode = header.smol.mode;
+
+    switch (header.smol.mode)
+    {
+        case MODE_LZ77:
+        case IS_TILEMAP:
+            stream->state = STREAM_DECODE_WHOLE;
+            return;
+        case BASE_ONLY:
+        case ENCODE_SYMS:
+        case ENCODE_DELTA_SYMS:
+        case ENCODE_LO:
+        case ENCODE_BOTH:
+        case ENCODE_BOTH_DELTA_SYMS:
+            break;
+        default:
+            DecompressionError(src, HEADER_ERROR);
+            stream->state = STREAM_DONE;
+            return;
+    }
+
+    //  Same early out as SmolDecompressData
+    if (header.smol.loSize == 0 || header.smol.symSize == 0)
+    {
+        stream->state = STREAM_DONE;
+        return;
+    }
+
+    InitSmolDecompressionStream(stream, &header.smol, &src[2]);
+
+    if (numSteps != 0)
+    {
+        //  One unit of work is one decoded halfword, or one halfword of decoded lo values
+        totalWork = header.smol.imageSize*SMOL_IMAGE_SIZE_MULTIPLIER/2;
+        if (isModeLoEncoded(stream->mode))
+            totalWork += stream->loSize/2;
+        if (isModeSymEncoded(stream->mode))
+            totalWork += stream->symSize;
+        stream->workPerStep = (totalWork + numSteps - 1) / numSteps;
+        if (stream->workPerStep == 0)
+            stream->workPerStep = 1;
+    }
+}
+
+//  Runs steps of the stream until either the stream's work limit is reached or more than
+//  cycleBudget cycles have passed, measured in scanlines. A cycleBudget of 0 has no limit.
+//  At least one step is always run. Returns TRUE once dest has been fully written.
+bool32 ContinueDecompressionStream(struct DecompressionStream *stream, u32 cycleBudget)
+{
+    u32 startLine = REG_VCOUNT;
+    u32 maxWork = stream->workPerStep != 0 ? stream->workPerStep : 0xFFFFFFFF;
+    u32 work = 0;
+
+    while (stream->state != STREAM_DONE)
+    {
+        switch (stream->state)
+        {
+            case STREAM_DECODE_LO:
+                DecodeStreamLO(stream);
+                work += stream->loSize/2;
+                stream->state = isModeSymEncoded(stream->mode) ? STREAM_DECODE_SYMS : STREAM_DECODE_INSTRUCTIONS;
+                break;
+            case STREAM_DECODE_SYMS:
+                DecodeStreamSyms(stream);
+                work += stream->symSize;
+                stream->state = STREAM_DECODE_INSTRUCTIONS;
+                break;
+            case STREAM_DECODE_INSTRUCTIONS:
+                work += DecodeStreamInstructions(stream, maxWork - work, startLine, cycleBudget);
+                break;
+            case STREAM_DECODE_WHOLE:
+                DecompressDataWithHeaderVram(stream->src, stream->dest);
+                stream->state = STREAM_DONE;
+                break;
+        }
+        if (work >= maxWork || IsStreamOverBudget(startLine, cycleBudget))
+            break;
+    }
+
+    return stream->state == STREAM_DONE;
+}
+
+void FinishDecompressionStream(struct DecompressionStream *stream)
+{
+    while (!ContinueDecompressionStream(stream, 0))
+        ;
+}
+
+static void Task_DecompressionStream(u8 taskId)
+{
+    struct DecompressionStream *stream = (struct DecompressionStream *)GetWordTaskArg(taskId, tStream);
+
+    if (ContinueDecompressionStream(stream, DECOMPRESSION_STREAM_CYCLE_BUDGET))
+    {
+        Free(stream);
+        DestroyTask(taskId);
+    }
+}
+
+//  Decompresses src into dest over at least numFrames frames, or as fast as the
+//  cycle budget allows if numFrames is 0. dest must not be used until the task is done.
+u8 CreateDecompressionTask(const u32 *src, void *dest, u32 numFrames)
+{
+    struct DecompressionStream *stream = Alloc(sizeof(*stream));
+    u8 taskId = CreateTask(Task_DecompressionStream, 0);
+
+    InitDecompressionStream(stream, src, dest, numFrames);
+    SetWordTaskArg(taskId, tStream, (u32)stream);
+    return taskId;
+}
+
+//  Like LoadCompressedSpriteSheet, but the tiles are decompressed straight into VRAM
+//  over numFrames frames. Sprites using the tiles show garbage until it is done.
+u32 LoadCompressedSpriteSheetOverFrames(const struct CompressedSpriteSheet *src, u32 numFrames)
+{
+    struct SpriteSheet sheet;
+    u16 tileStart;
+
+    //  The decompressed data is written as is, so it has to fit the sheet exactly
+    if (GetDecompressedDataSize(src->data) != src->size)
+        return LoadCompressedSpriteSheet(src);
+
+    sheet.data = NULL;
+    sheet.size = src->size;
+    sheet.tag = src->tag;
+    tileStart = AllocTilesForSpriteSheet(&sheet);
+    if (tileStart == 0)
+        return 0;
+
+    CreateDecompressionTask(src->data, (u8 *)OBJ_VRAM0 + TILE_SIZE_4BPP * tileStart, numFrames);
+    return tileStart;
+}
+
+bool32 IsDecompressionTaskActive(void)
+{
+    return FuncIsActiveTask(Task_DecompressionStream);
+}
+
+//  Has to be called before anything that resets the tasks or the heap while a decompression task is active
+void FinishDecompressionTasks(void)
+{
+    u8 taskId;
+
+    while ((taskId = FindTaskIdByFunc(Task_DecompressionStream)) != TASK_NONE)
+    {
+        struct DecompressionStream *stream = (struct DecompressionStream *)GetWordTaskArg(taskId, tStream);
+        FinishDecompressionStream(stream);
+        Free(stream);
+        DestroyTask(taskId);
+    }
+}
@@ -1,18 +1,45 @@
 #include "global.h"
 #include "dma3.h"
+#include "test_runner.h"
 
 #define MAX_DMA_REQUESTS 128
+#define DMA_REQUEST_NONE 0xFF
+
+// Requests are processed by priority, which is taken from where they
+// write to, and in the order they were made within each priority.
+enum
+{
+    DMA3_PRIORITY_SPRITES, // OAM and sprite tiles
+    DMA3_PRIORITY_PALETTES,
+    DMA3_PRIORITY_BG,
+    DMA3_PRIORITY_BULK, // Anything outside of VRAM, OAM and palette RAM
+    DMA3_PRIORITY_COUNT,
+};
 
 static struct {
-    /* 0x00 */ const u8 *src;
+    /* 0x00 */ union {
+                   const u8 *src;
+                   u32 value;
+               };
     /* 0x04 */ u8 *dest;
     /* 0x08 */ u16 size;
-    /* 0x0A */ u16 mode;
-    /* 0x0C */ u32 value;
-} gDma3Requests[128];
+    /* 0x0A */ u8 mode;
+    /* 0x0B */ u8 priority;
+    /* 0x0C */ u16 order;
+    /* 0x0E */ u8 next; // The next request with the same priority
+    /* 0x0F */ u8 queuedAt; // sDma3VBlankCounter when it was made
+} gDma3Requests[MAX_DMA_REQUESTS];
 
 static volatile bool8 gDma3ManagerLocked;
 static u8 gDma3RequestCursor;
+static u8 sDma3QueueHeads[DMA3_PRIORITY_COUNT] = {[0 ... DMA3_PRIORITY_COUNT - 1] = DMA_REQUEST_NONE};
+static u8 sDma3QueueTails[DMA3_PRIORITY_COUNT] = {[0 ... DMA3_PRIORITY_COUNT - 1] = DMA_REQUEST_NONE};
+static u8 sDma3LastRequest = DMA_REQUEST_NONE;
+static u8 sDma3VBlankCounter;
+static u16 sDma3NextOrder;
+static u32 sDma3PendingBytes;
+
+EWRAM_DATA struct Dma3Stats gDma3Stats = {0};
 
 void ClearDma3Requests(void)
 {
@@ -28,12 +55,110 @@ void ClearDma3Requests(void)
         gDma3Requests[i].dest = 0;
     }
 
+    for (i = 0; i < DMA3_PRIORITY_COUNT; i++)
+    {
+        sDma3QueueHeads[i] = DMA_REQUEST_NONE;
+        sDma3QueueTails[i] = DMA_REQUEST_NONE;
+    }
+    sDma3LastRequest = DMA_REQUEST_NONE;
+    sDma3PendingBytes = 0;
+
     gDma3ManagerLocked = FALSE;
 }
 
+static u32 GetDma3Priority(const void *dest)
+{
+    uintptr_t addr = (uintptr_t)dest;
+
+    if ((addr >= OAM && addr < OAM + OAM_SIZE) || (addr >= (uintptr_t)OBJ_VRAM0 && addr < VRAM + VRAM_SIZE))
+        return DMA3_PRIORITY_SPRITES;
+    if (addr >= PLTT && addr < PLTT + PLTT_SIZE)
+        return DMA3_PRIORITY_PALETTES;
+    if (addr >= VRAM && addr < (uintptr_t)OBJ_VRAM0)
+        return DMA3_PRIORITY_BG;
+    return DMA3_PRIORITY_BULK;
+}
+
+static bool32 IsOlderDma3Request(u32 a, u32 b)
+{
+    return (s16)(gDma3Requests[a].order - gDma3Requests[b].order) < 0;
+}
+
+static bool32 DoRangesOverlap(const u8 *a, const u8 *b, u32 size, u32 otherSize)
+{
+    return a < b + otherSize && b < a + size;
+}
+
+static bool32 IsDma3Copy(u32 index)
+{
+    return gDma3Requests[index].mode == DMA_REQUEST_COPY16 || gDma3Requests[index].mode == DMA_REQUEST_COPY32;
+}
+
+// Whether running index before the older request other would change what
+// either of them reads or writes.
+static bool32 DoDma3RequestsConflict(u32 index, u32 other)
+{
+    u32 size = gDma3Requests[index].size;
+    u32 otherSize = gDma3Requests[other].size;
+
+    if (DoRangesOverlap(gDma3Requests[index].dest, gDma3Requests[other].dest, size, otherSize))
+        return TRUE;
+    if (IsDma3Copy(index) && DoRangesOverlap(gDma3Requests[index].src, gDma3Requests[other].dest, size, otherSize))
+        return TRUE;
+    if (IsDma3Copy(other) && DoRangesOverlap(gDma3Requests[index].dest, gDma3Requests[other].src, size, otherSize))
+        return TRUE;
+    return FALSE;
+}
+
+static bool32 DependsOnOlderDma3Request(u32 index)
+{
+    u32 priority, other;
+
+    for (priority = gDma3Requests[index].priority + 1; priority < DMA3_PRIORITY_COUNT; priority++)
+    {
+        for (other = sDma3QueueHeads[priority]; other != DMA_REQUEST_NONE && IsOlderDma3Request(other, index); other = gDma3Requests[other].next)
+        {
+            if (DoDma3RequestsConflict(index, other))
+                return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+// The first request of the highest priority goes next, unless the oldest
+// request has waited DMA3_MAX_WAIT_VBLANKS or the highest priority one
+// depends on it.
+static u32 GetNextDma3Request(void)
+{
+    u32 priority, oldest = DMA_REQUEST_NONE;
+
+    for (priority = 0; priority < DMA3_PRIORITY_COUNT; priority++)
+    {
+        u32 head = sDma3QueueHeads[priority];
+        if (head != DMA_REQUEST_NONE && (oldest == DMA_REQUEST_NONE || IsOlderDma3Request(head, oldest)))
+            oldest = head;
+    }
+
+    if (oldest == DMA_REQUEST_NONE
+     || (u8)(sDma3VBlankCounter - gDma3Requests[oldest].queuedAt) >= DMA3_MAX_WAIT_VBLANKS)
+        return oldest;
+
+    for (priority = 0; priority < DMA3_PRIORITY_COUNT; priority++)
+    {
+        u32 head = sDma3QueueHeads[priority];
+        if (head != DMA_REQUEST_NONE)
+            return DependsOnOlderDma3Request(head) ? oldest : head;
+    }
+    return oldest;
+}
+
 void ProcessDma3Requests(void)
 {
-    u16 bytesTransferred;
+    u32 bytesTransferred;
+    u32 index;
+
+    sDma3VBlankCounter++;
+    gDma3Stats.lastVBlankBytes = 0;
 
     if (gDma3ManagerLocked)
         return;
@@ -41,50 +166,110 @@ void ProcessDma3Requests(void)
     bytesTransferred = 0;
 
     // as long as there are DMA requests to process (unless size or vblank is an issue), do not exit
-    while (gDma3Requests[gDma3RequestCursor].size != 0)
+    while ((index = GetNextDma3Request()) != DMA_REQUEST_NONE)
     {
-        bytesTransferred += gDma3Requests[gDma3RequestCursor].size;
+        u32 priority = gDma3Requests[index].priority;
+        u32 waited = (u8)(sDma3VBlankCounter - gDma3Requests[index].queuedAt);
+
+        // The first request always goes, so that larger ones still finish.
+        if (bytesTransferred != 0 && bytesTransferred + gDma3Requests[index].size > DMA3_VBLANK_BYTE_BUDGET)
+            break;
+        // Headless turbo isn't in VBlank at all, see T_HEADLESS_TURBO.
+        if (*(u8 *)REG_ADDR_VCOUNT > 224 && !gTestRunnerTurbo)
+            break; // we're about to leave vblank, stop
 
-        if (bytesTransferred > 40 * 1024)
-            return; // don't transfer more than 40 KiB
-        if (*(u8 *)REG_ADDR_VCOUNT > 224)
-            return; // we're about to leave vblank, stop
+        bytesTransferred += gDma3Requests[index].size;
 
-        switch (gDma3Requests[gDma3RequestCursor].mode)
+        switch (gDma3Requests[index].mode)
         {
         case DMA_REQUEST_COPY32: // regular 32-bit copy
-            Dma3CopyLarge32_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
+            Dma3CopyLarge32_(gDma3Requests[index].src,
+                             gDma3Requests[index].dest,
+                             gDma3Requests[index].size);
             break;
         case DMA_REQUEST_FILL32: // repeat a single 32-bit value across RAM
-            Dma3FillLarge32_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
+            Dma3FillLarge32_(gDma3Requests[index].value,
+                             gDma3Requests[index].dest,
+                             gDma3Requests[index].size);
             break;
         case DMA_REQUEST_COPY16:    // regular 16-bit copy
-            Dma3CopyLarge16_(gDma3Requests[gDma3RequestCursor].src,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
+            Dma3CopyLarge16_(gDma3Requests[index].src,
+                             gDma3Requests[index].dest,
+                             gDma3Requests[index].size);
             break;
         case DMA_REQUEST_FILL16: // repeat a single 16-bit value across RAM
-            Dma3FillLarge16_(gDma3Requests[gDma3RequestCursor].value,
-                             gDma3Requests[gDma3RequestCursor].dest,
-                             gDma3Requests[gDma3RequestCursor].size);
+            Dma3FillLarge16_(gDma3Requests[index].value,
+                             gDma3Requests[index].dest,
+                             gDma3Requests[index].size);
             break;
         }
 
+        gDma3Stats.lastVBlankBytes += gDma3Requests[index].size;
+        gDma3Stats.totalBytes += gDma3Requests[index].size;
+        if (waited > gDma3Stats.maxWaitVBlanks)
+            gDma3Stats.maxWaitVBlanks = waited;
+        sDma3PendingBytes -= gDma3Requests[index].size;
+
         // Free the request
-        gDma3Requests[gDma3RequestCursor].src = NULL;
-        gDma3Requests[gDma3RequestCursor].dest = NULL;
-        gDma3Requests[gDma3RequestCursor].size = 0;
-        gDma3Requests[gDma3RequestCursor].mode = 0;
-        gDma3Requests[gDma3RequestCursor].value = 0;
-        gDma3RequestCursor++;
-
-        if (gDma3RequestCursor >= MAX_DMA_REQUESTS) // loop back to the first DMA request
-            gDma3RequestCursor = 0;
+        sDma3QueueHeads[priority] = gDma3Requests[index].next;
+        if (sDma3QueueHeads[priority] == DMA_REQUEST_NONE)
+            sDma3QueueTails[priority] = DMA_REQUEST_NONE;
+        if (sDma3LastRequest == index)
+            sDma3LastRequest = DMA_REQUEST_NONE;
+        gDma3Requests[index].src = NULL;
+        gDma3Requests[index].dest = NULL;
+        gDma3Requests[index].size = 0;
+        gDma3Requests[index].mode = 0;
     }
+
+    gDma3Stats.deferredBytes += sDma3PendingBytes;
+}
+
+// Requests that continue the last one, like the rows of a tilemap copied
+// one at a time, are merged into it and share its index.
+static bool32 TryMergeDma3Request(const void *src, u32 value, void *dest, u16 size, u8 mode)
+{
+    u32 last = sDma3LastRequest;
+
+    if (last == DMA_REQUEST_NONE
+     || gDma3Requests[last].mode != mode
+     || gDma3Requests[last].dest + gDma3Requests[last].size != dest
+     || gDma3Requests[last].size + size > UINT16_MAX
+     || GetDma3Priority(dest) != gDma3Requests[last].priority)
+        return FALSE;
+
+    if (IsDma3Copy(last))
+    {
+        if (gDma3Requests[last].src + gDma3Requests[last].size != src)
+            return FALSE;
+    }
+    else if (gDma3Requests[last].value != value)
+    {
+        return FALSE;
+    }
+
+    gDma3Requests[last].size += size;
+    sDma3PendingBytes += size;
+    gDma3Stats.mergedRequests++;
+    return TRUE;
+}
+
+static void QueueDma3Request(u32 index)
+{
+    u32 priority = GetDma3Priority(gDma3Requests[index].dest);
+
+    gDma3Requests[index].priority = priority;
+    gDma3Requests[index].order = sDma3NextOrder++;
+    gDma3Requests[index].next = DMA_REQUEST_NONE;
+    gDma3Requests[index].queuedAt = sDma3VBlankCounter;
+
+    if (sDma3QueueTails[priority] == DMA_REQUEST_NONE)
+        sDma3QueueHeads[priority] = index;
+    else
+        gDma3Requests[sDma3QueueTails[priority]].next = index;
+    sDma3QueueTails[priority] = index;
+    sDma3LastRequest = index;
+    sDma3PendingBytes += gDma3Requests[index].size;
 }
 
 s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
@@ -94,6 +279,13 @@ s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
 
     gDma3ManagerLocked = 1;
 
+    if (size != 0 && TryMergeDma3Request(src, 0, dest, size, mode == DMA3_32BIT ? DMA_REQUEST_COPY32 : DMA_REQUEST_COPY16))
+    {
+        cursor = sDma3LastRequest;
+        gDma3ManagerLocked = FALSE;
+        return (s16)cursor;
+    }
+
     cursor = gDma3RequestCursor;
     while(1)
     {
@@ -108,6 +300,12 @@ s16 RequestDma3Copy(const void *src, void *dest, u16 size, u8 mode)
             else
                 gDma3Requests[cursor].mode = DMA_REQUEST_COPY16;
 
+            if (size != 0)
+                QueueDma3Request(cursor);
+            gDma3RequestCursor = cursor + 1;
+            if (gDma3RequestCursor >= MAX_DMA_REQUESTS)
+                gDma3RequestCursor = 0;
+
             gDma3ManagerLocked = FALSE;
             return (s16)cursor;
         }
@@ -129,16 +327,22 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
     int cursor;
     int var = 0;
 
-    cursor = gDma3RequestCursor;
     gDma3ManagerLocked = 1;
 
+    if (size != 0 && TryMergeDma3Request(NULL, value, dest, size, mode == DMA3_32BIT ? DMA_REQUEST_FILL32 : DMA_REQUEST_FILL16))
+    {
+        cursor = sDma3LastRequest;
+        gDma3ManagerLocked = FALSE;
+        return (s16)cursor;
+    }
+
+    cursor = gDma3RequestCursor;
     while(1)
     {
         if(!gDma3Requests[cursor].size)
         {
             gDma3Requests[cursor].dest = dest;
             gDma3Requests[cursor].size = size;
-            gDma3Requests[cursor].mode = mode;
             gDma3Requests[cursor].value = value;
 
             if(mode == DMA3_32BIT)
@@ -146,6 +350,12 @@ s16 RequestDma3Fill(s32 value, void *dest, u16 size, u8 mode)
             else
                 gDma3Requests[cursor].mode = DMA_REQUEST_FILL16;
 
+            if (size != 0)
+                QueueDma3Request(cursor);
+            gDma3RequestCursor = cursor + 1;
+            if (gDma3RequestCursor >= MAX_DMA_REQUESTS)
+                gDma3RequestCursor = 0;
+
             gDma3ManagerLocked = FALSE;
             return (s16)cursor;
         }
@@ -0,0 +1,177 @@
+#include "global.h"
+#include "dma3.h"
+#include "frame_profiler.h"
+#include "main.h"
+
+#if DEBUG_FRAME_PROFILER
+
+struct FrameProfilerFunc
+{
+    const void *func;
+    u8 stage;
+    u16 calls;
+    u32 ticks;
+};
+
+struct FrameProfilerStageStats
+{
+    u32 minTicks;
+    u32 maxTicks;
+    u32 totalTicks;
+    u16 histogram[FRAME_PROFILER_NUM_BUCKETS];
+};
+
+struct FrameProfiler
+{
+    MainCallback callback2;
+    u16 numFrames;
+    u32 frameTicks[FRAME_STAGE_COUNT];
+    struct FrameProfilerStageStats stages[FRAME_STAGE_COUNT];
+    struct FrameProfilerFunc funcs[FRAME_PROFILER_MAX_FUNCS];
+    u32 dmaBytes;
+    u32 maxDmaBytes;
+};
+
+static EWRAM_DATA struct FrameProfiler sFrameProfiler = {0};
+
+static const char *const sStageNames[FRAME_STAGE_COUNT] =
+{
+    [FRAME_STAGE_BUSY] = "busy",
+    [FRAME_STAGE_CALLBACK1] = "callback1",
+    [FRAME_STAGE_CALLBACK2] = "callback2",
+    [FRAME_STAGE_TASKS] = "tasks",
+    [FRAME_STAGE_SPRITE_CALLBACKS] = "sprites",
+    [FRAME_STAGE_BUILD_OAM] = "oam",
+    [FRAME_STAGE_VBLANK] = "vblank",
+};
+
+static void StartTimer(void)
+{
+    REG_TM1CNT_L = 0;
+    REG_TM1CNT_H = TIMER_ENABLE | TIMER_64CLK;
+}
+
+static void ResetWindow(void)
+{
+    u32 i;
+
+    memset(&sFrameProfiler, 0, sizeof(sFrameProfiler));
+    for (i = 0; i < FRAME_STAGE_COUNT; i++)
+        sFrameProfiler.stages[i].minTicks = UINT32_MAX;
+    sFrameProfiler.callback2 = gMain.callback2;
+}
+
+void FrameProfilerInit(void)
+{
+    StartTimer();
+    ResetWindow();
+}
+
+void FrameProfilerAddStage(enum FrameProfilerStage stage, u32 start)
+{
+    sFrameProfiler.frameTicks[stage] += (u16)(FrameProfilerTime() - start);
+}
+
+// Functions are found by hashing their address, so the table only needs
+// to be searched when two of them collide.
+void FrameProfilerAddFunc(enum FrameProfilerStage stage, const void *func, u32 start)
+{
+    u32 ticks = (u16)(FrameProfilerTime() - start);
+    u32 i, index;
+
+    sFrameProfiler.frameTicks[stage] += ticks;
+
+    index = ((uintptr_t)func >> 2) % FRAME_PROFILER_MAX_FUNCS;
+    for (i = 0; i < FRAME_PROFILER_MAX_FUNCS; i++)
+    {
+        struct FrameProfilerFunc *entry = &sFrameProfiler.funcs[index];
+        if (entry->func == NULL)
+        {
+            entry->func = func;
+            entry->stage = stage;
+        }
+        if (entry->func == func)
+        {
+            entry->calls++;
+            entry->ticks += ticks;
+            return;
+        }
+        index = (index + 1) % FRAME_PROFILER_MAX_FUNCS;
+    }
+}
+
+// Printed as lines starting with "FP" that tools/frame_profiler/report.py
+// reads from the mGBA log. Addresses are left for the script to turn into
+// function names, and all times are in CPU cycles.
+static void ReportWindow(void)
+{
+    u32 i;
+
+    DebugPrintf("FP W %x %d", (uintptr_t)sFrameProfiler.callback2, sFrameProfiler.numFrames);
+    for (i = 0; i < FRAME_STAGE_COUNT; i++)
+    {
+        const struct FrameProfilerStageStats *stats = &sFrameProfiler.stages[i];
+        const u16 *h = stats->histogram;
+        DebugPrintf("FP S %s %d %d %d %d %d %d %d %d %d %d %d %d %d %d",
+                    sStageNames[i],
+                    stats->minTicks * FRAME_PROFILER_CYCLES_PER_TICK,
+                    stats->totalTicks * FRAME_PROFILER_CYCLES_PER_TICK,
+                    stats->maxTicks * FRAME_PROFILER_CYCLES_PER_TICK,
+                    h[0], h[1], h[2], h[3], h[4], h[5], h[6], h[7], h[8], h[9], h[10]);
+    }
+    for (i = 0; i < FRAME_PROFILER_MAX_FUNCS; i++)
+    {
+        const struct FrameProfilerFunc *entry = &sFrameProfiler.funcs[i];
+        if (entry->func != NULL)
+            DebugPrintf("FP F %s %x %d %d", sStageNames[entry->stage], (uintptr_t)entry->func, entry->calls, entry->ticks * FRAME_PROFILER_CYCLES_PER_TICK);
+    }
+    // Bytes that ProcessDma3Requests copied
+    DebugPrintf("FP D %d %d", sFrameProfiler.dmaBytes, sFrameProfiler.maxDmaBytes);
+    DebugPrintf("FP E");
+}
+
+void FrameProfilerEndFrame(u32 frameStart)
+{
+    u32 i;
+
+    // Timer 1 is shared with the RNG seed: StartTimer1 runs it at 1 cycle
+    // per tick, and SeedRngAndSetTrainerId stops it. Put it back to 64
+    // cycles per tick, and drop this frame, which was measured at the wrong
+    // rate. Timer 2 still counts its overflows, so the seed keeps varying.
+    if ((REG_TM1CNT_H & (TIMER_ENABLE | TIMER_COUNTUP | TIMER_1024CLK)) != (TIMER_ENABLE | TIMER_64CLK))
+    {
+        StartTimer();
+        for (i = 0; i < FRAME_STAGE_COUNT; i++)
+            sFrameProfiler.frameTicks[i] = 0;
+        return;
+    }
+
+    FrameProfilerAddStage(FRAME_STAGE_BUSY, frameStart);
+
+    for (i = 0; i < FRAME_STAGE_COUNT; i++)
+    {
+        struct FrameProfilerStageStats *stats = &sFrameProfiler.stages[i];
+        u32 ticks = sFrameProfiler.frameTicks[i];
+        u32 bucket = ticks * FRAME_PROFILER_CYCLES_PER_TICK * (FRAME_PROFILER_NUM_BUCKETS - 1) / FRAME_PROFILER_CYCLES_PER_FRAME;
+
+        if (ticks < stats->minTicks)
+            stats->minTicks = ticks;
+        if (ticks > stats->maxTicks)
+            stats->maxTicks = ticks;
+        stats->totalTicks += ticks;
+        stats->histogram[min(bucket, FRAME_PROFILER_NUM_BUCKETS - 1)]++;
+        sFrameProfiler.frameTicks[i] = 0;
+    }
+    sFrameProfiler.dmaBytes += gDma3Stats.lastVBlankBytes;
+    if (gDma3Stats.lastVBlankBytes > sFrameProfiler.maxDmaBytes)
+        sFrameProfiler.maxDmaBytes = gDma3Stats.lastVBlankBytes;
+    sFrameProfiler.numFrames++;
+
+    if (sFrameProfiler.numFrames >= FRAME_PROFILER_WINDOW_FRAMES || sFrameProfiler.callback2 != gMain.callback2)
+    {
+        ReportWindow();
+        ResetWindow();
+    }
+}
+
+#endif // DEBUG_FRAME_PROFILER
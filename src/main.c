@@ -2,6 +2,7 @@
 #include "crt0.h"
 #include "malloc.h"
 #include "link.h"
+#include "frame_profiler.h"
 #include "link_rfu.h"
 #include "librfu.h"
 #include "m4a.h"
@@ -28,6 +29,7 @@
 #include "constants/rgb.h"
 
 static void VBlankIntr(void);
+static void RunVBlank(void);
 static void HBlankIntr(void);
 static void VCountIntr(void);
 static void SerialIntr(void);
@@ -111,6 +113,7 @@ void AgbMain()
     ResetBgs();
     SetDefaultFontsPointer();
     InitHeap(gHeap, HEAP_SIZE);
+    FrameProfilerInit();
 
     gSoftResetDisabled = FALSE;
 
@@ -134,6 +137,8 @@ void AgbMainLoop(void)
 {
     for (;;)
     {
+        u32 frameStart = FrameProfilerTime();
+
         ReadKeys();
 
         if (gSoftResetDisabled == FALSE
@@ -168,6 +173,7 @@ void AgbMainLoop(void)
 
         PlayTimeCounter_Update();
         MapMusicMain();
+        FrameProfilerEndFrame(frameStart);
         WaitForVBlank();
     }
 }
@@ -191,11 +197,18 @@ static void InitMainCallbacks(void)
 
 static void CallCallbacks(void)
 {
+    u32 start = FrameProfilerTime();
+
     if (gMain.callback1)
         gMain.callback1();
 
+    FrameProfilerAddStage(FRAME_STAGE_CALLBACK1, start);
+    start = FrameProfilerTime();
+
     if (gMain.callback2)
         gMain.callback2();
+
+    FrameProfilerAddStage(FRAME_STAGE_CALLBACK2, start);
 }
 
 void SetMainCallback2(MainCallback callback)
@@ -355,6 +368,18 @@ void SetSerialCallback(IntrCallback callback)
 
 static void VBlankIntr(void)
 {
+    // Headless turbo runs it from WaitForVBlank instead, see T_HEADLESS_TURBO.
+    if (!gTestRunnerTurbo)
+        RunVBlank();
+
+    INTR_CHECK |= INTR_FLAG_VBLANK;
+    gMain.intrCheck |= INTR_FLAG_VBLANK;
+}
+
+static void RunVBlank(void)
+{
+    u32 start = FrameProfilerTime();
+
     if (gWirelessCommType != 0)
         RfuVSync();
     else if (gLinkVSyncDisabled == FALSE)
@@ -383,8 +408,7 @@ static void VBlankIntr(void)
 
     UpdateWirelessStatusIndicatorSprite();
 
-    INTR_CHECK |= INTR_FLAG_VBLANK;
-    gMain.intrCheck |= INTR_FLAG_VBLANK;
+    FrameProfilerAddStage(FRAME_STAGE_VBLANK, start);
 }
 
 void InitFlashTimer(void)
@@ -427,7 +451,18 @@ static void WaitForVBlank(void)
 {
     gMain.intrCheck &= ~INTR_FLAG_VBLANK;
 
-    if (gWirelessCommType != 0)
+    if (gTestRunnerTurbo)
+    {
+        // Ends the frame now instead of when the display gets to VBlank.
+        // Interrupts are off like they are in VBlankIntr.
+        u16 ime = REG_IME;
+
+        REG_IME = 0;
+        RunVBlank();
+        REG_IME = ime;
+        gMain.intrCheck |= INTR_FLAG_VBLANK;
+    }
+    else if (gWirelessCommType != 0)
     {
         // Desynchronization may occur if wireless adapter is connected
         // and we call VBlankIntrWait();
@@ -9,6 +9,188 @@ static u32 sHeapSize;
 
 ALIGNED(4) EWRAM_DATA u8 gHeap[HEAP_SIZE] = {0};
 
+struct FreeListLinks {
+    struct MemBlock *prev;
+    struct MemBlock *next;
+};
+
+// Free blocks are kept in segregated free lists, one per size class, so that
+// allocating doesn't have to walk every block in the heap.
+// Sizes up to SMALL_SIZE_CLASS_MAX each have their own class, so any block
+// in the class fits. Larger sizes are grouped by their highest set bit and
+// searched first-fit within the class.
+// The blocks themselves stay in the address ordered list used for merging
+// neighbours on free and for the leak checks in the test runner.
+#define MIN_ALLOC_SIZE          sizeof(struct FreeListLinks) // Free blocks store their links in their data.
+#define SMALL_SIZE_CLASS_MAX    256
+#define NUM_SMALL_SIZE_CLASSES  ((SMALL_SIZE_CLASS_MAX - MIN_ALLOC_SIZE) / 4 + 1)
+#define FIRST_LARGE_SIZE_BIT    8
+#define NUM_LARGE_SIZE_CLASSES  10
+#define NUM_SIZE_CLASSES        (NUM_SMALL_SIZE_CLASSES + NUM_LARGE_SIZE_CLASSES)
+#define SIZE_CLASS_MASK_WORDS   ((NUM_SIZE_CLASSES + 31) / 32)
+
+EWRAM_DATA struct HeapStats gHeapStats = {0};
+static EWRAM_DATA struct MemBlock *sFreeLists[NUM_SIZE_CLASSES] = {0};
+static EWRAM_DATA u32 sFreeListMask[SIZE_CLASS_MASK_WORDS] = {0};
+
+#if T_HEAP_PROFILE
+EWRAM_DATA struct HeapAllocSite gHeapAllocSites[HEAP_PROFILE_MAX_SITES] = {0};
+
+static struct HeapAllocSite *GetHeapAllocSite(const char *location)
+{
+    u32 i;
+
+    if (location != NULL)
+    {
+        for (i = 0; i < HEAP_PROFILE_MAX_SITES - 1; i++)
+        {
+            if (gHeapAllocSites[i].location == location)
+                return &gHeapAllocSites[i];
+            if (gHeapAllocSites[i].location == NULL)
+            {
+                gHeapAllocSites[i].location = location;
+                return &gHeapAllocSites[i];
+            }
+        }
+    }
+    return &gHeapAllocSites[HEAP_PROFILE_MAX_SITES - 1];
+}
+
+// Called after gHeapStats has been updated for the new block.
+static void ProfileAlloc(struct MemBlock *block, const char *location)
+{
+    struct HeapAllocSite *site = GetHeapAllocSite(location);
+    u32 bytes = sizeof(struct MemBlock) + block->size;
+    u32 i;
+
+    site->numAllocations++;
+    site->totalBytes += bytes;
+    site->liveBytes += bytes;
+    if (site->liveBytes > site->peakLiveBytes)
+        site->peakLiveBytes = site->liveBytes;
+
+    if (gHeapStats.usedBytes == gHeapStats.peakUsedBytes)
+    {
+        for (i = 0; i < HEAP_PROFILE_MAX_SITES; i++)
+            gHeapAllocSites[i].bytesAtPeak = gHeapAllocSites[i].liveBytes;
+    }
+}
+
+static void ProfileFree(struct MemBlock *block)
+{
+    struct HeapAllocSite *site = GetHeapAllocSite(MemBlockLocation(block));
+
+    site->liveBytes -= sizeof(struct MemBlock) + block->size;
+}
+#endif
+
+static inline struct FreeListLinks *GetFreeListLinks(struct MemBlock *block)
+{
+    return (struct FreeListLinks *)block->data;
+}
+
+static u32 GetSizeClass(u32 size)
+{
+    if (size <= SMALL_SIZE_CLASS_MAX)
+        return (size - MIN_ALLOC_SIZE) / 4;
+    return NUM_SMALL_SIZE_CLASSES + (31 - __builtin_clz(size)) - FIRST_LARGE_SIZE_BIT;
+}
+
+static void InsertFreeBlock(struct MemBlock *block)
+{
+    u32 sizeClass = GetSizeClass(block->size);
+    struct FreeListLinks *links = GetFreeListLinks(block);
+
+    links->prev = NULL;
+    links->next = sFreeLists[sizeClass];
+    if (links->next != NULL)
+        GetFreeListLinks(links->next)->prev = block;
+    sFreeLists[sizeClass] = block;
+    sFreeListMask[sizeClass / 32] |= 1u << (sizeClass % 32);
+}
+
+static void RemoveFreeBlock(struct MemBlock *block)
+{
+    u32 sizeClass = GetSizeClass(block->size);
+    struct FreeListLinks *links = GetFreeListLinks(block);
+
+    if (links->prev != NULL)
+        GetFreeListLinks(links->prev)->next = links->next;
+    else
+        sFreeLists[sizeClass] = links->next;
+    if (links->next != NULL)
+        GetFreeListLinks(links->next)->prev = links->prev;
+    if (sFreeLists[sizeClass] == NULL)
+        sFreeListMask[sizeClass / 32] &= ~(1u << (sizeClass % 32));
+}
+
+// Returns the first non-empty size class at or above sizeClass, or NUM_SIZE_CLASSES.
+static u32 FindNonEmptySizeClass(u32 sizeClass)
+{
+    u32 word = sizeClass / 32;
+    u32 bits = sFreeListMask[word] & (~0u << (sizeClass % 32));
+
+    while (bits == 0)
+    {
+        if (++word == SIZE_CLASS_MASK_WORDS)
+            return NUM_SIZE_CLASSES;
+        bits = sFreeListMask[word];
+    }
+    return word * 32 + __builtin_ctz(bits);
+}
+
+static struct MemBlock *FindFreeBlock(u32 size)
+{
+    u32 sizeClass = GetSizeClass(size);
+    struct MemBlock *block;
+
+    // Blocks in a large size class can still be too small.
+    if (sizeClass >= NUM_SMALL_SIZE_CLASSES)
+    {
+        for (block = sFreeLists[sizeClass]; block != NULL; block = GetFreeListLinks(block)->next)
+        {
+            if (block->size >= size)
+                return block;
+        }
+        sizeClass++;
+    }
+
+    sizeClass = FindNonEmptySizeClass(sizeClass);
+    if (sizeClass == NUM_SIZE_CLASSES)
+        return NULL;
+    return sFreeLists[sizeClass];
+}
+
+static u32 GetLargestFreeBlockSize(void)
+{
+    s32 sizeClass;
+    u32 largest = 0;
+    struct MemBlock *block;
+
+    for (sizeClass = NUM_SIZE_CLASSES - 1; sizeClass >= 0; sizeClass--)
+    {
+        for (block = sFreeLists[sizeClass]; block != NULL; block = GetFreeListLinks(block)->next)
+        {
+            if (block->size > largest)
+                largest = block->size;
+        }
+        if (largest != 0)
+            break;
+    }
+    return largest;
+}
+
+// The percentage of the heap that is free, but not part of the largest free block.
+u32 GetHeapFragmentation(void)
+{
+    u32 freeBytes = sHeapSize - gHeapStats.usedBytes;
+    u32 largest = GetLargestFreeBlockSize();
+
+    if (largest == 0)
+        return 0;
+    return (freeBytes - largest - sizeof(struct MemBlock)) * 100 / sHeapSize;
+}
+
 void PutMemBlockHeader(void *block, struct MemBlock *prev, struct MemBlock *next, u32 size)
 {
     struct MemBlock *header = (struct MemBlock *)block;
@@ -29,88 +211,91 @@ void PutFirstMemBlockHeader(void *block, u32 size)
 
 void *AllocInternal(void *heapStart, u32 size, const char *location)
 {
-    struct MemBlock *pos = (struct MemBlock *)heapStart;
-    struct MemBlock *head = pos;
+    struct MemBlock *head = (struct MemBlock *)heapStart;
+    struct MemBlock *pos;
     struct MemBlock *splitBlock;
     u32 foundBlockSize;
 
     // Alignment
     if (size & 3)
         size = 4 * ((size / 4) + 1);
+    if (size < MIN_ALLOC_SIZE)
+        size = MIN_ALLOC_SIZE;
 
-    for (;;)
+    pos = FindFreeBlock(size);
+    if (pos != NULL)
     {
-        // Loop through the blocks looking for unused block that's big enough.
+        RemoveFreeBlock(pos);
+        foundBlockSize = pos->size;
 
-        if (!pos->allocated)
+        if (foundBlockSize - size < 2 * sizeof(struct MemBlock))
         {
-            foundBlockSize = pos->size;
+            // The block isn't much bigger than the requested size,
+            // so just use it.
+            pos->allocated = TRUE;
+        }
+        else
+        {
+            // The block is significantly bigger than the requested
+            // size, so split the rest into a separate block.
+            foundBlockSize -= sizeof(struct MemBlock);
+            foundBlockSize -= size;
 
-            if (foundBlockSize >= size)
-            {
-                if (foundBlockSize - size < 2 * sizeof(struct MemBlock))
-                {
-                    // The block isn't much bigger than the requested size,
-                    // so just use it.
-                    pos->allocated = TRUE;
-                }
-                else
-                {
-                    // The block is significantly bigger than the requested
-                    // size, so split the rest into a separate block.
-                    foundBlockSize -= sizeof(struct MemBlock);
-                    foundBlockSize -= size;
+            splitBlock = (struct MemBlock *)(pos->data + size);
 
-                    splitBlock = (struct MemBlock *)(pos->data + size);
+            pos->allocated = TRUE;
+            pos->size = size;
 
-                    pos->allocated = TRUE;
-                    pos->size = size;
+            PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
 
-                    PutMemBlockHeader(splitBlock, pos, pos->next, foundBlockSize);
+            pos->next = splitBlock;
 
-                    pos->next = splitBlock;
+            if (splitBlock->next != head)
+                splitBlock->next->prev = splitBlock;
 
-                    if (splitBlock->next != head)
-                        splitBlock->next->prev = splitBlock;
-                }
+            InsertFreeBlock(splitBlock);
+        }
 
-                pos->locationHi = ((uintptr_t)location) >> 14;
-                pos->locationLo = (uintptr_t)location;
+        pos->locationHi = ((uintptr_t)location) >> 14;
+        pos->locationLo = (uintptr_t)location;
 
-                return pos->data;
-            }
-        }
+        gHeapStats.usedBytes += sizeof(struct MemBlock) + pos->size;
+        gHeapStats.numAllocations++;
+        if (gHeapStats.usedBytes > gHeapStats.peakUsedBytes)
+            gHeapStats.peakUsedBytes = gHeapStats.usedBytes;
 
-        if (pos->next == head)
-        {
-#if TESTING
-            const struct MemBlock *head = HeapHead();
-            const struct MemBlock *block = head;
-            do
-            {
-                if (block->allocated)
-                {
-                    const char *location = MemBlockLocation(block);
-                    if (location)
-                        Test_MgbaPrintf("%s: %d bytes allocated", location, block->size);
-                    else
-                        Test_MgbaPrintf("<unknown>: %d bytes allocated", block->size);
-                }
-                block = block->next;
-            }
-            while (block != head);
-            Test_ExitWithResult(TEST_RESULT_ERROR, SourceLine(0), ":L%s:%d, %s: OOM allocating %d bytes", gTestRunnerState.test->filename, SourceLine(0), location, size);
+#if T_HEAP_PROFILE
+        ProfileAlloc(pos, location);
 #endif
-            if (location)
+
+        return pos->data;
+    }
+
+#if TESTING
+    {
+        const struct MemBlock *block = head;
+        do
+        {
+            if (block->allocated)
             {
-                DebugPrintfLevel(MGBA_LOG_ERROR, "%s: out of memory trying to allocate %d bytes", location, size);
+                const char *location = MemBlockLocation(block);
+                if (location)
+                    Test_MgbaPrintf("%s: %d bytes allocated", location, block->size);
+                else
+                    Test_MgbaPrintf("<unknown>: %d bytes allocated", block->size);
             }
-            AGB_ASSERT(FALSE);
-            return NULL;
+            block = block->next;
         }
-
-        pos = pos->next;
+        while (block != head);
+        Test_ExitWithResult(TEST_RESULT_ERROR, SourceLine(0), ":L%s:%d, %s: OOM allocating %d bytes", gTestRunnerState.test->filename, SourceLine(0), location, size);
     }
+#endif
+    if (location)
+    {
+        DebugPrintfLevel(MGBA_LOG_ERROR, "%s: out of memory trying to allocate %d bytes", location, size);
+    }
+    AGB_ASSERT(FALSE);
+    return NULL;
 }
 
 void FreeInternal(void *heapStart, void *pointer)
@@ -121,14 +306,21 @@ void FreeInternal(void *heapStart, void *pointer)
         struct MemBlock *block = (struct MemBlock *)((u8 *)pointer - sizeof(struct MemBlock));
         AGB_ASSERT(block->magic == MALLOC_SYSTEM_ID);
         AGB_ASSERT(block->allocated == TRUE);
+#if T_HEAP_PROFILE
+        ProfileFree(block);
+#endif
         block->allocated = FALSE;
 
+        gHeapStats.usedBytes -= sizeof(struct MemBlock) + block->size;
+        gHeapStats.numAllocations--;
+
         // If the freed block isn't the last one, merge with the next block
         // if it's not in use.
         if (block->next != head)
         {
             if (!block->next->allocated)
             {
+                RemoveFreeBlock(block->next);
                 block->size += sizeof(struct MemBlock) + block->next->size;
                 block->next->magic = 0;
                 block->next = block->next->next;
@@ -145,6 +337,7 @@ void FreeInternal(void *heapStart, void *pointer)
             {
                 AGB_ASSERT(block->prev->magic == MALLOC_SYSTEM_ID);
 
+                RemoveFreeBlock(block->prev);
                 block->prev->next = block->next;
 
                 if (block->next != head)
@@ -152,8 +345,21 @@ void FreeInternal(void *heapStart, void *pointer)
 
                 block->magic = 0;
                 block->prev->size += sizeof(struct MemBlock) + block->size;
+                block = block->prev;
             }
         }
+
+        InsertFreeBlock(block);
+
+#if TESTING
+        // Allocating never increases fragmentation, so freeing is the only place it can peak.
+        // Only tests read the peak, and working it out walks the whole heap.
+        {
+            u32 fragmentation = GetHeapFragmentation();
+            if (fragmentation > gHeapStats.peakFragmentation)
+                gHeapStats.peakFragmentation = fragmentation;
+        }
+#endif
     }
 }
 
@@ -203,6 +409,13 @@ void InitHeap(void *heapStart, u32 heapSize)
     sHeapStart = heapStart;
     sHeapSize = heapSize;
     PutFirstMemBlockHeader(heapStart, heapSize);
+    memset(sFreeLists, 0, sizeof(sFreeLists));
+    memset(sFreeListMask, 0, sizeof(sFreeListMask));
+    memset(&gHeapStats, 0, sizeof(gHeapStats));
+#if T_HEAP_PROFILE
+    memset(gHeapAllocSites, 0, sizeof(gHeapAllocSites));
+#endif
+    InsertFreeBlock((struct MemBlock *)heapStart);
 }
 
 void *Alloc_(u32 size, const char *location)
@@ -220,12 +433,106 @@ void Free(void *pointer)
     FreeInternal(sHeapStart, pointer);
 }
 
+struct ArenaChunk {
+    struct ArenaChunk *next;
+    u8 data[0];
+};
+
+// Allocations bigger than this get a chunk of their own, so that they
+// don't leave most of the current chunk unused.
+#define ARENA_LARGE_ALLOC_SIZE (ARENA_CHUNK_SIZE / 4)
+
+void InitArena(struct Arena *arena)
+{
+    arena->chunks = NULL;
+    arena->pos = NULL;
+    arena->end = NULL;
+}
+
+void *ArenaAlloc_(struct Arena *arena, u32 size, const char *location)
+{
+    struct ArenaChunk *chunk;
+    u8 *mem;
+
+    // Alignment, and every allocation gets its own address.
+    if (size == 0 || (size & 3))
+        size = 4 * ((size / 4) + 1);
+
+    if (size <= (u32)(arena->end - arena->pos))
+    {
+        mem = arena->pos;
+        arena->pos += size;
+        return mem;
+    }
+
+    if (size > ARENA_LARGE_ALLOC_SIZE)
+    {
+        chunk = AllocInternal(sHeapStart, sizeof(struct ArenaChunk) + size, location);
+        if (chunk == NULL)
+            return NULL;
+
+        // Link it behind the chunk that is being bumped through, so that
+        // the rest of that chunk can still be used.
+        if (arena->chunks != NULL)
+        {
+            chunk->next = arena->chunks->next;
+            arena->chunks->next = chunk;
+        }
+        else
+        {
+            chunk->next = NULL;
+            arena->chunks = chunk;
+        }
+        return chunk->data;
+    }
+
+    chunk = AllocInternal(sHeapStart, sizeof(struct ArenaChunk) + ARENA_CHUNK_SIZE, location);
+    if (chunk == NULL)
+        return NULL;
+
+    chunk->next = arena->chunks;
+    arena->chunks = chunk;
+    arena->pos = chunk->data + size;
+    arena->end = chunk->data + ARENA_CHUNK_SIZE;
+    return chunk->data;
+}
+
+void *ArenaAllocZeroed_(struct Arena *arena, u32 size, const char *location)
+{
+    void *mem = ArenaAlloc_(arena, size, location);
+
+    if (mem != NULL)
+    {
+        if (size & 3)
+            size = 4 * ((size / 4) + 1);
+
+        CpuFill32(0, mem, size);
+    }
+
+    return mem;
+}
+
+void FreeArena(struct Arena *arena)
+{
+    struct ArenaChunk *chunk = arena->chunks;
+    struct ArenaChunk *next;
+
+    while (chunk != NULL)
+    {
+        next = chunk->next;
+        FreeInternal(sHeapStart, chunk);
+        chunk = next;
+    }
+
+    InitArena(arena);
+}
+
 bool32 CheckMemBlock(void *pointer)
 {
     return CheckMemBlockInternal(sHeapStart, pointer);
 }
 
-bool32 CheckHeap()
+bool32 CheckHeap(void)
 {
     struct MemBlock *pos = (struct MemBlock *)sHeapStart;
 
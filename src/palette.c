@@ -3,6 +3,7 @@
 #include "util.h"
 #include "decompress.h"
 #include "task.h"
+#include "test_runner.h"
 
 enum
 {
@@ -65,7 +66,8 @@ void TransferPlttBuffer(void)
     {
         void *src = gPlttBufferFaded;
         void *dest = (void *)PLTT;
-        DmaCopy16(3, src, dest, PLTT_SIZE);
+        if (!gTestRunnerTurbo)
+            DmaCopy16(3, src, dest, PLTT_SIZE);
         sPlttBufferTransferPending = FALSE;
         if (gPaletteFade.mode == HARDWARE_FADE && gPaletteFade.active)
             UpdateBlendRegisters();
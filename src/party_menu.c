@@ -415,6 +415,7 @@ static void TryUseItemOnMove(u8 taskId);
 static u16 ItemEffectToMonEv(struct Pokemon *mon, u8 effectType);
 static void ItemEffectToStatString(u8 effectType, u8 *dest);
 
+static EWRAM_DATA struct Arena sPartyMenuArena = {0}; // Everything that lives until the party menu closes
 static EWRAM_DATA struct PartyMenuInternal *sPartyMenuInternal = NULL;
 EWRAM_DATA struct PartyMenu gPartyMenu = {0};
 static EWRAM_DATA struct PartyMenuBox *sPartyMenuBoxes = NULL;
@@ -448,7 +449,7 @@ void InitPartyMenu(u8 menuType, u8 layout, u8 partyAction, bool8 keepCursorPos,
     u16 i;
 
     ResetPartyMenu();
-    sPartyMenuInternal = Alloc(sizeof(struct PartyMenuInternal));
+    sPartyMenuInternal = ArenaAlloc(&sPartyMenuArena, sizeof(struct PartyMenuInternal));
     if (sPartyMenuInternal == NULL)
         SetMainCallback2(callback);
     else
@@ -771,6 +772,7 @@ static void Task_ExitPartyMenu(u8 taskId)
 
 static void ResetPartyMenu(void)
 {
+    InitArena(&sPartyMenuArena);
     sPartyMenuInternal = NULL;
     sPartyBgTilemapBuffer = NULL;
     sPartyMenuBoxes = NULL;
@@ -779,7 +781,7 @@ static void ResetPartyMenu(void)
 
 static bool8 AllocPartyMenuBg(void)
 {
-    sPartyBgTilemapBuffer = Alloc(0x800);
+    sPartyBgTilemapBuffer = ArenaAlloc(&sPartyMenuArena, 0x800);
     if (sPartyBgTilemapBuffer == NULL)
         return FALSE;
     memset(sPartyBgTilemapBuffer, 0, 0x800);
@@ -803,7 +805,9 @@ static bool8 AllocPartyMenuBgGfx(void)
     switch (sPartyMenuInternal->data[0])
     {
     case 0:
-        sPartyBgGfxTilemap = malloc_and_decompress(gPartyMenuBg_Gfx, &sizeout);
+        sizeout = GetDecompressedDataSize(gPartyMenuBg_Gfx);
+        sPartyBgGfxTilemap = ArenaAlloc(&sPartyMenuArena, sizeout);
+        DecompressDataWithHeaderWram(gPartyMenuBg_Gfx, sPartyBgGfxTilemap);
         LoadBgTiles(1, sPartyBgGfxTilemap, sizeout, 0);
         ++sPartyMenuInternal->data[0];
         break;
@@ -854,20 +858,17 @@ static void PartyPaletteBufferCopy(u8 offset)
 
 static void FreePartyPointers(void)
 {
-    if (sPartyMenuInternal)
-        Free(sPartyMenuInternal);
-    if (sPartyBgTilemapBuffer)
-        Free(sPartyBgTilemapBuffer);
-    if (sPartyBgGfxTilemap)
-        Free(sPartyBgGfxTilemap);
-    if (sPartyMenuBoxes)
-        Free(sPartyMenuBoxes);
+    FreeArena(&sPartyMenuArena);
+    sPartyMenuInternal = NULL;
+    sPartyBgTilemapBuffer = NULL;
+    sPartyBgGfxTilemap = NULL;
+    sPartyMenuBoxes = NULL;
     FreeAllWindowBuffers();
 }
 
 static void InitPartyMenuBoxes(u8 layout)
 {
-    sPartyMenuBoxes = Alloc(sizeof(struct PartyMenuBox[PARTY_SIZE]));
+    sPartyMenuBoxes = ArenaAlloc(&sPartyMenuArena, sizeof(struct PartyMenuBox[PARTY_SIZE]));
     LoadPartyMenuBoxes(layout);
 }
 
@@ -3629,9 +3630,14 @@ static void Task_SlideSelectedSlotsOnscreen(u8 taskId)
         PutWindowTilemap(sPartyMenuBoxes[gPartyMenu.slotId].windowId);
         PutWindowTilemap(sPartyMenuBoxes[gPartyMenu.slotId2].windowId);
         ScheduleBgCopyTilemapToVram(0);
+#ifdef BUGFIX
+        FREE_AND_SET_NULL(sSlot1TilemapBuffer);
+        FREE_AND_SET_NULL(sSlot2TilemapBuffer);
+#else
         // BUG: memory leak
         // Free(sSlot1TilemapBuffer);
         // Free(sSlot2TilemapBuffer);
+#endif
         FinishTwoMonAction(taskId);
     }
     // Continue sliding
@@ -848,6 +848,7 @@ const struct NatureInfo gNaturesInfo[NUM_NATURES] =
 #include "data/pokemon/form_species_tables.h"
 #include "data/pokemon/form_change_tables.h"
 #include "data/pokemon/form_change_table_pointers.h"
+#include "data/pokemon/dex_index.h"
 #include "data/object_events/object_event_pic_tables_followers.h"
 
 #include "data/pokemon/species_info.h"
@@ -1922,26 +1923,35 @@ static u16 CalculateBoxMonChecksum(struct BoxPokemon *boxMon)
 
 void CalculateMonStats(struct Pokemon *mon)
 {
+    struct BoxMonView view;
     s32 oldMaxHP = GetMonData(mon, MON_DATA_MAX_HP, NULL);
     s32 currentHP = GetMonData(mon, MON_DATA_HP, NULL);
-    s32 hpIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_HP) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_HP_IV, NULL);
-    s32 hpEV = GetMonData(mon, MON_DATA_HP_EV, NULL);
-    s32 attackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_ATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_ATK_IV, NULL);
-    s32 attackEV = GetMonData(mon, MON_DATA_ATK_EV, NULL);
-    s32 defenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_DEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_DEF_IV, NULL);
-    s32 defenseEV = GetMonData(mon, MON_DATA_DEF_EV, NULL);
-    s32 speedIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPEED) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPEED_IV, NULL);
-    s32 speedEV = GetMonData(mon, MON_DATA_SPEED_EV, NULL);
-    s32 spAttackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPATK_IV, NULL);
-    s32 spAttackEV = GetMonData(mon, MON_DATA_SPATK_EV, NULL);
-    s32 spDefenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPDEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPDEF_IV, NULL);
-    s32 spDefenseEV = GetMonData(mon, MON_DATA_SPDEF_EV, NULL);
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u8 friendship = GetMonData(mon, MON_DATA_FRIENDSHIP, NULL);
-    s32 level = GetLevelFromMonExp(mon);
+    s32 hpIV, hpEV, attackIV, attackEV, defenseIV, defenseEV, speedIV, speedEV;
+    s32 spAttackIV, spAttackEV, spDefenseIV, spDefenseEV;
+    u16 species;
+    u8 friendship;
+    s32 level;
     s32 newMaxHP;
-
-    u8 nature = GetMonData(mon, MON_DATA_HIDDEN_NATURE, NULL);
+    u8 nature;
+
+    OpenBoxMonView(&view, &mon->box);
+    hpIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_HP) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_HP_IV);
+    hpEV = GetBoxMonViewData(&view, MON_DATA_HP_EV);
+    attackIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_ATK) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_ATK_IV);
+    attackEV = GetBoxMonViewData(&view, MON_DATA_ATK_EV);
+    defenseIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_DEF) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_DEF_IV);
+    defenseEV = GetBoxMonViewData(&view, MON_DATA_DEF_EV);
+    speedIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_SPEED) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_SPEED_IV);
+    speedEV = GetBoxMonViewData(&view, MON_DATA_SPEED_EV);
+    spAttackIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_SPATK) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_SPATK_IV);
+    spAttackEV = GetBoxMonViewData(&view, MON_DATA_SPATK_EV);
+    spDefenseIV = GetBoxMonViewData(&view, MON_DATA_HYPER_TRAINED_SPDEF) ? MAX_PER_STAT_IVS : GetBoxMonViewData(&view, MON_DATA_SPDEF_IV);
+    spDefenseEV = GetBoxMonViewData(&view, MON_DATA_SPDEF_EV);
+    species = GetBoxMonViewData(&view, MON_DATA_SPECIES);
+    friendship = GetBoxMonViewData(&view, MON_DATA_FRIENDSHIP);
+    level = GetLevelFromBoxMonViewExp(&view);
+    nature = GetBoxMonViewData(&view, MON_DATA_HIDDEN_NATURE);
+    CloseBoxMonView(&view);
 
     SetMonData(mon, MON_DATA_LEVEL, &level);
 
@@ -2001,20 +2011,24 @@ void BoxMonToMon(const struct BoxPokemon *src, struct Pokemon *dest)
 
 u8 GetLevelFromMonExp(struct Pokemon *mon)
 {
-    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetMonData(mon, MON_DATA_EXP, NULL);
-    s32 level = 1;
+    return GetLevelFromBoxMonExp(&mon->box);
+}
 
-    while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
-        level++;
+u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon)
+{
+    struct BoxMonView view;
+    u8 level;
 
-    return level - 1;
+    OpenBoxMonView(&view, boxMon);
+    level = GetLevelFromBoxMonViewExp(&view);
+    CloseBoxMonView(&view);
+    return level;
 }
 
-u8 GetLevelFromBoxMonExp(struct BoxPokemon *boxMon)
+u8 GetLevelFromBoxMonViewExp(struct BoxMonView *view)
 {
-    u16 species = GetBoxMonData(boxMon, MON_DATA_SPECIES, NULL);
-    u32 exp = GetBoxMonData(boxMon, MON_DATA_EXP, NULL);
+    u16 species = GetBoxMonViewData(view, MON_DATA_SPECIES);
+    u32 exp = GetBoxMonViewData(view, MON_DATA_EXP);
     s32 level = 1;
 
     while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
@@ -2581,907 +2595,968 @@ union EvolutionTracker
     struct EvolutionTrackerBitfield asField;
 };
 
-/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
- * safety we have a GetBoxMonData macro (in include/pokemon.h) which
- * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
- * number of arguments. */
-u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+static u32 GetEncryptedBoxMonData(struct BoxMonView *view, s32 field, u8 *data)
 {
     s32 i;
     u32 retVal = 0;
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
+    struct BoxPokemon *boxMon = view->boxMon;
+    struct PokemonSubstruct0 *substruct0 = view->substruct0;
+    struct PokemonSubstruct1 *substruct1 = view->substruct1;
+    struct PokemonSubstruct2 *substruct2 = view->substruct2;
+    struct PokemonSubstruct3 *substruct3 = view->substruct3;
     union EvolutionTracker evoTracker;
 
-    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    switch (field)
     {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
-
-        DecryptBoxMon(boxMon);
-
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
+    case MON_DATA_NICKNAME:
+    case MON_DATA_NICKNAME10:
+    {
+        if (boxMon->isBadEgg)
         {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-        }
+            for (retVal = 0;
+                retVal < POKEMON_NAME_LENGTH && gText_BadEgg[retVal] != EOS;
+                data[retVal] = gText_BadEgg[retVal], retVal++) {}
 
-        switch (field)
+            data[retVal] = EOS;
+        }
+        else if (boxMon->isEgg)
         {
-        case MON_DATA_NICKNAME:
-        case MON_DATA_NICKNAME10:
+            StringCopy(data, gText_EggNickname);
+            retVal = StringLength(data);
+        }
+        else if (boxMon->language == LANGUAGE_JAPANESE)
         {
-            if (boxMon->isBadEgg)
-            {
-                for (retVal = 0;
-                    retVal < POKEMON_NAME_LENGTH && gText_BadEgg[retVal] != EOS;
-                    data[retVal] = gText_BadEgg[retVal], retVal++) {}
+            data[0] = EXT_CTRL_CODE_BEGIN;
+            data[1] = EXT_CTRL_CODE_JPN;
 
-                data[retVal] = EOS;
-            }
-            else if (boxMon->isEgg)
+            for (retVal = 2, i = 0;
+                i < 5 && boxMon->nickname[i] != EOS;
+                data[retVal] = boxMon->nickname[i], retVal++, i++) {}
+
+            data[retVal++] = EXT_CTRL_CODE_BEGIN;
+            data[retVal++] = EXT_CTRL_CODE_ENG;
+            data[retVal] = EOS;
+        }
+        else
+        {
+            retVal = 0;
+            while (retVal < min(sizeof(boxMon->nickname), POKEMON_NAME_LENGTH))
             {
-                StringCopy(data, gText_EggNickname);
-                retVal = StringLength(data);
+                data[retVal] = boxMon->nickname[retVal];
+                retVal++;
             }
-            else if (boxMon->language == LANGUAGE_JAPANESE)
-            {
-                data[0] = EXT_CTRL_CODE_BEGIN;
-                data[1] = EXT_CTRL_CODE_JPN;
-
-                for (retVal = 2, i = 0;
-                    i < 5 && boxMon->nickname[i] != EOS;
-                    data[retVal] = boxMon->nickname[i], retVal++, i++) {}
 
-                data[retVal++] = EXT_CTRL_CODE_BEGIN;
-                data[retVal++] = EXT_CTRL_CODE_ENG;
-                data[retVal] = EOS;
-            }
-            else
+            // Vanilla Pokémon have 0s in nickname11 and nickname12
+            // so if both are 0 we assume that this is a vanilla
+            // Pokémon and replace them with EOS. This means that
+            // two CHAR_SPACE at the end of a nickname are trimmed.
+            if (field != MON_DATA_NICKNAME10 && POKEMON_NAME_LENGTH >= 12)
             {
-                retVal = 0;
-                while (retVal < min(sizeof(boxMon->nickname), POKEMON_NAME_LENGTH))
+                if (substruct0->nickname11 == 0 && substruct0->nickname12 == 0)
                 {
-                    data[retVal] = boxMon->nickname[retVal];
-                    retVal++;
+                    data[retVal++] = EOS;
+                    data[retVal++] = EOS;
                 }
-
-                // Vanilla Pokémon have 0s in nickname11 and nickname12
-                // so if both are 0 we assume that this is a vanilla
-                // Pokémon and replace them with EOS. This means that
-                // two CHAR_SPACE at the end of a nickname are trimmed.
-                if (field != MON_DATA_NICKNAME10 && POKEMON_NAME_LENGTH >= 12)
-                {
-                    if (substruct0->nickname11 == 0 && substruct0->nickname12 == 0)
-                    {
-                        data[retVal++] = EOS;
-                        data[retVal++] = EOS;
-                    }
-                    else
-                    {
-                        data[retVal++] = substruct0->nickname11;
-                        data[retVal++] = substruct0->nickname12;
-                    }
-                }
-                else if (POKEMON_NAME_LENGTH >= 11)
+                else
                 {
-                    if (substruct0->nickname11 == 0)
-                    {
-                        data[retVal++] = EOS;
-                    }
-                    else
-                    {
-                        data[retVal++] = substruct0->nickname11;
-                    }
+                    data[retVal++] = substruct0->nickname11;
+                    data[retVal++] = substruct0->nickname12;
                 }
-
-                data[retVal] = EOS;
             }
-            break;
-        }
-        case MON_DATA_SPECIES:
-            retVal = boxMon->isBadEgg ? SPECIES_EGG : substruct0->species;
-            break;
-        case MON_DATA_HELD_ITEM:
-            retVal = substruct0->heldItem;
-            break;
-        case MON_DATA_EXP:
-            retVal = substruct0->experience;
-            break;
-        case MON_DATA_PP_BONUSES:
-            retVal = substruct0->ppBonuses;
-            break;
-        case MON_DATA_FRIENDSHIP:
-            retVal = substruct0->friendship;
-            break;
-        case MON_DATA_MOVE1:
-            retVal = substruct1->move1;
-            break;
-        case MON_DATA_MOVE2:
-            retVal = substruct1->move2;
-            break;
-        case MON_DATA_MOVE3:
-            retVal = substruct1->move3;
-            break;
-        case MON_DATA_MOVE4:
-            retVal = substruct1->move4;
-            break;
-        case MON_DATA_PP1:
-            retVal = substruct1->pp1;
-            break;
-        case MON_DATA_PP2:
-            retVal = substruct1->pp2;
-            break;
-        case MON_DATA_PP3:
-            retVal = substruct1->pp3;
-            break;
-        case MON_DATA_PP4:
-            retVal = substruct1->pp4;
-            break;
-        case MON_DATA_HP_EV:
-            retVal = substruct2->hpEV;
-            break;
-        case MON_DATA_ATK_EV:
-            retVal = substruct2->attackEV;
-            break;
-        case MON_DATA_DEF_EV:
-            retVal = substruct2->defenseEV;
-            break;
-        case MON_DATA_SPEED_EV:
-            retVal = substruct2->speedEV;
-            break;
-        case MON_DATA_SPATK_EV:
-            retVal = substruct2->spAttackEV;
-            break;
-        case MON_DATA_SPDEF_EV:
-            retVal = substruct2->spDefenseEV;
-            break;
-        case MON_DATA_COOL:
-            retVal = substruct2->cool;
-            break;
-        case MON_DATA_BEAUTY:
-            retVal = substruct2->beauty;
-            break;
-        case MON_DATA_CUTE:
-            retVal = substruct2->cute;
-            break;
-        case MON_DATA_SMART:
-            retVal = substruct2->smart;
-            break;
-        case MON_DATA_TOUGH:
-            retVal = substruct2->tough;
-            break;
-        case MON_DATA_SHEEN:
-            retVal = substruct2->sheen;
-            break;
-        case MON_DATA_POKERUS:
-            retVal = substruct3->pokerus;
-            break;
-        case MON_DATA_MET_LOCATION:
-            retVal = substruct3->metLocation;
-            break;
-        case MON_DATA_MET_LEVEL:
-            retVal = substruct3->metLevel;
-            break;
-        case MON_DATA_MET_GAME:
-            retVal = substruct3->metGame;
-            break;
-        case MON_DATA_POKEBALL:
-            retVal = substruct0->pokeball;
-            break;
-        case MON_DATA_OT_GENDER:
-            retVal = substruct3->otGender;
-            break;
-        case MON_DATA_HP_IV:
-            retVal = substruct3->hpIV;
-            break;
-        case MON_DATA_ATK_IV:
-            retVal = substruct3->attackIV;
-            break;
-        case MON_DATA_DEF_IV:
-            retVal = substruct3->defenseIV;
-            break;
-        case MON_DATA_SPEED_IV:
-            retVal = substruct3->speedIV;
-            break;
-        case MON_DATA_SPATK_IV:
-            retVal = substruct3->spAttackIV;
-            break;
-        case MON_DATA_SPDEF_IV:
-            retVal = substruct3->spDefenseIV;
-            break;
-        case MON_DATA_IS_EGG:
-            retVal = substruct3->isEgg;
-            break;
-        case MON_DATA_ABILITY_NUM:
-            retVal = substruct3->abilityNum;
-            break;
-        case MON_DATA_COOL_RIBBON:
-            retVal = substruct3->coolRibbon;
-            break;
-        case MON_DATA_BEAUTY_RIBBON:
-            retVal = substruct3->beautyRibbon;
-            break;
-        case MON_DATA_CUTE_RIBBON:
-            retVal = substruct3->cuteRibbon;
-            break;
-        case MON_DATA_SMART_RIBBON:
-            retVal = substruct3->smartRibbon;
-            break;
-        case MON_DATA_TOUGH_RIBBON:
-            retVal = substruct3->toughRibbon;
-            break;
-        case MON_DATA_CHAMPION_RIBBON:
-            retVal = substruct3->championRibbon;
-            break;
-        case MON_DATA_WINNING_RIBBON:
-            retVal = substruct3->winningRibbon;
-            break;
-        case MON_DATA_VICTORY_RIBBON:
-            retVal = substruct3->victoryRibbon;
-            break;
-        case MON_DATA_ARTIST_RIBBON:
-            retVal = substruct3->artistRibbon;
-            break;
-        case MON_DATA_EFFORT_RIBBON:
-            retVal = substruct3->effortRibbon;
-            break;
-        case MON_DATA_MARINE_RIBBON:
-            retVal = substruct3->marineRibbon;
-            break;
-        case MON_DATA_LAND_RIBBON:
-            retVal = substruct3->landRibbon;
-            break;
-        case MON_DATA_SKY_RIBBON:
-            retVal = substruct3->skyRibbon;
-            break;
-        case MON_DATA_COUNTRY_RIBBON:
-            retVal = substruct3->countryRibbon;
-            break;
-        case MON_DATA_NATIONAL_RIBBON:
-            retVal = substruct3->nationalRibbon;
-            break;
-        case MON_DATA_EARTH_RIBBON:
-            retVal = substruct3->earthRibbon;
-            break;
-        case MON_DATA_WORLD_RIBBON:
-            retVal = substruct3->worldRibbon;
-            break;
-        case MON_DATA_MODERN_FATEFUL_ENCOUNTER:
-            retVal = substruct3->modernFatefulEncounter;
-            break;
-        case MON_DATA_SPECIES_OR_EGG:
-            retVal = substruct0->species;
-            if (substruct0->species && (substruct3->isEgg || boxMon->isBadEgg))
-                retVal = SPECIES_EGG;
-            break;
-        case MON_DATA_IVS:
-            retVal = substruct3->hpIV
-                    | (substruct3->attackIV << 5)
-                    | (substruct3->defenseIV << 10)
-                    | (substruct3->speedIV << 15)
-                    | (substruct3->spAttackIV << 20)
-                    | (substruct3->spDefenseIV << 25);
-            break;
-        case MON_DATA_KNOWN_MOVES:
-            if (substruct0->species && !substruct3->isEgg)
+            else if (POKEMON_NAME_LENGTH >= 11)
             {
-                u16 *moves = (u16 *)data;
-                s32 i = 0;
-
-                while (moves[i] != MOVES_COUNT)
+                if (substruct0->nickname11 == 0)
                 {
-                    u16 move = moves[i];
-                    if (substruct1->move1 == move
-                        || substruct1->move2 == move
-                        || substruct1->move3 == move
-                        || substruct1->move4 == move)
-                        retVal |= (1u << i);
-                    i++;
+                    data[retVal++] = EOS;
+                }
+                else
+                {
+                    data[retVal++] = substruct0->nickname11;
                 }
             }
-            break;
-        case MON_DATA_RIBBON_COUNT:
-            retVal = 0;
-            if (substruct0->species && !substruct3->isEgg)
-            {
-                retVal += substruct3->coolRibbon;
-                retVal += substruct3->beautyRibbon;
-                retVal += substruct3->cuteRibbon;
-                retVal += substruct3->smartRibbon;
-                retVal += substruct3->toughRibbon;
-                retVal += substruct3->championRibbon;
-                retVal += substruct3->winningRibbon;
-                retVal += substruct3->victoryRibbon;
-                retVal += substruct3->artistRibbon;
-                retVal += substruct3->effortRibbon;
-                retVal += substruct3->marineRibbon;
-                retVal += substruct3->landRibbon;
-                retVal += substruct3->skyRibbon;
-                retVal += substruct3->countryRibbon;
-                retVal += substruct3->nationalRibbon;
-                retVal += substruct3->earthRibbon;
-                retVal += substruct3->worldRibbon;
-            }
-            break;
-        case MON_DATA_RIBBONS:
-            retVal = 0;
-            if (substruct0->species && !substruct3->isEgg)
-            {
-                retVal = substruct3->championRibbon
-                    | (substruct3->coolRibbon << 1)
-                    | (substruct3->beautyRibbon << 4)
-                    | (substruct3->cuteRibbon << 7)
-                    | (substruct3->smartRibbon << 10)
-                    | (substruct3->toughRibbon << 13)
-                    | (substruct3->winningRibbon << 16)
-                    | (substruct3->victoryRibbon << 17)
-                    | (substruct3->artistRibbon << 18)
-                    | (substruct3->effortRibbon << 19)
-                    | (substruct3->marineRibbon << 20)
-                    | (substruct3->landRibbon << 21)
-                    | (substruct3->skyRibbon << 22)
-                    | (substruct3->countryRibbon << 23)
-                    | (substruct3->nationalRibbon << 24)
-                    | (substruct3->earthRibbon << 25)
-                    | (substruct3->worldRibbon << 26);
-            }
-            break;
-        case MON_DATA_HYPER_TRAINED_HP:
-            retVal = substruct1->hyperTrainedHP;
-            break;
-        case MON_DATA_HYPER_TRAINED_ATK:
-            retVal = substruct1->hyperTrainedAttack;
-            break;
-        case MON_DATA_HYPER_TRAINED_DEF:
-            retVal = substruct1->hyperTrainedDefense;
-            break;
-        case MON_DATA_HYPER_TRAINED_SPEED:
-            retVal = substruct1->hyperTrainedSpeed;
-            break;
-        case MON_DATA_HYPER_TRAINED_SPATK:
-            retVal = substruct1->hyperTrainedSpAttack;
-            break;
-        case MON_DATA_HYPER_TRAINED_SPDEF:
-            retVal = substruct1->hyperTrainedSpDefense;
-            break;
-        case MON_DATA_IS_SHADOW:
-            retVal = substruct3->isShadow;
-            break;
-        case MON_DATA_DYNAMAX_LEVEL:
-            retVal = substruct3->dynamaxLevel;
-            break;
-        case MON_DATA_GIGANTAMAX_FACTOR:
-            retVal = substruct3->gigantamaxFactor;
-            break;
-        case MON_DATA_TERA_TYPE:
-            if (gSpeciesInfo[substruct0->species].forceTeraType)
-            {
-                retVal = gSpeciesInfo[substruct0->species].forceTeraType;
-            }
-            else if (substruct0->teraType == TYPE_NONE) // Tera Type hasn't been modified so we can just use the personality
-            {
-                const u8 *types = gSpeciesInfo[substruct0->species].types;
-                retVal = (boxMon->personality & 0x1) == 0 ? types[0] : types[1];
-            }
-            else
+
+            data[retVal] = EOS;
+        }
+        break;
+    }
+    case MON_DATA_SPECIES:
+        retVal = boxMon->isBadEgg ? SPECIES_EGG : substruct0->species;
+        break;
+    case MON_DATA_HELD_ITEM:
+        retVal = substruct0->heldItem;
+        break;
+    case MON_DATA_EXP:
+        retVal = substruct0->experience;
+        break;
+    case MON_DATA_PP_BONUSES:
+        retVal = substruct0->ppBonuses;
+        break;
+    case MON_DATA_FRIENDSHIP:
+        retVal = substruct0->friendship;
+        break;
+    case MON_DATA_MOVE1:
+        retVal = substruct1->move1;
+        break;
+    case MON_DATA_MOVE2:
+        retVal = substruct1->move2;
+        break;
+    case MON_DATA_MOVE3:
+        retVal = substruct1->move3;
+        break;
+    case MON_DATA_MOVE4:
+        retVal = substruct1->move4;
+        break;
+    case MON_DATA_PP1:
+        retVal = substruct1->pp1;
+        break;
+    case MON_DATA_PP2:
+        retVal = substruct1->pp2;
+        break;
+    case MON_DATA_PP3:
+        retVal = substruct1->pp3;
+        break;
+    case MON_DATA_PP4:
+        retVal = substruct1->pp4;
+        break;
+    case MON_DATA_HP_EV:
+        retVal = substruct2->hpEV;
+        break;
+    case MON_DATA_ATK_EV:
+        retVal = substruct2->attackEV;
+        break;
+    case MON_DATA_DEF_EV:
+        retVal = substruct2->defenseEV;
+        break;
+    case MON_DATA_SPEED_EV:
+        retVal = substruct2->speedEV;
+        break;
+    case MON_DATA_SPATK_EV:
+        retVal = substruct2->spAttackEV;
+        break;
+    case MON_DATA_SPDEF_EV:
+        retVal = substruct2->spDefenseEV;
+        break;
+    case MON_DATA_COOL:
+        retVal = substruct2->cool;
+        break;
+    case MON_DATA_BEAUTY:
+        retVal = substruct2->beauty;
+        break;
+    case MON_DATA_CUTE:
+        retVal = substruct2->cute;
+        break;
+    case MON_DATA_SMART:
+        retVal = substruct2->smart;
+        break;
+    case MON_DATA_TOUGH:
+        retVal = substruct2->tough;
+        break;
+    case MON_DATA_SHEEN:
+        retVal = substruct2->sheen;
+        break;
+    case MON_DATA_POKERUS:
+        retVal = substruct3->pokerus;
+        break;
+    case MON_DATA_MET_LOCATION:
+        retVal = substruct3->metLocation;
+        break;
+    case MON_DATA_MET_LEVEL:
+        retVal = substruct3->metLevel;
+        break;
+    case MON_DATA_MET_GAME:
+        retVal = substruct3->metGame;
+        break;
+    case MON_DATA_POKEBALL:
+        retVal = substruct0->pokeball;
+        break;
+    case MON_DATA_OT_GENDER:
+        retVal = substruct3->otGender;
+        break;
+    case MON_DATA_HP_IV:
+        retVal = substruct3->hpIV;
+        break;
+    case MON_DATA_ATK_IV:
+        retVal = substruct3->attackIV;
+        break;
+    case MON_DATA_DEF_IV:
+        retVal = substruct3->defenseIV;
+        break;
+    case MON_DATA_SPEED_IV:
+        retVal = substruct3->speedIV;
+        break;
+    case MON_DATA_SPATK_IV:
+        retVal = substruct3->spAttackIV;
+        break;
+    case MON_DATA_SPDEF_IV:
+        retVal = substruct3->spDefenseIV;
+        break;
+    case MON_DATA_IS_EGG:
+        retVal = substruct3->isEgg;
+        break;
+    case MON_DATA_ABILITY_NUM:
+        retVal = substruct3->abilityNum;
+        break;
+    case MON_DATA_COOL_RIBBON:
+        retVal = substruct3->coolRibbon;
+        break;
+    case MON_DATA_BEAUTY_RIBBON:
+        retVal = substruct3->beautyRibbon;
+        break;
+    case MON_DATA_CUTE_RIBBON:
+        retVal = substruct3->cuteRibbon;
+        break;
+    case MON_DATA_SMART_RIBBON:
+        retVal = substruct3->smartRibbon;
+        break;
+    case MON_DATA_TOUGH_RIBBON:
+        retVal = substruct3->toughRibbon;
+        break;
+    case MON_DATA_CHAMPION_RIBBON:
+        retVal = substruct3->championRibbon;
+        break;
+    case MON_DATA_WINNING_RIBBON:
+        retVal = substruct3->winningRibbon;
+        break;
+    case MON_DATA_VICTORY_RIBBON:
+        retVal = substruct3->victoryRibbon;
+        break;
+    case MON_DATA_ARTIST_RIBBON:
+        retVal = substruct3->artistRibbon;
+        break;
+    case MON_DATA_EFFORT_RIBBON:
+        retVal = substruct3->effortRibbon;
+        break;
+    case MON_DATA_MARINE_RIBBON:
+        retVal = substruct3->marineRibbon;
+        break;
+    case MON_DATA_LAND_RIBBON:
+        retVal = substruct3->landRibbon;
+        break;
+    case MON_DATA_SKY_RIBBON:
+        retVal = substruct3->skyRibbon;
+        break;
+    case MON_DATA_COUNTRY_RIBBON:
+        retVal = substruct3->countryRibbon;
+        break;
+    case MON_DATA_NATIONAL_RIBBON:
+        retVal = substruct3->nationalRibbon;
+        break;
+    case MON_DATA_EARTH_RIBBON:
+        retVal = substruct3->earthRibbon;
+        break;
+    case MON_DATA_WORLD_RIBBON:
+        retVal = substruct3->worldRibbon;
+        break;
+    case MON_DATA_MODERN_FATEFUL_ENCOUNTER:
+        retVal = substruct3->modernFatefulEncounter;
+        break;
+    case MON_DATA_SPECIES_OR_EGG:
+        retVal = substruct0->species;
+        if (substruct0->species && (substruct3->isEgg || boxMon->isBadEgg))
+            retVal = SPECIES_EGG;
+        break;
+    case MON_DATA_IVS:
+        retVal = substruct3->hpIV
+                | (substruct3->attackIV << 5)
+                | (substruct3->defenseIV << 10)
+                | (substruct3->speedIV << 15)
+                | (substruct3->spAttackIV << 20)
+                | (substruct3->spDefenseIV << 25);
+        break;
+    case MON_DATA_KNOWN_MOVES:
+        if (substruct0->species && !substruct3->isEgg)
+        {
+            u16 *moves = (u16 *)data;
+            s32 i = 0;
+
+            while (moves[i] != MOVES_COUNT)
             {
-                retVal = substruct0->teraType;
+                u16 move = moves[i];
+                if (substruct1->move1 == move
+                    || substruct1->move2 == move
+                    || substruct1->move3 == move
+                    || substruct1->move4 == move)
+                    retVal |= (1u << i);
+                i++;
             }
-            break;
-        case MON_DATA_EVOLUTION_TRACKER:
-            evoTracker.asField.a = substruct1->evolutionTracker1;
-            evoTracker.asField.b = substruct1->evolutionTracker2;
-            evoTracker.asField.unused = 0;
-            retVal = evoTracker.value;
-            break;
-        default:
-            break;
         }
+        break;
+    case MON_DATA_RIBBON_COUNT:
+        retVal = 0;
+        if (substruct0->species && !substruct3->isEgg)
+        {
+            retVal += substruct3->coolRibbon;
+            retVal += substruct3->beautyRibbon;
+            retVal += substruct3->cuteRibbon;
+            retVal += substruct3->smartRibbon;
+            retVal += substruct3->toughRibbon;
+            retVal += substruct3->championRibbon;
+            retVal += substruct3->winningRibbon;
+            retVal += substruct3->victoryRibbon;
+            retVal += substruct3->artistRibbon;
+            retVal += substruct3->effortRibbon;
+            retVal += substruct3->marineRibbon;
+            retVal += substruct3->landRibbon;
+            retVal += substruct3->skyRibbon;
+            retVal += substruct3->countryRibbon;
+            retVal += substruct3->nationalRibbon;
+            retVal += substruct3->earthRibbon;
+            retVal += substruct3->worldRibbon;
+        }
+        break;
+    case MON_DATA_RIBBONS:
+        retVal = 0;
+        if (substruct0->species && !substruct3->isEgg)
+        {
+            retVal = substruct3->championRibbon
+                | (substruct3->coolRibbon << 1)
+                | (substruct3->beautyRibbon << 4)
+                | (substruct3->cuteRibbon << 7)
+                | (substruct3->smartRibbon << 10)
+                | (substruct3->toughRibbon << 13)
+                | (substruct3->winningRibbon << 16)
+                | (substruct3->victoryRibbon << 17)
+                | (substruct3->artistRibbon << 18)
+                | (substruct3->effortRibbon << 19)
+                | (substruct3->marineRibbon << 20)
+                | (substruct3->landRibbon << 21)
+                | (substruct3->skyRibbon << 22)
+                | (substruct3->countryRibbon << 23)
+                | (substruct3->nationalRibbon << 24)
+                | (substruct3->earthRibbon << 25)
+                | (substruct3->worldRibbon << 26);
+        }
+        break;
+    case MON_DATA_HYPER_TRAINED_HP:
+        retVal = substruct1->hyperTrainedHP;
+        break;
+    case MON_DATA_HYPER_TRAINED_ATK:
+        retVal = substruct1->hyperTrainedAttack;
+        break;
+    case MON_DATA_HYPER_TRAINED_DEF:
+        retVal = substruct1->hyperTrainedDefense;
+        break;
+    case MON_DATA_HYPER_TRAINED_SPEED:
+        retVal = substruct1->hyperTrainedSpeed;
+        break;
+    case MON_DATA_HYPER_TRAINED_SPATK:
+        retVal = substruct1->hyperTrainedSpAttack;
+        break;
+    case MON_DATA_HYPER_TRAINED_SPDEF:
+        retVal = substruct1->hyperTrainedSpDefense;
+        break;
+    case MON_DATA_IS_SHADOW:
+        retVal = substruct3->isShadow;
+        break;
+    case MON_DATA_DYNAMAX_LEVEL:
+        retVal = substruct3->dynamaxLevel;
+        break;
+    case MON_DATA_GIGANTAMAX_FACTOR:
+        retVal = substruct3->gigantamaxFactor;
+        break;
+    case MON_DATA_TERA_TYPE:
+        if (gSpeciesInfo[substruct0->species].forceTeraType)
+        {
+            retVal = gSpeciesInfo[substruct0->species].forceTeraType;
+        }
+        else if (substruct0->teraType == TYPE_NONE) // Tera Type hasn't been modified so we can just use the personality
+        {
+            const u8 *types = gSpeciesInfo[substruct0->species].types;
+            retVal = (boxMon->personality & 0x1) == 0 ? types[0] : types[1];
+        }
+        else
+        {
+            retVal = substruct0->teraType;
+        }
+        break;
+    case MON_DATA_EVOLUTION_TRACKER:
+        evoTracker.asField.a = substruct1->evolutionTracker1;
+        evoTracker.asField.b = substruct1->evolutionTracker2;
+        evoTracker.asField.unused = 0;
+        retVal = evoTracker.value;
+        break;
+    default:
+        break;
+    }
+
+    return retVal;
+}
+
+static u32 GetUnencryptedBoxMonData(struct BoxPokemon *boxMon, s32 field, u8 *data)
+{
+    u32 retVal = 0;
+
+    switch (field)
+    {
+    case MON_DATA_STATUS:
+        retVal = UncompressStatus(boxMon->compressedStatus);
+        break;
+    case MON_DATA_HP_LOST:
+        retVal = boxMon->hpLost;
+        break;
+    case MON_DATA_PERSONALITY:
+        retVal = boxMon->personality;
+        break;
+    case MON_DATA_OT_ID:
+        retVal = boxMon->otId;
+        break;
+    case MON_DATA_LANGUAGE:
+        retVal = boxMon->language;
+        break;
+    case MON_DATA_SANITY_IS_BAD_EGG:
+        retVal = boxMon->isBadEgg;
+        break;
+    case MON_DATA_SANITY_HAS_SPECIES:
+        retVal = boxMon->hasSpecies;
+        break;
+    case MON_DATA_SANITY_IS_EGG:
+        retVal = boxMon->isEgg;
+        break;
+    case MON_DATA_OT_NAME:
+    {
+        retVal = 0;
+
+        while (retVal < PLAYER_NAME_LENGTH)
+        {
+            data[retVal] = boxMon->otName[retVal];
+            retVal++;
+        }
+
+        data[retVal] = EOS;
+        break;
+    }
+    case MON_DATA_MARKINGS:
+        retVal = boxMon->markings;
+        break;
+    case MON_DATA_CHECKSUM:
+        retVal = boxMon->checksum;
+        break;
+    case MON_DATA_IS_SHINY:
+    {
+        u32 shinyValue = GET_SHINY_VALUE(boxMon->otId, boxMon->personality);
+        retVal = (shinyValue < SHINY_ODDS) ^ boxMon->shinyModifier;
+        break;
+    }
+    case MON_DATA_HIDDEN_NATURE:
+    {
+        u32 nature = GetNatureFromPersonality(boxMon->personality);
+        retVal = nature ^ boxMon->hiddenNatureModifier;
+        break;
+    }
+    case MON_DATA_DAYS_SINCE_FORM_CHANGE:
+        retVal = boxMon->daysSinceFormChange;
+        break;
+    default:
+        break;
+    }
+
+    return retVal;
+}
+
+/* GameFreak called GetBoxMonData with either 2 or 3 arguments, for type
+ * safety we have a GetBoxMonData macro (in include/pokemon.h) which
+ * dispatches to either GetBoxMonData2 or GetBoxMonData3 based on the
+ * number of arguments. */
+u32 GetBoxMonData3(struct BoxPokemon *boxMon, s32 field, u8 *data)
+{
+    u32 retVal;
+
+    // Any field greater than MON_DATA_ENCRYPT_SEPARATOR is encrypted and must be treated as such
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    {
+        struct BoxMonView view;
+        OpenBoxMonView(&view, boxMon);
+        retVal = GetEncryptedBoxMonData(&view, field, data);
+        CloseBoxMonView(&view);
+    }
+    else
+    {
+        retVal = GetUnencryptedBoxMonData(boxMon, field, data);
+    }
+
+    return retVal;
+}
+
+u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field)
+{
+    return GetBoxMonData3(boxMon, field, NULL);
+}
+
+#define SET8(lhs) (lhs) = *data
+#define SET16(lhs) (lhs) = data[0] + (data[1] << 8)
+#define SET32(lhs) (lhs) = data[0] + (data[1] << 8) + (data[2] << 16) + (data[3] << 24)
+
+void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg)
+{
+    const u8 *data = dataArg;
+
+    switch (field)
+    {
+    case MON_DATA_STATUS:
+        SET32(mon->status);
+        SetBoxMonData(&mon->box, MON_DATA_STATUS, dataArg);
+        break;
+    case MON_DATA_LEVEL:
+        SET8(mon->level);
+        break;
+    case MON_DATA_HP:
+    {
+        u32 hpLost;
+        SET16(mon->hp);
+        hpLost = mon->maxHP - mon->hp;
+        SetBoxMonData(&mon->box, MON_DATA_HP_LOST, &hpLost);
+        break;
+    }
+    case MON_DATA_HP_LOST:
+    {
+        u32 hpLost;
+        SET16(hpLost);
+        mon->hp = mon->maxHP - hpLost;
+        SetBoxMonData(&mon->box, MON_DATA_HP_LOST, &hpLost);
+        break;
+    }
+    case MON_DATA_MAX_HP:
+        SET16(mon->maxHP);
+        break;
+    case MON_DATA_ATK:
+        SET16(mon->attack);
+        break;
+    case MON_DATA_DEF:
+        SET16(mon->defense);
+        break;
+    case MON_DATA_SPEED:
+        SET16(mon->speed);
+        break;
+    case MON_DATA_SPATK:
+        SET16(mon->spAttack);
+        break;
+    case MON_DATA_SPDEF:
+        SET16(mon->spDefense);
+        break;
+    case MON_DATA_MAIL:
+        SET8(mon->mail);
+        break;
+    case MON_DATA_SPECIES_OR_EGG:
+        break;
+    default:
+        SetBoxMonData(&mon->box, field, data);
+        break;
+    }
+}
+
+static void SetEncryptedBoxMonData(struct BoxMonView *view, s32 field, const void *dataArg)
+{
+    const u8 *data = dataArg;
+    struct BoxPokemon *boxMon = view->boxMon;
+    struct PokemonSubstruct0 *substruct0 = view->substruct0;
+    struct PokemonSubstruct1 *substruct1 = view->substruct1;
+    struct PokemonSubstruct2 *substruct2 = view->substruct2;
+    struct PokemonSubstruct3 *substruct3 = view->substruct3;
+
+    switch (field)
+    {
+    case MON_DATA_NICKNAME:
+    case MON_DATA_NICKNAME10:
+    {
+        s32 i;
+        for (i = 0; i < min(sizeof(boxMon->nickname), POKEMON_NAME_LENGTH); i++)
+            boxMon->nickname[i] = data[i];
+        if (field != MON_DATA_NICKNAME10)
+        {
+            if (POKEMON_NAME_LENGTH >= 11)
+                substruct0->nickname11 = data[10];
+            if (POKEMON_NAME_LENGTH >= 12)
+                substruct0->nickname12 = data[11];
+        }
+        else
+        {
+            substruct0->nickname11 = EOS;
+            substruct0->nickname12 = EOS;
+        }
+        break;
+    }
+    case MON_DATA_SPECIES:
+    {
+        SET16(substruct0->species);
+        if (substruct0->species)
+            boxMon->hasSpecies = TRUE;
+        else
+            boxMon->hasSpecies = FALSE;
+        break;
+    }
+    case MON_DATA_HELD_ITEM:
+        SET16(substruct0->heldItem);
+        break;
+    case MON_DATA_EXP:
+        SET32(substruct0->experience);
+        break;
+    case MON_DATA_PP_BONUSES:
+        SET8(substruct0->ppBonuses);
+        break;
+    case MON_DATA_FRIENDSHIP:
+        SET8(substruct0->friendship);
+        break;
+    case MON_DATA_MOVE1:
+        SET16(substruct1->move1);
+        break;
+    case MON_DATA_MOVE2:
+        SET16(substruct1->move2);
+        break;
+    case MON_DATA_MOVE3:
+        SET16(substruct1->move3);
+        break;
+    case MON_DATA_MOVE4:
+        SET16(substruct1->move4);
+        break;
+    case MON_DATA_PP1:
+        SET8(substruct1->pp1);
+        break;
+    case MON_DATA_PP2:
+        SET8(substruct1->pp2);
+        break;
+    case MON_DATA_PP3:
+        SET8(substruct1->pp3);
+        break;
+    case MON_DATA_PP4:
+        SET8(substruct1->pp4);
+        break;
+    case MON_DATA_HP_EV:
+        SET8(substruct2->hpEV);
+        break;
+    case MON_DATA_ATK_EV:
+        SET8(substruct2->attackEV);
+        break;
+    case MON_DATA_DEF_EV:
+        SET8(substruct2->defenseEV);
+        break;
+    case MON_DATA_SPEED_EV:
+        SET8(substruct2->speedEV);
+        break;
+    case MON_DATA_SPATK_EV:
+        SET8(substruct2->spAttackEV);
+        break;
+    case MON_DATA_SPDEF_EV:
+        SET8(substruct2->spDefenseEV);
+        break;
+    case MON_DATA_COOL:
+        SET8(substruct2->cool);
+        break;
+    case MON_DATA_BEAUTY:
+        SET8(substruct2->beauty);
+        break;
+    case MON_DATA_CUTE:
+        SET8(substruct2->cute);
+        break;
+    case MON_DATA_SMART:
+        SET8(substruct2->smart);
+        break;
+    case MON_DATA_TOUGH:
+        SET8(substruct2->tough);
+        break;
+    case MON_DATA_SHEEN:
+        SET8(substruct2->sheen);
+        break;
+    case MON_DATA_POKERUS:
+        SET8(substruct3->pokerus);
+        break;
+    case MON_DATA_MET_LOCATION:
+        SET8(substruct3->metLocation);
+        break;
+    case MON_DATA_MET_LEVEL:
+        SET8(substruct3->metLevel);
+        break;
+    case MON_DATA_MET_GAME:
+        SET8(substruct3->metGame);
+        break;
+    case MON_DATA_POKEBALL:
+        SET8(substruct0->pokeball);
+        break;
+    case MON_DATA_OT_GENDER:
+        SET8(substruct3->otGender);
+        break;
+    case MON_DATA_HP_IV:
+        SET8(substruct3->hpIV);
+        break;
+    case MON_DATA_ATK_IV:
+        SET8(substruct3->attackIV);
+        break;
+    case MON_DATA_DEF_IV:
+        SET8(substruct3->defenseIV);
+        break;
+    case MON_DATA_SPEED_IV:
+        SET8(substruct3->speedIV);
+        break;
+    case MON_DATA_SPATK_IV:
+        SET8(substruct3->spAttackIV);
+        break;
+    case MON_DATA_SPDEF_IV:
+        SET8(substruct3->spDefenseIV);
+        break;
+    case MON_DATA_IS_EGG:
+        SET8(substruct3->isEgg);
+        if (substruct3->isEgg)
+            boxMon->isEgg = TRUE;
+        else
+            boxMon->isEgg = FALSE;
+        break;
+    case MON_DATA_ABILITY_NUM:
+        SET8(substruct3->abilityNum);
+        break;
+    case MON_DATA_COOL_RIBBON:
+        SET8(substruct3->coolRibbon);
+        break;
+    case MON_DATA_BEAUTY_RIBBON:
+        SET8(substruct3->beautyRibbon);
+        break;
+    case MON_DATA_CUTE_RIBBON:
+        SET8(substruct3->cuteRibbon);
+        break;
+    case MON_DATA_SMART_RIBBON:
+        SET8(substruct3->smartRibbon);
+        break;
+    case MON_DATA_TOUGH_RIBBON:
+        SET8(substruct3->toughRibbon);
+        break;
+    case MON_DATA_CHAMPION_RIBBON:
+        SET8(substruct3->championRibbon);
+        break;
+    case MON_DATA_WINNING_RIBBON:
+        SET8(substruct3->winningRibbon);
+        break;
+    case MON_DATA_VICTORY_RIBBON:
+        SET8(substruct3->victoryRibbon);
+        break;
+    case MON_DATA_ARTIST_RIBBON:
+        SET8(substruct3->artistRibbon);
+        break;
+    case MON_DATA_EFFORT_RIBBON:
+        SET8(substruct3->effortRibbon);
+        break;
+    case MON_DATA_MARINE_RIBBON:
+        SET8(substruct3->marineRibbon);
+        break;
+    case MON_DATA_LAND_RIBBON:
+        SET8(substruct3->landRibbon);
+        break;
+    case MON_DATA_SKY_RIBBON:
+        SET8(substruct3->skyRibbon);
+        break;
+    case MON_DATA_COUNTRY_RIBBON:
+        SET8(substruct3->countryRibbon);
+        break;
+    case MON_DATA_NATIONAL_RIBBON:
+        SET8(substruct3->nationalRibbon);
+        break;
+    case MON_DATA_EARTH_RIBBON:
+        SET8(substruct3->earthRibbon);
+        break;
+    case MON_DATA_WORLD_RIBBON:
+        SET8(substruct3->worldRibbon);
+        break;
+    case MON_DATA_MODERN_FATEFUL_ENCOUNTER:
+        SET8(substruct3->modernFatefulEncounter);
+        break;
+    case MON_DATA_IVS:
+    {
+        u32 ivs;
+        SET32(ivs);
+        substruct3->hpIV = ivs & MAX_IV_MASK;
+        substruct3->attackIV = (ivs >> 5) & MAX_IV_MASK;
+        substruct3->defenseIV = (ivs >> 10) & MAX_IV_MASK;
+        substruct3->speedIV = (ivs >> 15) & MAX_IV_MASK;
+        substruct3->spAttackIV = (ivs >> 20) & MAX_IV_MASK;
+        substruct3->spDefenseIV = (ivs >> 25) & MAX_IV_MASK;
+        break;
+    }
+    case MON_DATA_HYPER_TRAINED_HP:
+        SET8(substruct1->hyperTrainedHP);
+        break;
+    case MON_DATA_HYPER_TRAINED_ATK:
+        SET8(substruct1->hyperTrainedAttack);
+        break;
+    case MON_DATA_HYPER_TRAINED_DEF:
+        SET8(substruct1->hyperTrainedDefense);
+        break;
+    case MON_DATA_HYPER_TRAINED_SPEED:
+        SET8(substruct1->hyperTrainedSpeed);
+        break;
+    case MON_DATA_HYPER_TRAINED_SPATK:
+        SET8(substruct1->hyperTrainedSpAttack);
+        break;
+    case MON_DATA_HYPER_TRAINED_SPDEF:
+        SET8(substruct1->hyperTrainedSpDefense);
+        break;
+    case MON_DATA_IS_SHADOW:
+        SET8(substruct3->isShadow);
+        break;
+    case MON_DATA_DYNAMAX_LEVEL:
+        SET8(substruct3->dynamaxLevel);
+        break;
+    case MON_DATA_GIGANTAMAX_FACTOR:
+        SET8(substruct3->gigantamaxFactor);
+        break;
+    case MON_DATA_TERA_TYPE:
+        SET8(substruct0->teraType);
+        break;
+    case MON_DATA_EVOLUTION_TRACKER:
+    {
+        union EvolutionTracker evoTracker;
+        u32 evoTrackerValue;
+        SET32(evoTrackerValue);
+        evoTracker.value = evoTrackerValue;
+        substruct1->evolutionTracker1 = evoTracker.asField.a;
+        substruct1->evolutionTracker2 = evoTracker.asField.b;
+        break;
     }
-    else
-    {
-        switch (field)
-        {
-        case MON_DATA_STATUS:
-            retVal = UncompressStatus(boxMon->compressedStatus);
-            break;
-        case MON_DATA_HP_LOST:
-            retVal = boxMon->hpLost;
-            break;
-        case MON_DATA_PERSONALITY:
-            retVal = boxMon->personality;
-            break;
-        case MON_DATA_OT_ID:
-            retVal = boxMon->otId;
-            break;
-        case MON_DATA_LANGUAGE:
-            retVal = boxMon->language;
-            break;
-        case MON_DATA_SANITY_IS_BAD_EGG:
-            retVal = boxMon->isBadEgg;
-            break;
-        case MON_DATA_SANITY_HAS_SPECIES:
-            retVal = boxMon->hasSpecies;
-            break;
-        case MON_DATA_SANITY_IS_EGG:
-            retVal = boxMon->isEgg;
-            break;
-        case MON_DATA_OT_NAME:
-        {
-            retVal = 0;
-
-            while (retVal < PLAYER_NAME_LENGTH)
-            {
-                data[retVal] = boxMon->otName[retVal];
-                retVal++;
-            }
-
-            data[retVal] = EOS;
-            break;
-        }
-        case MON_DATA_MARKINGS:
-            retVal = boxMon->markings;
-            break;
-        case MON_DATA_CHECKSUM:
-            retVal = boxMon->checksum;
-            break;
-        case MON_DATA_IS_SHINY:
-        {
-            u32 shinyValue = GET_SHINY_VALUE(boxMon->otId, boxMon->personality);
-            retVal = (shinyValue < SHINY_ODDS) ^ boxMon->shinyModifier;
-            break;
-        }
-        case MON_DATA_HIDDEN_NATURE:
-        {
-            u32 nature = GetNatureFromPersonality(boxMon->personality);
-            retVal = nature ^ boxMon->hiddenNatureModifier;
-            break;
-        }
-        case MON_DATA_DAYS_SINCE_FORM_CHANGE:
-            retVal = boxMon->daysSinceFormChange;
-            break;
-        default:
-            break;
-        }
+    default:
+        break;
     }
-
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
-        EncryptBoxMon(boxMon);
-
-    return retVal;
-}
-
-u32 GetBoxMonData2(struct BoxPokemon *boxMon, s32 field)
-{
-    return GetBoxMonData3(boxMon, field, NULL);
 }
 
-#define SET8(lhs) (lhs) = *data
-#define SET16(lhs) (lhs) = data[0] + (data[1] << 8)
-#define SET32(lhs) (lhs) = data[0] + (data[1] << 8) + (data[2] << 16) + (data[3] << 24)
-
-void SetMonData(struct Pokemon *mon, s32 field, const void *dataArg)
+static void SetUnencryptedBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
 {
     const u8 *data = dataArg;
 
     switch (field)
     {
     case MON_DATA_STATUS:
-        SET32(mon->status);
-        SetBoxMonData(&mon->box, MON_DATA_STATUS, dataArg);
-        break;
-    case MON_DATA_LEVEL:
-        SET8(mon->level);
-        break;
-    case MON_DATA_HP:
     {
-        u32 hpLost;
-        SET16(mon->hp);
-        hpLost = mon->maxHP - mon->hp;
-        SetBoxMonData(&mon->box, MON_DATA_HP_LOST, &hpLost);
+        u32 status;
+        SET32(status);
+        boxMon->compressedStatus = CompressStatus(status);
         break;
     }
     case MON_DATA_HP_LOST:
-    {
-        u32 hpLost;
-        SET16(hpLost);
-        mon->hp = mon->maxHP - hpLost;
-        SetBoxMonData(&mon->box, MON_DATA_HP_LOST, &hpLost);
+        SET16(boxMon->hpLost);
         break;
-    }
-    case MON_DATA_MAX_HP:
-        SET16(mon->maxHP);
+    case MON_DATA_PERSONALITY:
+        SET32(boxMon->personality);
         break;
-    case MON_DATA_ATK:
-        SET16(mon->attack);
+    case MON_DATA_OT_ID:
+        SET32(boxMon->otId);
         break;
-    case MON_DATA_DEF:
-        SET16(mon->defense);
+    case MON_DATA_LANGUAGE:
+        SET8(boxMon->language);
         break;
-    case MON_DATA_SPEED:
-        SET16(mon->speed);
+    case MON_DATA_SANITY_IS_BAD_EGG:
+        SET8(boxMon->isBadEgg);
         break;
-    case MON_DATA_SPATK:
-        SET16(mon->spAttack);
+    case MON_DATA_SANITY_HAS_SPECIES:
+        SET8(boxMon->hasSpecies);
         break;
-    case MON_DATA_SPDEF:
-        SET16(mon->spDefense);
+    case MON_DATA_SANITY_IS_EGG:
+        SET8(boxMon->isEgg);
         break;
-    case MON_DATA_MAIL:
-        SET8(mon->mail);
+    case MON_DATA_OT_NAME:
+    {
+        s32 i;
+        for (i = 0; i < PLAYER_NAME_LENGTH; i++)
+            boxMon->otName[i] = data[i];
         break;
-    case MON_DATA_SPECIES_OR_EGG:
+    }
+    case MON_DATA_MARKINGS:
+        SET8(boxMon->markings);
         break;
-    default:
-        SetBoxMonData(&mon->box, field, data);
+    case MON_DATA_CHECKSUM:
+        SET16(boxMon->checksum);
+        break;
+    case MON_DATA_IS_SHINY:
+    {
+        u32 shinyValue = GET_SHINY_VALUE(boxMon->otId, boxMon->personality);
+        bool32 isShiny;
+        SET8(isShiny);
+        boxMon->shinyModifier = (shinyValue < SHINY_ODDS) ^ isShiny;
+        break;
+    }
+    case MON_DATA_HIDDEN_NATURE:
+    {
+        u32 nature = GetNatureFromPersonality(boxMon->personality);
+        u32 hiddenNature;
+        SET8(hiddenNature);
+        boxMon->hiddenNatureModifier = nature ^ hiddenNature;
+        break;
+    }
+    case MON_DATA_DAYS_SINCE_FORM_CHANGE:
+        SET8(boxMon->daysSinceFormChange);
         break;
     }
 }
 
 void SetBoxMonData(struct BoxPokemon *boxMon, s32 field, const void *dataArg)
 {
-    const u8 *data = dataArg;
-
-    struct PokemonSubstruct0 *substruct0 = NULL;
-    struct PokemonSubstruct1 *substruct1 = NULL;
-    struct PokemonSubstruct2 *substruct2 = NULL;
-    struct PokemonSubstruct3 *substruct3 = NULL;
-
     if (field > MON_DATA_ENCRYPT_SEPARATOR)
     {
-        substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
-        substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
-        substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
-        substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+        struct BoxMonView view;
+        OpenBoxMonView(&view, boxMon);
+        SetBoxMonViewData(&view, field, dataArg);
+        CloseBoxMonView(&view);
+    }
+    else
+    {
+        SetUnencryptedBoxMonData(boxMon, field, dataArg);
+    }
+}
 
-        DecryptBoxMon(boxMon);
+/* Decrypts boxMon and checks its checksum once, so that any number of
+ * fields can be read and written before CloseBoxMonView re-encrypts it.
+ * Nothing else may access boxMon while the view is open. */
+void OpenBoxMonView(struct BoxMonView *view, struct BoxPokemon *boxMon)
+{
+    view->boxMon = boxMon;
+    view->substruct0 = &(GetSubstruct(boxMon, boxMon->personality, 0)->type0);
+    view->substruct1 = &(GetSubstruct(boxMon, boxMon->personality, 1)->type1);
+    view->substruct2 = &(GetSubstruct(boxMon, boxMon->personality, 2)->type2);
+    view->substruct3 = &(GetSubstruct(boxMon, boxMon->personality, 3)->type3);
+    view->isDirty = FALSE;
 
-        if (CalculateBoxMonChecksum(boxMon) != boxMon->checksum)
-        {
-            boxMon->isBadEgg = TRUE;
-            boxMon->isEgg = TRUE;
-            substruct3->isEgg = TRUE;
-            EncryptBoxMon(boxMon);
-            return;
-        }
+    DecryptBoxMon(boxMon);
 
-        switch (field)
-        {
-        case MON_DATA_NICKNAME:
-        case MON_DATA_NICKNAME10:
-        {
-            s32 i;
-            for (i = 0; i < min(sizeof(boxMon->nickname), POKEMON_NAME_LENGTH); i++)
-                boxMon->nickname[i] = data[i];
-            if (field != MON_DATA_NICKNAME10)
-            {
-                if (POKEMON_NAME_LENGTH >= 11)
-                    substruct0->nickname11 = data[10];
-                if (POKEMON_NAME_LENGTH >= 12)
-                    substruct0->nickname12 = data[11];
-            }
-            else
-            {
-                substruct0->nickname11 = EOS;
-                substruct0->nickname12 = EOS;
-            }
-            break;
-        }
-        case MON_DATA_SPECIES:
-        {
-            SET16(substruct0->species);
-            if (substruct0->species)
-                boxMon->hasSpecies = TRUE;
-            else
-                boxMon->hasSpecies = FALSE;
-            break;
-        }
-        case MON_DATA_HELD_ITEM:
-            SET16(substruct0->heldItem);
-            break;
-        case MON_DATA_EXP:
-            SET32(substruct0->experience);
-            break;
-        case MON_DATA_PP_BONUSES:
-            SET8(substruct0->ppBonuses);
-            break;
-        case MON_DATA_FRIENDSHIP:
-            SET8(substruct0->friendship);
-            break;
-        case MON_DATA_MOVE1:
-            SET16(substruct1->move1);
-            break;
-        case MON_DATA_MOVE2:
-            SET16(substruct1->move2);
-            break;
-        case MON_DATA_MOVE3:
-            SET16(substruct1->move3);
-            break;
-        case MON_DATA_MOVE4:
-            SET16(substruct1->move4);
-            break;
-        case MON_DATA_PP1:
-            SET8(substruct1->pp1);
-            break;
-        case MON_DATA_PP2:
-            SET8(substruct1->pp2);
-            break;
-        case MON_DATA_PP3:
-            SET8(substruct1->pp3);
-            break;
-        case MON_DATA_PP4:
-            SET8(substruct1->pp4);
-            break;
-        case MON_DATA_HP_EV:
-            SET8(substruct2->hpEV);
-            break;
-        case MON_DATA_ATK_EV:
-            SET8(substruct2->attackEV);
-            break;
-        case MON_DATA_DEF_EV:
-            SET8(substruct2->defenseEV);
-            break;
-        case MON_DATA_SPEED_EV:
-            SET8(substruct2->speedEV);
-            break;
-        case MON_DATA_SPATK_EV:
-            SET8(substruct2->spAttackEV);
-            break;
-        case MON_DATA_SPDEF_EV:
-            SET8(substruct2->spDefenseEV);
-            break;
-        case MON_DATA_COOL:
-            SET8(substruct2->cool);
-            break;
-        case MON_DATA_BEAUTY:
-            SET8(substruct2->beauty);
-            break;
-        case MON_DATA_CUTE:
-            SET8(substruct2->cute);
-            break;
-        case MON_DATA_SMART:
-            SET8(substruct2->smart);
-            break;
-        case MON_DATA_TOUGH:
-            SET8(substruct2->tough);
-            break;
-        case MON_DATA_SHEEN:
-            SET8(substruct2->sheen);
-            break;
-        case MON_DATA_POKERUS:
-            SET8(substruct3->pokerus);
-            break;
-        case MON_DATA_MET_LOCATION:
-            SET8(substruct3->metLocation);
-            break;
-        case MON_DATA_MET_LEVEL:
-            SET8(substruct3->metLevel);
-            break;
-        case MON_DATA_MET_GAME:
-            SET8(substruct3->metGame);
-            break;
-        case MON_DATA_POKEBALL:
-            SET8(substruct0->pokeball);
-            break;
-        case MON_DATA_OT_GENDER:
-            SET8(substruct3->otGender);
-            break;
-        case MON_DATA_HP_IV:
-            SET8(substruct3->hpIV);
-            break;
-        case MON_DATA_ATK_IV:
-            SET8(substruct3->attackIV);
-            break;
-        case MON_DATA_DEF_IV:
-            SET8(substruct3->defenseIV);
-            break;
-        case MON_DATA_SPEED_IV:
-            SET8(substruct3->speedIV);
-            break;
-        case MON_DATA_SPATK_IV:
-            SET8(substruct3->spAttackIV);
-            break;
-        case MON_DATA_SPDEF_IV:
-            SET8(substruct3->spDefenseIV);
-            break;
-        case MON_DATA_IS_EGG:
-            SET8(substruct3->isEgg);
-            if (substruct3->isEgg)
-                boxMon->isEgg = TRUE;
-            else
-                boxMon->isEgg = FALSE;
-            break;
-        case MON_DATA_ABILITY_NUM:
-            SET8(substruct3->abilityNum);
-            break;
-        case MON_DATA_COOL_RIBBON:
-            SET8(substruct3->coolRibbon);
-            break;
-        case MON_DATA_BEAUTY_RIBBON:
-            SET8(substruct3->beautyRibbon);
-            break;
-        case MON_DATA_CUTE_RIBBON:
-            SET8(substruct3->cuteRibbon);
-            break;
-        case MON_DATA_SMART_RIBBON:
-            SET8(substruct3->smartRibbon);
-            break;
-        case MON_DATA_TOUGH_RIBBON:
-            SET8(substruct3->toughRibbon);
-            break;
-        case MON_DATA_CHAMPION_RIBBON:
-            SET8(substruct3->championRibbon);
-            break;
-        case MON_DATA_WINNING_RIBBON:
-            SET8(substruct3->winningRibbon);
-            break;
-        case MON_DATA_VICTORY_RIBBON:
-            SET8(substruct3->victoryRibbon);
-            break;
-        case MON_DATA_ARTIST_RIBBON:
-            SET8(substruct3->artistRibbon);
-            break;
-        case MON_DATA_EFFORT_RIBBON:
-            SET8(substruct3->effortRibbon);
-            break;
-        case MON_DATA_MARINE_RIBBON:
-            SET8(substruct3->marineRibbon);
-            break;
-        case MON_DATA_LAND_RIBBON:
-            SET8(substruct3->landRibbon);
-            break;
-        case MON_DATA_SKY_RIBBON:
-            SET8(substruct3->skyRibbon);
-            break;
-        case MON_DATA_COUNTRY_RIBBON:
-            SET8(substruct3->countryRibbon);
-            break;
-        case MON_DATA_NATIONAL_RIBBON:
-            SET8(substruct3->nationalRibbon);
-            break;
-        case MON_DATA_EARTH_RIBBON:
-            SET8(substruct3->earthRibbon);
-            break;
-        case MON_DATA_WORLD_RIBBON:
-            SET8(substruct3->worldRibbon);
-            break;
-        case MON_DATA_MODERN_FATEFUL_ENCOUNTER:
-            SET8(substruct3->modernFatefulEncounter);
-            break;
-        case MON_DATA_IVS:
-        {
-            u32 ivs;
-            SET32(ivs);
-            substruct3->hpIV = ivs & MAX_IV_MASK;
-            substruct3->attackIV = (ivs >> 5) & MAX_IV_MASK;
-            substruct3->defenseIV = (ivs >> 10) & MAX_IV_MASK;
-            substruct3->speedIV = (ivs >> 15) & MAX_IV_MASK;
-            substruct3->spAttackIV = (ivs >> 20) & MAX_IV_MASK;
-            substruct3->spDefenseIV = (ivs >> 25) & MAX_IV_MASK;
-            break;
-        }
-        case MON_DATA_HYPER_TRAINED_HP:
-            SET8(substruct1->hyperTrainedHP);
-            break;
-        case MON_DATA_HYPER_TRAINED_ATK:
-            SET8(substruct1->hyperTrainedAttack);
-            break;
-        case MON_DATA_HYPER_TRAINED_DEF:
-            SET8(substruct1->hyperTrainedDefense);
-            break;
-        case MON_DATA_HYPER_TRAINED_SPEED:
-            SET8(substruct1->hyperTrainedSpeed);
-            break;
-        case MON_DATA_HYPER_TRAINED_SPATK:
-            SET8(substruct1->hyperTrainedSpAttack);
-            break;
-        case MON_DATA_HYPER_TRAINED_SPDEF:
-            SET8(substruct1->hyperTrainedSpDefense);
-            break;
-        case MON_DATA_IS_SHADOW:
-            SET8(substruct3->isShadow);
-            break;
-        case MON_DATA_DYNAMAX_LEVEL:
-            SET8(substruct3->dynamaxLevel);
-            break;
-        case MON_DATA_GIGANTAMAX_FACTOR:
-            SET8(substruct3->gigantamaxFactor);
-            break;
-        case MON_DATA_TERA_TYPE:
-            SET8(substruct0->teraType);
-            break;
-        case MON_DATA_EVOLUTION_TRACKER:
-        {
-            union EvolutionTracker evoTracker;
-            u32 evoTrackerValue;
-            SET32(evoTrackerValue);
-            evoTracker.value = evoTrackerValue;
-            substruct1->evolutionTracker1 = evoTracker.asField.a;
-            substruct1->evolutionTracker2 = evoTracker.asField.b;
-            break;
-        }
-        default:
-            break;
-        }
+    view->isValid = CalculateBoxMonChecksum(boxMon) == boxMon->checksum;
+    if (!view->isValid)
+    {
+        boxMon->isBadEgg = TRUE;
+        boxMon->isEgg = TRUE;
+        view->substruct3->isEgg = TRUE;
     }
+}
+
+void CloseBoxMonView(struct BoxMonView *view)
+{
+    if (view->isDirty)
+        view->boxMon->checksum = CalculateBoxMonChecksum(view->boxMon);
+    EncryptBoxMon(view->boxMon);
+}
+
+u32 GetBoxMonViewData3(struct BoxMonView *view, s32 field, u8 *data)
+{
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+        return GetEncryptedBoxMonData(view, field, data);
     else
+        return GetUnencryptedBoxMonData(view->boxMon, field, data);
+}
+
+u32 GetBoxMonViewData2(struct BoxMonView *view, s32 field)
+{
+    return GetBoxMonViewData3(view, field, NULL);
+}
+
+void SetBoxMonViewData(struct BoxMonView *view, s32 field, const void *dataArg)
+{
+    // The encryption key and substruct order would change under the view.
+    AGB_ASSERT(field != MON_DATA_PERSONALITY && field != MON_DATA_OT_ID);
+
+    if (field > MON_DATA_ENCRYPT_SEPARATOR)
     {
-        switch (field)
-        {
-        case MON_DATA_STATUS:
-        {
-            u32 status;
-            SET32(status);
-            boxMon->compressedStatus = CompressStatus(status);
-            break;
-        }
-        case MON_DATA_HP_LOST:
-            SET16(boxMon->hpLost);
-            break;
-        case MON_DATA_PERSONALITY:
-            SET32(boxMon->personality);
-            break;
-        case MON_DATA_OT_ID:
-            SET32(boxMon->otId);
-            break;
-        case MON_DATA_LANGUAGE:
-            SET8(boxMon->language);
-            break;
-        case MON_DATA_SANITY_IS_BAD_EGG:
-            SET8(boxMon->isBadEgg);
-            break;
-        case MON_DATA_SANITY_HAS_SPECIES:
-            SET8(boxMon->hasSpecies);
-            break;
-        case MON_DATA_SANITY_IS_EGG:
-            SET8(boxMon->isEgg);
-            break;
-        case MON_DATA_OT_NAME:
-        {
-            s32 i;
-            for (i = 0; i < PLAYER_NAME_LENGTH; i++)
-                boxMon->otName[i] = data[i];
-            break;
-        }
-        case MON_DATA_MARKINGS:
-            SET8(boxMon->markings);
-            break;
-        case MON_DATA_CHECKSUM:
-            SET16(boxMon->checksum);
-            break;
-        case MON_DATA_IS_SHINY:
-        {
-            u32 shinyValue = GET_SHINY_VALUE(boxMon->otId, boxMon->personality);
-            bool32 isShiny;
-            SET8(isShiny);
-            boxMon->shinyModifier = (shinyValue < SHINY_ODDS) ^ isShiny;
-            break;
-        }
-        case MON_DATA_HIDDEN_NATURE:
+        // Like SetBoxMonData, writes to a Bad Egg are ignored.
+        if (view->isValid)
         {
-            u32 nature = GetNatureFromPersonality(boxMon->personality);
-            u32 hiddenNature;
-            SET8(hiddenNature);
-            boxMon->hiddenNatureModifier = nature ^ hiddenNature;
-            break;
-        }
-        case MON_DATA_DAYS_SINCE_FORM_CHANGE:
-            SET8(boxMon->daysSinceFormChange);
-            break;
+            SetEncryptedBoxMonData(view, field, dataArg);
+            view->isDirty = TRUE;
         }
     }
-
-    if (field > MON_DATA_ENCRYPT_SEPARATOR)
+    else
     {
-        boxMon->checksum = CalculateBoxMonChecksum(boxMon);
-        EncryptBoxMon(boxMon);
+        SetUnencryptedBoxMonData(view->boxMon, field, dataArg);
     }
 }
 
@@ -5203,38 +5278,18 @@ bool8 IsMonPastEvolutionLevel(struct Pokemon *mon)
 
 u16 NationalPokedexNumToSpecies(enum NationalDexOrder nationalNum)
 {
-    u16 species;
-
-    if (!nationalNum)
-        return 0;
-
-    species = 1;
-
-    while (species < (NUM_SPECIES) && gSpeciesInfo[species].natDexNum != nationalNum)
-        species++;
-
-    if (species == NUM_SPECIES)
-        return NATIONAL_DEX_NONE;
+    if (nationalNum >= NATIONAL_DEX_END)
+        return SPECIES_NONE;
 
-    return GET_BASE_SPECIES_ID(species);
+    return sNationalDexNumToSpecies[nationalNum];
 }
 
 enum HoennDexOrder NationalToHoennOrder(enum NationalDexOrder nationalNum)
 {
-    u16 hoennNum;
-
-    if (!nationalNum)
-        return 0;
-
-    hoennNum = 0;
-
-    while (hoennNum < (HOENN_DEX_COUNT - 1) && sHoennToNationalOrder[hoennNum] != nationalNum)
-        hoennNum++;
-
-    if (hoennNum >= HOENN_DEX_COUNT - 1)
+    if (nationalNum >= NATIONAL_DEX_END)
         return 0;
 
-    return hoennNum + 1;
+    return sNationalToHoennDexNum[nationalNum];
 }
 
 enum NationalDexOrder SpeciesToNationalPokedexNum(u16 species)
@@ -5275,21 +5330,10 @@ u16 HoennNumToSpecies(enum HoennDexOrder hoennNum)
 
 enum KantoDexOrder NationalToKantoDexNum(enum NationalDexOrder natDexNum)
 {
-    enum KantoDexOrder i;
-
-    if (natDexNum == 0)
-    {
+    if (natDexNum >= NATIONAL_DEX_END)
         return KANTO_DEX_NONE;
-    }
 
-    for (i = KANTO_DEX_BULBASAUR; i < KANTO_DEX_END; i++)
-    {
-        if (sKantoDexNumToNationalDexNum[i] == natDexNum)
-        {
-            return i;
-        }
-    }
-    return KANTO_DEX_NONE;
+    return sNationalToKantoDexNum[natDexNum];
 }
 
 enum KantoDexOrder SpeciesToKantoDexNum(u16 species)
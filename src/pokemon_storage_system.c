@@ -6421,27 +6421,29 @@ static void SetDisplayMonData(void *pokemon, u8 mode)
     }
     else if (mode == MODE_BOX)
     {
-        struct BoxPokemon *boxMon = (struct BoxPokemon *)pokemon;
+        struct BoxMonView view;
 
-        gStorage->displayMonSpecies = GetBoxMonData(pokemon, MON_DATA_SPECIES_OR_EGG);
+        OpenBoxMonView(&view, (struct BoxPokemon *)pokemon);
+        gStorage->displayMonSpecies = GetBoxMonViewData(&view, MON_DATA_SPECIES_OR_EGG);
         if (gStorage->displayMonSpecies != SPECIES_NONE)
         {
-            bool32 isShiny = GetBoxMonData(boxMon, MON_DATA_IS_SHINY, NULL);
-            sanityIsBagEgg = GetBoxMonData(boxMon, MON_DATA_SANITY_IS_BAD_EGG);
+            bool32 isShiny = GetBoxMonViewData(&view, MON_DATA_IS_SHINY);
+            sanityIsBagEgg = GetBoxMonViewData(&view, MON_DATA_SANITY_IS_BAD_EGG);
             if (sanityIsBagEgg)
                 gStorage->displayMonIsEgg = TRUE;
             else
-                gStorage->displayMonIsEgg = GetBoxMonData(boxMon, MON_DATA_IS_EGG);
+                gStorage->displayMonIsEgg = GetBoxMonViewData(&view, MON_DATA_IS_EGG);
 
-            GetBoxMonData(boxMon, MON_DATA_NICKNAME, gStorage->displayMonNickname);
+            GetBoxMonViewData(&view, MON_DATA_NICKNAME, gStorage->displayMonNickname);
             StringGet_Nickname(gStorage->displayMonNickname);
-            gStorage->displayMonLevel = GetLevelFromBoxMonExp(boxMon);
-            gStorage->displayMonMarkings = GetBoxMonData(boxMon, MON_DATA_MARKINGS);
-            gStorage->displayMonPersonality = GetBoxMonData(boxMon, MON_DATA_PERSONALITY);
+            gStorage->displayMonLevel = GetLevelFromBoxMonViewExp(&view);
+            gStorage->displayMonMarkings = GetBoxMonViewData(&view, MON_DATA_MARKINGS);
+            gStorage->displayMonPersonality = GetBoxMonViewData(&view, MON_DATA_PERSONALITY);
             gStorage->displayMonPalette = GetMonSpritePalFromSpeciesAndPersonality(gStorage->displayMonSpecies, isShiny, gStorage->displayMonPersonality);
             gender = GetGenderFromSpeciesAndPersonality(gStorage->displayMonSpecies, gStorage->displayMonPersonality);
-            gStorage->displayMonItemId = GetBoxMonData(boxMon, MON_DATA_HELD_ITEM);
+            gStorage->displayMonItemId = GetBoxMonViewData(&view, MON_DATA_HELD_ITEM);
         }
+        CloseBoxMonView(&view);
     }
     else
     {
@@ -319,6 +319,7 @@ struct ShinyStarObjData
     u16 palTag; /* 0x06 */
 };
 
+static EWRAM_DATA struct Arena sMonSummaryScreenArena = {0}; // Everything that lives until the summary screen closes
 static EWRAM_DATA struct PokemonSummaryScreenData * sMonSummaryScreen = NULL;
 static EWRAM_DATA struct Struct203B144 * sMonSkillsPrinterXpos = NULL;
 static EWRAM_DATA struct MoveSelectionCursor * sMoveSelectionCursorObjs[4] = {};
@@ -1200,11 +1201,13 @@ const struct SpriteTemplate gSpriteTemplate_MoveTypes =
 
 void ShowPokemonSummaryScreen(struct Pokemon * party, u8 cursorPos, u8 lastIdx, MainCallback savedCallback, u8 mode)
 {
-    sMonSummaryScreen = AllocZeroed(sizeof(struct PokemonSummaryScreenData));
-    sMonSkillsPrinterXpos = AllocZeroed(sizeof(struct Struct203B144));
+    InitArena(&sMonSummaryScreenArena);
+    sMonSummaryScreen = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct PokemonSummaryScreenData));
+    sMonSkillsPrinterXpos = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct Struct203B144));
 
     if (sMonSummaryScreen == NULL)
     {
+        FreeArena(&sMonSummaryScreenArena);
         SetMainCallback2(savedCallback);
         return;
     }
@@ -3444,8 +3447,9 @@ static void Task_DestroyResourcesOnExit(u8 taskId)
 
     sLastViewedMonIndex = GetLastViewedMonIndex();
 
-    FREE_AND_SET_NULL_IF_SET(sMonSummaryScreen);
-    FREE_AND_SET_NULL_IF_SET(sMonSkillsPrinterXpos);
+    sMonSummaryScreen = NULL;
+    sMonSkillsPrinterXpos = NULL;
+    FreeArena(&sMonSummaryScreenArena);
 }
 
 static void CB2_RunPokemonSummaryScreen(void)
@@ -4596,10 +4600,10 @@ static void CreateMoveSelectionCursorObjs(u16 tileTag, u16 palTag)
     gfxBufferPtrs[0] = AllocZeroed(0x20 * 64);
     gfxBufferPtrs[1] = AllocZeroed(0x20 * 64);
 
-    sMoveSelectionCursorObjs[0] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[1] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[2] = AllocZeroed(sizeof(struct MoveSelectionCursor));
-    sMoveSelectionCursorObjs[3] = AllocZeroed(sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[0] = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[1] = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[2] = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct MoveSelectionCursor));
+    sMoveSelectionCursorObjs[3] = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct MoveSelectionCursor));
 
     DecompressDataWithHeaderWram(sMoveSelectionCursorTiles_Left, gfxBufferPtrs[0]);
     DecompressDataWithHeaderWram(sMoveSelectionCursorTiles_Right, gfxBufferPtrs[1]);
@@ -4702,7 +4706,7 @@ static void DestroyMoveSelectionCursorObjs(void)
         if (sMoveSelectionCursorObjs[i]->sprite != NULL)
             DestroySpriteAndFreeResources(sMoveSelectionCursorObjs[i]->sprite);
 
-        FREE_AND_SET_NULL_IF_SET(sMoveSelectionCursorObjs[i]);
+        sMoveSelectionCursorObjs[i] = NULL;
     }
 }
 
@@ -4711,7 +4715,7 @@ static void CreateMonStatusIconObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sStatusIcon = AllocZeroed(sizeof(struct MonStatusIconObj));
+    sStatusIcon = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct MonStatusIconObj));
     gfxBufferPtr = AllocZeroed(0x20 * 32);
 
     DecompressDataWithHeaderWram(gSummaryScreen_StatusAilmentIcon_Gfx, gfxBufferPtr);
@@ -4754,7 +4758,7 @@ static void DestroyMonStatusIconObj(void)
     if (sStatusIcon->sprite != NULL)
         DestroySpriteAndFreeResources(sStatusIcon->sprite);
 
-    FREE_AND_SET_NULL_IF_SET(sStatusIcon);
+    sStatusIcon = NULL;
 }
 
 static void UpdateMonStatusIconObj(void)
@@ -4804,7 +4808,7 @@ static void CreateHpBarObjs(u16 tileTag, u16 palTag)
     u32 maxHp;
     u8 hpBarPalTagOffset = 0;
 
-    sHpBarObjs = AllocZeroed(sizeof(struct HpBarObjs));
+    sHpBarObjs = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct HpBarObjs));
     gfxBufferPtr = AllocZeroed(0x20 * 12);
     DecompressDataWithHeaderWram(gSummaryScreen_HpBar_Gfx, gfxBufferPtr);
 
@@ -4944,7 +4948,7 @@ static void DestroyHpBarObjs(void)
         if (sHpBarObjs->sprites[i] != NULL)
             DestroySpriteAndFreeResources(sHpBarObjs->sprites[i]);
 
-    FREE_AND_SET_NULL_IF_SET(sHpBarObjs);
+    sHpBarObjs = NULL;
 }
 
 static void ShowOrHideHpBarObjs(u8 invisible)
@@ -4961,7 +4965,7 @@ static void CreateExpBarObjs(u16 tileTag, u16 palTag)
     u8 spriteId;
     void *gfxBufferPtr;
 
-    sExpBarObjs = AllocZeroed(sizeof(struct ExpBarObjs));
+    sExpBarObjs = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct ExpBarObjs));
     gfxBufferPtr = AllocZeroed(0x20 * 12);
 
     DecompressDataWithHeaderWram(gSummaryScreen_ExpBar_Gfx, gfxBufferPtr);
@@ -5077,7 +5081,7 @@ static void DestroyExpBarObjs(void)
         if (sExpBarObjs->sprites[i] != NULL)
             DestroySpriteAndFreeResources(sExpBarObjs->sprites[i]);
 
-    FREE_AND_SET_NULL_IF_SET(sExpBarObjs);
+    sExpBarObjs = NULL;
 }
 
 static void ShowOrHideExpBarObjs(u8 invisible)
@@ -5093,7 +5097,7 @@ static void CreatePokerusIconObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sPokerusIconObj = AllocZeroed(sizeof(struct PokerusIconObj));
+    sPokerusIconObj = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct PokerusIconObj));
     gfxBufferPtr = AllocZeroed(0x20 * 1);
 
     DecompressDataWithHeaderWram(sPokerusIconObjTiles, gfxBufferPtr);
@@ -5137,7 +5141,7 @@ static void DestroyPokerusIconObj(void)
     if (sPokerusIconObj->sprite != NULL)
         DestroySpriteAndFreeResources(sPokerusIconObj->sprite);
 
-    FREE_AND_SET_NULL_IF_SET(sPokerusIconObj);
+    sPokerusIconObj = NULL;
 }
 
 static void ShowPokerusIconObjIfHasOrHadPokerus(void)
@@ -5178,7 +5182,7 @@ static void CreateShinyStarObj(u16 tileTag, u16 palTag)
     u16 spriteId;
     void *gfxBufferPtr;
 
-    sShinyStarObjData = AllocZeroed(sizeof(struct ShinyStarObjData));
+    sShinyStarObjData = ArenaAllocZeroed(&sMonSummaryScreenArena, sizeof(struct ShinyStarObjData));
     gfxBufferPtr = AllocZeroed(0x20 * 2);
 
     DecompressDataWithHeaderWram(sStarObjTiles, gfxBufferPtr);
@@ -5221,7 +5225,7 @@ static void DestroyShinyStarObj(void)
     if (sShinyStarObjData->sprite != NULL)
         DestroySpriteAndFreeResources(sShinyStarObjData->sprite);
 
-    FREE_AND_SET_NULL_IF_SET(sShinyStarObjData);
+    sShinyStarObjData = NULL;
 }
 
 static void HideShowShinyStar(bool8 invisible)
@@ -2,6 +2,7 @@
 #include "task.h"
 #include "trig.h"
 #include "scanline_effect.h"
+#include "test_runner.h"
 
 extern u16 gBattle_BG0_X;
 extern u16 gBattle_BG0_Y;
@@ -91,12 +92,16 @@ void ScanlineEffect_InitHBlankDmaTransfer(void)
     else
     {
         DmaStop(0);
-        // Set DMA to copy to dest register on each HBlank for the next frame.
-        // The HBlank DMA transfers do not occurr during VBlank, so the transfer
-        // will begin on the HBlank after the first scanline
-        DmaSet(0, gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer], gScanlineEffect.dmaDest, gScanlineEffect.dmaControl);
-        // Manually set the reg for the first scanline
-        gScanlineEffect.setFirstScanlineReg();
+        // Headless turbo isn't in step with the display, so there is nothing to show.
+        if (!gTestRunnerTurbo)
+        {
+            // Set DMA to copy to dest register on each HBlank for the next frame.
+            // The HBlank DMA transfers do not occurr during VBlank, so the transfer
+            // will begin on the HBlank after the first scanline
+            DmaSet(0, gScanlineEffect.dmaSrcBuffers[gScanlineEffect.srcBuffer], gScanlineEffect.dmaDest, gScanlineEffect.dmaControl);
+            // Manually set the reg for the first scanline
+            gScanlineEffect.setFirstScanlineReg();
+        }
         // Swap current buffer
         gScanlineEffect.srcBuffer ^= 1;
     }
@@ -1,7 +1,9 @@
 #include "global.h"
 #include "sprite.h"
+#include "frame_profiler.h"
 #include "main.h"
 #include "palette.h"
+#include "test_runner.h"
 
 #define MAX_SPRITE_COPY_REQUESTS 64
 
@@ -297,7 +299,11 @@ void AnimateSprites(void)
 
         if (sprite->inUse)
         {
-            sprite->callback(sprite);
+            SpriteCallback callback = sprite->callback;
+            u32 start = FrameProfilerTime();
+
+            callback(sprite);
+            FrameProfilerAddFunc(FRAME_STAGE_SPRITE_CALLBACKS, callback, start);
 
             if (sprite->inUse)
                 AnimateSprite(sprite);
@@ -321,6 +327,7 @@ void BuildOamBuffer(void)
     u8 skippedSprites[MAX_SPRITES];
     u32 skippedSpritesN = 0;
     u32 matrices = 0;
+    u32 profilerStart = FrameProfilerTime();
 
     for (i = 0; i < MAX_SPRITES; i++)
     {
@@ -407,6 +414,7 @@ void BuildOamBuffer(void)
 
     gMain.oamLoadDisabled = oamLoadDisabled;
     sShouldProcessSpriteCopyRequests = TRUE;
+    FrameProfilerAddStage(FRAME_STAGE_BUILD_OAM, profilerStart);
 }
 
 static inline void InsertionSort(u32 *spritePriorities, s32 n)
@@ -571,7 +579,7 @@ void ResetOamRange(u32 start, u32 end)
 
 void LoadOam(void)
 {
-    if (!gMain.oamLoadDisabled)
+    if (!gMain.oamLoadDisabled && !gTestRunnerTurbo)
         CpuCopy32(gMain.oamBuffer, (void *)OAM, sizeof(gMain.oamBuffer));
 }
 
@@ -1459,6 +1467,17 @@ static u16 LoadSpriteSheetWithOffset(const struct SpriteSheet *sheet, u32 offset
     }
 }
 
+u16 AllocTilesForSpriteSheet(struct SpriteSheet *sheet)
+{
+    s16 tileStart = AllocSpriteTiles(sheet->size / TILE_SIZE_4BPP);
+
+    if (tileStart < 0)
+        return 0;
+
+    AllocSpriteTileRange(sheet->tag, (u16)tileStart, sheet->size / TILE_SIZE_4BPP);
+    return (u16)tileStart;
+}
+
 u16 LoadSpriteSheet(const struct SpriteSheet *sheet)
 {
     return LoadSpriteSheetWithOffset(sheet, 0);
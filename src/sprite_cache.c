@@ -0,0 +1,105 @@
+#include "global.h"
+#include "decompress.h"
+#include "sprite_cache.h"
+
+// Keeps the most recently decompressed sprite sheets and Pokémon pics in EWRAM,
+// so that reopening the same screen or switching the same Pokémon back in only
+// costs a copy instead of a decompression.
+// Sheets are keyed by their compressed data, which is unique per species, form,
+// gender and facing. Personality dependent changes like Spinda's spots are drawn
+// after the sheet is copied out of the cache.
+
+EWRAM_DATA struct SpriteCacheStats gSpriteCacheStats = {0};
+
+#if SPRITE_CACHE_SLOT_COUNT > 0
+
+struct SpriteCacheSlot
+{
+    const u32 *src;
+    u32 lastUse;
+};
+
+static EWRAM_DATA struct SpriteCacheSlot sSpriteCacheSlots[SPRITE_CACHE_SLOT_COUNT] = {0};
+static EWRAM_DATA u32 sSpriteCacheData[SPRITE_CACHE_SLOT_COUNT][SPRITE_CACHE_SLOT_SIZE / 4] = {0};
+static EWRAM_DATA u32 sSpriteCacheClock = 0;
+
+static u32 FindSpriteCacheSlot(const u32 *src)
+{
+    u32 i;
+
+    for (i = 0; i < SPRITE_CACHE_SLOT_COUNT; i++)
+    {
+        if (sSpriteCacheSlots[i].src == src)
+            return i;
+    }
+    return SPRITE_CACHE_SLOT_COUNT;
+}
+
+// Returns an empty slot if there is one, otherwise the least recently used one.
+static u32 GetSpriteCacheVictim(void)
+{
+    u32 i;
+    u32 victim = 0;
+
+    for (i = 0; i < SPRITE_CACHE_SLOT_COUNT; i++)
+    {
+        if (sSpriteCacheSlots[i].src == NULL)
+            return i;
+        if (sSpriteCacheSlots[i].lastUse < sSpriteCacheSlots[victim].lastUse)
+            victim = i;
+    }
+    gSpriteCacheStats.evictions++;
+    return victim;
+}
+
+void DecompressDataWithHeaderWramCached(const u32 *src, void *dest)
+{
+    u32 size = GetDecompressedDataSize(src);
+    u32 slot;
+
+    // Data outside of ROM may change between calls.
+    if (size > SPRITE_CACHE_SLOT_SIZE || size % 4 != 0 || (uintptr_t)src < ROM_START)
+    {
+        gSpriteCacheStats.uncached++;
+        DecompressDataWithHeaderWram(src, dest);
+        return;
+    }
+
+    slot = FindSpriteCacheSlot(src);
+    if (slot != SPRITE_CACHE_SLOT_COUNT)
+    {
+        gSpriteCacheStats.hits++;
+        CpuCopy32(sSpriteCacheData[slot], dest, size);
+    }
+    else
+    {
+        gSpriteCacheStats.misses++;
+        slot = GetSpriteCacheVictim();
+        DecompressDataWithHeaderWram(src, dest);
+        CpuCopy32(dest, sSpriteCacheData[slot], size);
+        sSpriteCacheSlots[slot].src = src;
+    }
+    sSpriteCacheSlots[slot].lastUse = ++sSpriteCacheClock;
+}
+
+void ResetSpriteCache(void)
+{
+    memset(sSpriteCacheSlots, 0, sizeof(sSpriteCacheSlots));
+    sSpriteCacheClock = 0;
+    memset(&gSpriteCacheStats, 0, sizeof(gSpriteCacheStats));
+}
+
+#else
+
+void DecompressDataWithHeaderWramCached(const u32 *src, void *dest)
+{
+    gSpriteCacheStats.uncached++;
+    DecompressDataWithHeaderWram(src, dest);
+}
+
+void ResetSpriteCache(void)
+{
+    memset(&gSpriteCacheStats, 0, sizeof(gSpriteCacheStats));
+}
+
+#endif // SPRITE_CACHE_SLOT_COUNT > 0
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "task.h"
+#include "frame_profiler.h"
 
 COMMON_DATA struct Task gTasks[NUM_TASKS] = {0};
 
@@ -115,7 +116,11 @@ void RunTasks(void)
     {
         do
         {
-            gTasks[taskId].func(taskId);
+            TaskFunc func = gTasks[taskId].func;
+            u32 start = FrameProfilerTime();
+
+            func(taskId);
+            FrameProfilerAddFunc(FRAME_STAGE_TASKS, func, start);
             taskId = gTasks[taskId].next;
         } while (taskId != TAIL_SENTINEL);
     }
@@ -21,6 +21,7 @@
 #define DARK_DOWN_ARROW_OFFSET 256
 
 static u16 RenderText(struct TextPrinter *);
+static u32 RenderTextInstant(struct TextPrinter *textPrinter, u32 maxPrinted);
 static u32 RenderFont(struct TextPrinter *);
 static u16 FontFunc_Small(struct TextPrinter *textPrinter);
 static u16 FontFunc_NormalCopy1(struct TextPrinter *textPrinter);
@@ -370,7 +371,7 @@ bool32 AddTextPrinter(struct TextPrinterTemplate *printerTemplate, u8 speed, voi
         sTempTextPrinter.textSpeed = 0;
 
         // Render all text (up to limit) at once
-        for (j = 0; j < 0x400; ++j)
+        for (j = RenderTextInstant(&sTempTextPrinter, 0x400); j < 0x400; ++j)
         {
             if (RenderFont(&sTempTextPrinter) == RENDER_FINISH)
                 break;
@@ -635,7 +636,7 @@ static u8 UNUSED GetLastTextColor(u8 colorType)
     }
 }
 
-inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u32 *glyphPixels, s32 width, s32 height)
+inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, const u32 *glyphPixels, s32 width, s32 height)
 {
     u32 xAdd, yAdd, pixelData, bits, toOrr, dummyX;
     u8 *dst;
@@ -659,11 +660,11 @@ inline static void GLYPH_COPY(u8 *windowTiles, u32 widthOffset, u32 j, u32 i, u3
     }
 }
 
-void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+static void CopyGlyphDataToWindow(struct TextPrinter *textPrinter, const struct TextGlyph *glyph)
 {
     struct Window *window;
     struct WindowTemplate *template;
-    u32 *glyphPixels;
+    const u32 *glyphPixels;
     u32 currX, currY, widthOffset;
     s32 glyphWidth, glyphHeight;
     u8 *windowTiles;
@@ -671,15 +672,15 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
     window = &gWindows[textPrinter->printerTemplate.windowId];
     template = &window->window;
 
-    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > gCurGlyph.width)
-        glyphWidth = gCurGlyph.width;
+    if ((glyphWidth = (template->width * 8) - textPrinter->printerTemplate.currentX) > glyph->width)
+        glyphWidth = glyph->width;
 
-    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > gCurGlyph.height)
-        glyphHeight = gCurGlyph.height;
+    if ((glyphHeight = (template->height * 8) - textPrinter->printerTemplate.currentY) > glyph->height)
+        glyphHeight = glyph->height;
 
     currX = textPrinter->printerTemplate.currentX;
     currY = textPrinter->printerTemplate.currentY;
-    glyphPixels = gCurGlyph.gfxBufferTop;
+    glyphPixels = glyph->gfxBufferTop;
     windowTiles = window->tileData;
     widthOffset = template->width * 32;
 
@@ -712,6 +713,133 @@ void CopyGlyphToWindow(struct TextPrinter *textPrinter)
     }
 }
 
+void CopyGlyphToWindow(struct TextPrinter *textPrinter)
+{
+    CopyGlyphDataToWindow(textPrinter, &gCurGlyph);
+}
+
+// Returns FALSE for fonts that RenderText doesn't draw, which leave
+// gCurGlyph as it was.
+static bool32 DecompressGlyph(u32 fontId, u16 glyphId, bool32 isJapanese)
+{
+    switch (fontId)
+    {
+    case FONT_SMALL:
+        DecompressGlyph_Small(glyphId, isJapanese);
+        return TRUE;
+    case FONT_NORMAL_COPY_1:
+        DecompressGlyph_NormalCopy1(glyphId, isJapanese);
+        return TRUE;
+    case FONT_NORMAL:
+        DecompressGlyph_Normal(glyphId, isJapanese);
+        return TRUE;
+    case FONT_NORMAL_COPY_2:
+        DecompressGlyph_NormalCopy2(glyphId, isJapanese);
+        return TRUE;
+    case FONT_MALE:
+        DecompressGlyph_Male(glyphId, isJapanese);
+        return TRUE;
+    case FONT_FEMALE:
+        DecompressGlyph_Female(glyphId, isJapanese);
+        return TRUE;
+    case FONT_NARROW:
+        DecompressGlyph_Narrow(glyphId, isJapanese);
+        return TRUE;
+    case FONT_SMALL_NARROW:
+        DecompressGlyph_SmallNarrow(glyphId, isJapanese);
+        return TRUE;
+    case FONT_NARROWER:
+        DecompressGlyph_Narrower(glyphId, isJapanese);
+        return TRUE;
+    case FONT_SMALL_NARROWER:
+        DecompressGlyph_SmallNarrower(glyphId, isJapanese);
+        return TRUE;
+    case FONT_SHORT_NARROW:
+        DecompressGlyph_ShortNarrow(glyphId, isJapanese);
+        return TRUE;
+    case FONT_SHORT:
+        DecompressGlyph_Short(glyphId, isJapanese);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+EWRAM_DATA struct GlyphCacheStats gGlyphCacheStats = {0};
+
+#if GLYPH_CACHE_SLOTS > 0
+
+#if GLYPH_CACHE_SLOTS % 2 != 0
+#error "GLYPH_CACHE_SLOTS must be even, every glyph can go into one of two slots."
+#endif
+
+#define GLYPH_CACHE_SETS (GLYPH_CACHE_SLOTS / 2)
+
+// A glyph only depends on its font, its id and the colors it was
+// decompressed with, which is everything a key holds.
+#define GLYPH_KEY_VALID (1u << 31)
+#define GLYPH_KEY(fontId, glyphId, isJapanese) (GLYPH_KEY_VALID | ((isJapanese) << 25) | ((fontId) << 21) \
+                                               | (sLastTextShadowColor << 17) | (sLastTextFgColor << 13) | (sLastTextBgColor << 9) | (glyphId))
+
+struct GlyphCacheSlot
+{
+    u32 key;
+    struct TextGlyph glyph;
+};
+
+static EWRAM_DATA struct GlyphCacheSlot sGlyphCache[GLYPH_CACHE_SETS][2] = {0};
+static EWRAM_DATA u8 sGlyphCacheNextWay[GLYPH_CACHE_SETS] = {0};
+
+// Returns the glyph to draw, which may be the cached copy instead of
+// gCurGlyph. Only gCurGlyph's width and height are set on a hit.
+static const struct TextGlyph *GetGlyph(u32 fontId, u16 glyphId, bool32 isJapanese)
+{
+    u32 key = GLYPH_KEY(fontId, glyphId, isJapanese & 1);
+    struct GlyphCacheSlot *set = sGlyphCache[(glyphId ^ (key >> 9) ^ (key >> 21)) % GLYPH_CACHE_SETS];
+    u32 way;
+
+    for (way = 0; way < 2; way++)
+    {
+        if (set[way].key == key)
+        {
+            gGlyphCacheStats.hits++;
+            gCurGlyph.width = set[way].glyph.width;
+            gCurGlyph.height = set[way].glyph.height;
+            return &set[way].glyph;
+        }
+    }
+
+    if (!DecompressGlyph(fontId, glyphId, isJapanese))
+        return &gCurGlyph;
+    gGlyphCacheStats.misses++;
+    way = sGlyphCacheNextWay[set - sGlyphCache[0]];
+    sGlyphCacheNextWay[set - sGlyphCache[0]] ^= 1;
+    set[way].key = key;
+    set[way].glyph = gCurGlyph;
+    return &set[way].glyph;
+}
+
+void ResetGlyphCache(void)
+{
+    memset(sGlyphCache, 0, sizeof(sGlyphCache));
+    memset(sGlyphCacheNextWay, 0, sizeof(sGlyphCacheNextWay));
+    memset(&gGlyphCacheStats, 0, sizeof(gGlyphCacheStats));
+}
+
+#else
+
+static const struct TextGlyph *GetGlyph(u32 fontId, u16 glyphId, bool32 isJapanese)
+{
+    DecompressGlyph(fontId, glyphId, isJapanese);
+    return &gCurGlyph;
+}
+
+void ResetGlyphCache(void)
+{
+    memset(&gGlyphCacheStats, 0, sizeof(gGlyphCacheStats));
+}
+
+#endif // GLYPH_CACHE_SLOTS > 0
+
 void ClearTextSpan(struct TextPrinter *textPrinter, u32 width)
 {
     struct Window *window;
@@ -1062,6 +1190,29 @@ void DrawDownArrow(u8 windowId, u16 x, u16 y, u8 bgColor, bool32 drawArrow, u8 *
     }
 }
 
+static void AdvancePastGlyph(struct TextPrinter *textPrinter)
+{
+    s32 width;
+
+    if (textPrinter->minLetterSpacing)
+    {
+        textPrinter->printerTemplate.currentX += gCurGlyph.width;
+        width = textPrinter->minLetterSpacing - gCurGlyph.width;
+        if (width > 0)
+        {
+            ClearTextSpan(textPrinter, width);
+            textPrinter->printerTemplate.currentX += width;
+        }
+    }
+    else
+    {
+        if (textPrinter->japanese)
+            textPrinter->printerTemplate.currentX += (gCurGlyph.width + textPrinter->printerTemplate.letterSpacing);
+        else
+            textPrinter->printerTemplate.currentX += gCurGlyph.width;
+    }
+}
+
 static u16 RenderText(struct TextPrinter *textPrinter)
 {
     struct TextPrinterSubStruct *subStruct = (struct TextPrinterSubStruct *)(&textPrinter->subStructFields);
@@ -1249,65 +1400,8 @@ static u16 RenderText(struct TextPrinter *textPrinter)
             return RENDER_FINISH;
         }
 
-        switch (subStruct->fontId)
-        {
-        case FONT_SMALL:
-            DecompressGlyph_Small(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL_COPY_1:
-            DecompressGlyph_NormalCopy1(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL:
-            DecompressGlyph_Normal(currChar, textPrinter->japanese);
-            break;
-        case FONT_NORMAL_COPY_2:
-            DecompressGlyph_NormalCopy2(currChar, textPrinter->japanese);
-            break;
-        case FONT_MALE:
-            DecompressGlyph_Male(currChar, textPrinter->japanese);
-            break;
-        case FONT_FEMALE:
-            DecompressGlyph_Female(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROW:
-            DecompressGlyph_Narrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROW:
-            DecompressGlyph_SmallNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_NARROWER:
-            DecompressGlyph_Narrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SMALL_NARROWER:
-            DecompressGlyph_SmallNarrower(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT_NARROW:
-            DecompressGlyph_ShortNarrow(currChar, textPrinter->japanese);
-            break;
-        case FONT_SHORT:
-            DecompressGlyph_Short(currChar, textPrinter->japanese);
-            break;
-        }
-
-        CopyGlyphToWindow(textPrinter);
-
-        if (textPrinter->minLetterSpacing)
-        {
-            textPrinter->printerTemplate.currentX += gCurGlyph.width;
-            width = textPrinter->minLetterSpacing - gCurGlyph.width;
-            if (width > 0)
-            {
-                ClearTextSpan(textPrinter, width);
-                textPrinter->printerTemplate.currentX += width;
-            }
-        }
-        else
-        {
-            if (textPrinter->japanese)
-                textPrinter->printerTemplate.currentX += (gCurGlyph.width + textPrinter->printerTemplate.letterSpacing);
-            else
-                textPrinter->printerTemplate.currentX += gCurGlyph.width;
-        }
+        CopyGlyphDataToWindow(textPrinter, GetGlyph(subStruct->fontId, currChar, textPrinter->japanese));
+        AdvancePastGlyph(textPrinter);
         return RENDER_PRINT;
     case RENDER_STATE_WAIT:
         if (TextPrinterWait(textPrinter))
@@ -1368,6 +1462,112 @@ static u16 RenderText(struct TextPrinter *textPrinter)
     return RENDER_FINISH;
 }
 
+// Draws up to 8 pixels of one row of a glyph, the same as GLYPH_COPY but
+// a whole row of a tile at a time.
+static inline void BlitGlyphRow(u32 *tileRow, u32 x, u32 pixels, u32 width)
+{
+    u32 mask, shift;
+
+    if (width < 8)
+        pixels &= (1 << (width * 4)) - 1;
+    // Every nibble that isn't transparent.
+    mask = pixels | (pixels >> 1) | (pixels >> 2) | (pixels >> 3);
+    mask = (mask & 0x11111111) * 0xF;
+    if (mask == 0)
+        return;
+
+    tileRow += (x / 8) * (TILE_SIZE_4BPP / 4);
+    shift = (x % 8) * 4;
+    tileRow[0] = (tileRow[0] & ~(mask << shift)) | (pixels << shift);
+    if (shift != 0 && (mask >> (32 - shift)) != 0)
+        tileRow[TILE_SIZE_4BPP / 4] = (tileRow[TILE_SIZE_4BPP / 4] & ~(mask >> (32 - shift))) | (pixels >> (32 - shift));
+}
+
+static void BlitGlyphToWindow(struct TextPrinter *textPrinter, const struct TextGlyph *glyph)
+{
+    struct Window *window = &gWindows[textPrinter->printerTemplate.windowId];
+    u32 x = textPrinter->printerTemplate.currentX;
+    u32 y = textPrinter->printerTemplate.currentY;
+    s32 width = min((s32)glyph->width, (s32)(window->window.width * 8) - (s32)x);
+    s32 height = min((s32)glyph->height, (s32)(window->window.height * 8) - (s32)y);
+    s32 row;
+
+    for (row = 0; row < height && width > 0; row++)
+    {
+        const u32 *pixels = glyph->gfxBufferTop + (row / 8) * 16 + (row % 8);
+        u32 *tileRow = (u32 *)(window->tileData + ((y + row) / 8) * window->window.width * TILE_SIZE_4BPP + ((y + row) % 8) * 4);
+
+        BlitGlyphRow(tileRow, x, pixels[0], min(width, 8));
+        if (width > 8)
+            BlitGlyphRow(tileRow, x + 8, pixels[8], width - 8);
+    }
+}
+
+// The first part of printing a string instantly, which draws every glyph
+// and line break in one loop instead of going through RenderFont for each
+// one. Other control codes are still handed to RenderText one at a time,
+// and anything that makes the printer wait, like a prompt or a pause, is
+// left for RenderFont. Returns how many times RenderFont would have
+// returned by then, which is at most maxPrinted.
+static u32 RenderTextInstant(struct TextPrinter *textPrinter, u32 maxPrinted)
+{
+    struct TextPrinterSubStruct *subStruct = (struct TextPrinterSubStruct *)(&textPrinter->subStructFields);
+    u32 fontId = textPrinter->printerTemplate.fontId;
+    u32 numPrinted = 0;
+    u16 currChar;
+
+    if (fontId >= ARRAY_COUNT(sFontInfos)
+     || fontId == FONT_BRAILLE
+     || gFonts[fontId].fontFunction == NULL
+     || gFonts[fontId].fontFunction != sFontInfos[fontId].fontFunction)
+        return 0;
+
+    if (subStruct->hasFontIdBeenSet == FALSE)
+    {
+        subStruct->fontId = fontId;
+        subStruct->hasFontIdBeenSet = TRUE;
+    }
+
+    while (numPrinted < maxPrinted && textPrinter->state == RENDER_STATE_HANDLE_CHAR)
+    {
+        currChar = *textPrinter->printerTemplate.currentChar;
+        switch (currChar)
+        {
+        case EOS:
+            return numPrinted;
+        case CHAR_NEWLINE:
+            textPrinter->printerTemplate.currentChar++;
+            textPrinter->printerTemplate.currentX = textPrinter->printerTemplate.x;
+            textPrinter->printerTemplate.currentY += (gFonts[fontId].maxLetterHeight + textPrinter->printerTemplate.lineSpacing);
+            break;
+        case PLACEHOLDER_BEGIN:
+        case EXT_CTRL_CODE_BEGIN:
+        case CHAR_PROMPT_CLEAR:
+        case CHAR_PROMPT_SCROLL:
+        case CHAR_EXTRA_SYMBOL:
+        case CHAR_KEYPAD_ICON:
+            switch (RenderText(textPrinter))
+            {
+            case RENDER_PRINT:
+                numPrinted++;
+                break;
+            case RENDER_REPEAT:
+                break;
+            default:
+                return numPrinted + 1;
+            }
+            break;
+        default:
+            textPrinter->printerTemplate.currentChar++;
+            BlitGlyphToWindow(textPrinter, GetGlyph(subStruct->fontId, currChar, textPrinter->japanese));
+            AdvancePastGlyph(textPrinter);
+            numPrinted++;
+            break;
+        }
+    }
+    return numPrinted;
+}
+
 static u32 (*GetFontWidthFunc(u8 fontId))(u16, bool32)
 {
     u32 i;
@@ -26,8 +26,6 @@
 #define WILD_CHECK_REPEL    0x1
 #define WILD_CHECK_KEEN_EYE 0x2
 
-#define HEADER_NONE 0xFFFF
-
 struct WildEncounterData
 {
     u32 rngState;
@@ -250,34 +248,31 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon, u8 wildMonIn
 
 u16 GetCurrentMapWildMonHeaderId(void)
 {
+    u32 mapGroup = gSaveBlock1Ptr->location.mapGroup;
+    u32 mapNum = gSaveBlock1Ptr->location.mapNum;
     u16 i;
 
-    for (i = 0; ; i++)
-    {
-        const struct WildPokemonHeader * wildHeader = &gWildMonHeaders[i];
-        if (wildHeader->mapGroup == MAP_GROUP(MAP_UNDEFINED))
-            break;
+    if (mapGroup >= MAP_GROUPS_COUNT
+     || mapNum >= sWildMonHeaderIdMapGroupStarts[mapGroup + 1] - sWildMonHeaderIdMapGroupStarts[mapGroup])
+        return HEADER_NONE;
 
-        if (gWildMonHeaders[i].mapGroup == gSaveBlock1Ptr->location.mapGroup &&
-            gWildMonHeaders[i].mapNum == gSaveBlock1Ptr->location.mapNum)
-        {
-            if (gSaveBlock1Ptr->location.mapGroup == MAP_GROUP(MAP_SIX_ISLAND_ALTERING_CAVE) &&
-                gSaveBlock1Ptr->location.mapNum == MAP_NUM(MAP_SIX_ISLAND_ALTERING_CAVE))
-            {
-                u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
-                if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
-                    alteringCaveId = 0;
+    i = sWildMonHeaderIdsByMap[sWildMonHeaderIdMapGroupStarts[mapGroup] + mapNum];
+    if (i == HEADER_NONE)
+        return HEADER_NONE;
 
-                i += alteringCaveId;
-            }
+    if (mapGroup == MAP_GROUP(MAP_SIX_ISLAND_ALTERING_CAVE) &&
+        mapNum == MAP_NUM(MAP_SIX_ISLAND_ALTERING_CAVE))
+    {
+        u16 alteringCaveId = VarGet(VAR_ALTERING_CAVE_WILD_SET);
+        if (alteringCaveId >= NUM_ALTERING_CAVE_TABLES)
+            alteringCaveId = 0;
 
-            if (!UnlockedTanobyOrAreNotInTanoby())
-                break;
-            return i;
-        }
+        i += alteringCaveId;
     }
 
-    return HEADER_NONE;
+    if (!UnlockedTanobyOrAreNotInTanoby())
+        return HEADER_NONE;
+    return i;
 }
 
 enum EncounterFallbacks
@@ -0,0 +1,112 @@
+#include "global.h"
+#include "malloc.h"
+#include "test/battle.h"
+#include "battle_ai_main.h"
+#include "battle_ai_util.h"
+
+AI_DOUBLE_BATTLE_TEST("AI damage simulated over several frames is the same as simulating it all at once")
+{
+    GIVEN {
+        ASSUME(AI_DATA_CYCLES_PER_FRAME != 0);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        // Shadow Tag is always known, so SetAiLogicDataForTurn doesn't guess.
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_SHADOW_TAG); Moves(MOVE_TACKLE, MOVE_WATER_GUN, MOVE_EMBER, MOVE_CELEBRATE); }
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_SHADOW_TAG); Moves(MOVE_THUNDERSHOCK, MOVE_GUST, MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_SCRATCH, MOVE_VINE_WHIP, MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_EMBER, MOVE_WATER_GUN, MOVE_CELEBRATE); }
+    } WHEN {
+        TURN { MOVE(playerLeft, MOVE_CELEBRATE); MOVE(playerRight, MOVE_CELEBRATE); }
+    } THEN {
+        struct AiLogicData *allAtOnce = Alloc(sizeof(*allAtOnce));
+        u32 frames = 1;
+
+        SetAiLogicDataForTurn(gAiLogicData);
+        FinishAiLogicDataForTurn();
+        memcpy(allAtOnce, gAiLogicData, sizeof(*allAtOnce));
+
+        SetAiLogicDataForTurn(gAiLogicData);
+        while (!ContinueAiLogicDataForTurn(1))
+            frames++;
+
+        EXPECT_GT(frames, 1);
+        EXPECT(memcmp(allAtOnce, gAiLogicData, sizeof(*allAtOnce)) == 0);
+        Free(allAtOnce);
+    }
+}
+
+// The player's controller may read its action while the simulation is still
+// running. TestRunner_Battle_CheckActionTaken fails the test if the action is
+// taken before then. An in-game partner would see it, or not, depending on
+// how fast the player was.
+AI_DOUBLE_BATTLE_TEST("No action is taken before the AI damage simulation is done")
+{
+    GIVEN {
+        ASSUME(AI_DATA_CYCLES_PER_FRAME != 0);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_TACKLE, MOVE_WATER_GUN, MOVE_EMBER, MOVE_CELEBRATE); }
+        PLAYER(SPECIES_WOBBUFFET) { Moves(MOVE_THUNDERSHOCK, MOVE_GUST, MOVE_VINE_WHIP, MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_SCRATCH, MOVE_VINE_WHIP, MOVE_EMBER, MOVE_WATER_GUN); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_EMBER, MOVE_WATER_GUN, MOVE_THUNDERSHOCK, MOVE_GUST); }
+    } WHEN {
+        TURN { MOVE(playerLeft, MOVE_CELEBRATE); MOVE(playerRight, MOVE_CELEBRATE); }
+        TURN { MOVE(playerLeft, MOVE_TACKLE, target: opponentLeft); MOVE(playerRight, MOVE_GUST, target: opponentRight); }
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI damage calcs for the same move and battle state come from the cache")
+{
+    GIVEN {
+        ASSUME(AI_DAMAGE_CACHE_SIZE != 0);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_SHADOW_TAG); Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_SCRATCH, MOVE_CELEBRATE); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        struct SimulatedDamage dmg;
+        uq4_12_t effectiveness;
+        u32 hits, misses;
+
+        SetAiLogicDataForTurn(gAiLogicData);
+        FinishAiLogicDataForTurn();
+
+        hits = gAiDamageCacheStats.hits;
+        dmg = AI_CalcDamage(MOVE_SCRATCH, B_POSITION_OPPONENT_LEFT, B_POSITION_PLAYER_LEFT, &effectiveness, USE_GIMMICK, NO_GIMMICK, AI_GetWeather());
+        EXPECT_EQ(gAiDamageCacheStats.hits, hits + 1);
+        EXPECT_EQ(dmg.median, gAiLogicData->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].median);
+
+        misses = gAiDamageCacheStats.misses;
+        gBattleMons[B_POSITION_PLAYER_LEFT].statStages[STAT_DEF] += 2;
+        dmg = AI_CalcDamage(MOVE_SCRATCH, B_POSITION_OPPONENT_LEFT, B_POSITION_PLAYER_LEFT, &effectiveness, USE_GIMMICK, NO_GIMMICK, AI_GetWeather());
+        gBattleMons[B_POSITION_PLAYER_LEFT].statStages[STAT_DEF] -= 2;
+        EXPECT_EQ(gAiDamageCacheStats.misses, misses + 1);
+        EXPECT_LT(dmg.median, gAiLogicData->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].median);
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI damage calcs miss the cache when a battle struct input like Rage Fist's hit count changes")
+{
+    GIVEN {
+        ASSUME(AI_DAMAGE_CACHE_SIZE != 0);
+        ASSUME(GetMoveEffect(MOVE_RAGE_FIST) == EFFECT_RAGE_FIST);
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_SHADOW_TAG); Moves(MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_RAGE_FIST, MOVE_CELEBRATE); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        struct SimulatedDamage dmg;
+        uq4_12_t effectiveness;
+        u32 misses;
+
+        SetAiLogicDataForTurn(gAiLogicData);
+        FinishAiLogicDataForTurn();
+
+        misses = gAiDamageCacheStats.misses;
+        gBattleStruct->timesGotHit[B_SIDE_OPPONENT][0] += 2;
+        dmg = AI_CalcDamage(MOVE_RAGE_FIST, B_POSITION_OPPONENT_LEFT, B_POSITION_PLAYER_LEFT, &effectiveness, USE_GIMMICK, NO_GIMMICK, AI_GetWeather());
+        gBattleStruct->timesGotHit[B_SIDE_OPPONENT][0] -= 2;
+        EXPECT_EQ(gAiDamageCacheStats.misses, misses + 1);
+        EXPECT_GT(dmg.median, gAiLogicData->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].median);
+    }
+}
@@ -0,0 +1,258 @@
+#include "global.h"
+#include "test/battle.h"
+
+// Each change is read again later in the same turn. With
+// B_CACHE_BATTLER_EFFECTS, T_BATTLER_EFFECT_CACHE_VERIFY works out every
+// cached ability and hold effect again, so these also fail if a change
+// leaves a stale entry.
+
+ASSUMPTIONS
+{
+    ASSUME(GetMoveType(MOVE_EARTHQUAKE) == TYPE_GROUND);
+}
+
+SINGLE_BATTLE_TEST("Battler effect cache: Skill Swap changes the abilities within the turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_SKILL_SWAP) == EFFECT_SKILL_SWAP);
+        PLAYER(SPECIES_WOBBUFFET) { Ability(ABILITY_TELEPATHY); Speed(2); }
+        OPPONENT(SPECIES_GASTLY) { Ability(ABILITY_LEVITATE); Speed(1); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_SKILL_SWAP); MOVE(opponent, MOVE_EARTHQUAKE); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_SKILL_SWAP, player);
+        MESSAGE("The opposing Gastly used Earthquake!");
+        MESSAGE("It doesn't affect Wobbuffet…");
+    }
+}
+
+SINGLE_BATTLE_TEST("Battler effect cache: Trick changes the items within the turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_TRICK) == EFFECT_TRICK);
+        ASSUME(GetItemHoldEffect(ITEM_FOCUS_SASH) == HOLD_EFFECT_FOCUS_SASH);
+        PLAYER(SPECIES_WOBBUFFET) { Speed(2); }
+        OPPONENT(SPECIES_WOBBUFFET) { Item(ITEM_FOCUS_SASH); Speed(1); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_TRICK); MOVE(opponent, MOVE_FISSURE); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_TRICK, player);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_FISSURE, opponent);
+        HP_BAR(player, hp: 1);
+        MESSAGE("Wobbuffet hung on using its Focus Sash!");
+    }
+}
+
+DOUBLE_BATTLE_TEST("Battler effect cache: Gastro Acid suppresses the ability within the turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_GASTRO_ACID) == EFFECT_GASTRO_ACID);
+        PLAYER(SPECIES_WOBBUFFET) { Speed(4); }
+        PLAYER(SPECIES_WOBBUFFET) { Speed(3); }
+        OPPONENT(SPECIES_GASTLY) { Ability(ABILITY_LEVITATE); Speed(2); }
+        OPPONENT(SPECIES_WOBBUFFET) { Speed(1); }
+    } WHEN {
+        TURN { MOVE(playerLeft, MOVE_GASTRO_ACID, target: opponentLeft); MOVE(playerRight, MOVE_EARTHQUAKE); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_GASTRO_ACID, playerLeft);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_EARTHQUAKE, playerRight);
+        HP_BAR(opponentLeft);
+    }
+}
+
+DOUBLE_BATTLE_TEST("Battler effect cache: Embargo negates the item within the turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_EMBARGO) == EFFECT_EMBARGO);
+        ASSUME(GetItemHoldEffect(ITEM_FOCUS_SASH) == HOLD_EFFECT_FOCUS_SASH);
+        PLAYER(SPECIES_WOBBUFFET) { Speed(4); }
+        PLAYER(SPECIES_WOBBUFFET) { Speed(3); }
+        OPPONENT(SPECIES_WOBBUFFET) { Item(ITEM_FOCUS_SASH); Speed(2); }
+        OPPONENT(SPECIES_WOBBUFFET) { Speed(1); }
+    } WHEN {
+        TURN { MOVE(playerLeft, MOVE_EMBARGO, target: opponentLeft); MOVE(playerRight, MOVE_FISSURE, target: opponentLeft); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_EMBARGO, playerLeft);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_FISSURE, playerRight);
+        HP_BAR(opponentLeft, hp: 0);
+    }
+}
+
+SINGLE_BATTLE_TEST("Battler effect cache: Magic Room negates the items until it ends")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_MAGIC_ROOM) == EFFECT_MAGIC_ROOM);
+        ASSUME(GetItemHoldEffect(ITEM_FOCUS_SASH) == HOLD_EFFECT_FOCUS_SASH);
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET) { Item(ITEM_FOCUS_SASH); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_MAGIC_ROOM); }
+        TURN { MOVE(player, MOVE_FISSURE); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_MAGIC_ROOM, player);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_FISSURE, player);
+        HP_BAR(opponent, hp: 0);
+    }
+}
+
+SINGLE_BATTLE_TEST("Battler effect cache: Transform copies the ability within the turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_TRANSFORM) == EFFECT_TRANSFORM);
+        PLAYER(SPECIES_GASTLY) { Ability(ABILITY_LEVITATE); Speed(1); }
+        OPPONENT(SPECIES_DITTO) { Speed(2); }
+    } WHEN {
+        TURN { MOVE(opponent, MOVE_TRANSFORM); MOVE(player, MOVE_EARTHQUAKE); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_TRANSFORM, opponent);
+        MESSAGE("Gastly used Earthquake!");
+        MESSAGE("It doesn't affect the opposing Ditto…");
+    }
+}
+
+DOUBLE_BATTLE_TEST("Battler effect cache: Neutralizing Gas suppresses abilities as soon as it switches in")
+{
+    GIVEN {
+        PLAYER(SPECIES_GASTLY) { Ability(ABILITY_LEVITATE); }
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WEEZING) { Ability(ABILITY_NEUTRALIZING_GAS); }
+    } WHEN {
+        TURN { SWITCH(opponentLeft, 2); MOVE(opponentRight, MOVE_EARTHQUAKE); }
+    } SCENE {
+        ABILITY_POPUP(opponentLeft, ABILITY_NEUTRALIZING_GAS);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_EARTHQUAKE, opponentRight);
+        HP_BAR(playerLeft);
+    }
+}
+
+static inline bool32 Old_CanBreakThroughAbility(u32 battlerAtk, u32 battlerDef, u32 ability, u32 hasAbilityShield, u32 ignoreMoldBreaker)
+{
+    if (hasAbilityShield || ignoreMoldBreaker)
+        return FALSE;
+
+    return ((IsMoldBreakerTypeAbility(battlerAtk, ability) || MoveIgnoresTargetAbility(gCurrentMove))
+         && battlerDef != battlerAtk
+         && gAbilitiesInfo[gBattleMons[battlerDef].ability].breakable
+         && gBattlerByTurnOrder[gCurrentTurnActionNumber] == battlerAtk
+         && gActionsByTurnOrder[gCurrentTurnActionNumber] == B_ACTION_USE_MOVE
+         && gCurrentTurnActionNumber < gBattlersCount);
+}
+
+static enum ItemHoldEffect Old_GetBattlerHoldEffect(u32 battler, bool32 checkNegating, bool32 checkAbility);
+
+// GetBattlerAbility and GetBattlerHoldEffect without the cache.
+static u32 Old_GetBattlerAbility(u32 battler)
+{
+    bool32 hasAbilityShield = Old_GetBattlerHoldEffect(battler, TRUE, FALSE) == HOLD_EFFECT_ABILITY_SHIELD;
+    bool32 abilityCantBeSuppressed = gAbilitiesInfo[gBattleMons[battler].ability].cantBeSuppressed;
+
+    if (abilityCantBeSuppressed)
+    {
+        if (gBattleMons[battler].status2 & STATUS2_TRANSFORMED
+            && gStatuses3[battler] & STATUS3_GASTRO_ACID
+            && gBattleMons[battler].ability == ABILITY_COMATOSE)
+                return ABILITY_NONE;
+
+        if (Old_CanBreakThroughAbility(gBattlerAttacker, battler, gBattleMons[gBattlerAttacker].ability, hasAbilityShield, FALSE))
+            return ABILITY_NONE;
+
+        return gBattleMons[battler].ability;
+    }
+
+    if (gStatuses3[battler] & STATUS3_GASTRO_ACID)
+        return ABILITY_NONE;
+
+    if (!hasAbilityShield
+     && IsNeutralizingGasOnField()
+     && gBattleMons[battler].ability != ABILITY_NEUTRALIZING_GAS)
+        return ABILITY_NONE;
+
+    if (Old_CanBreakThroughAbility(gBattlerAttacker, battler, gBattleMons[gBattlerAttacker].ability, hasAbilityShield, FALSE))
+        return ABILITY_NONE;
+
+    return gBattleMons[battler].ability;
+}
+
+static enum ItemHoldEffect Old_GetBattlerHoldEffect(u32 battler, bool32 checkNegating, bool32 checkAbility)
+{
+    if (checkNegating)
+    {
+        if (gStatuses3[battler] & STATUS3_EMBARGO)
+            return HOLD_EFFECT_NONE;
+        if (gFieldStatuses & STATUS_FIELD_MAGIC_ROOM)
+            return HOLD_EFFECT_NONE;
+        if (checkAbility && Old_GetBattlerAbility(battler) == ABILITY_KLUTZ && !(gStatuses3[battler] & STATUS3_GASTRO_ACID))
+            return HOLD_EFFECT_NONE;
+    }
+
+    gPotentialItemEffectBattler = battler;
+
+    if (gBattleMons[battler].item == ITEM_ENIGMA_BERRY_E_READER)
+        return gEnigmaBerries[battler].holdEffect;
+    else
+        return GetItemHoldEffect(gBattleMons[battler].item);
+}
+
+#define BENCHMARK_LOOKUPS 64
+
+// Nothing runs InvalidateBattlerEffectCache after the battle, so every
+// lookup after the first one for each battler comes from the cache.
+DOUBLE_BATTLE_TEST("Battler effect cache: GetBattlerHoldEffect is faster with the cache")
+{
+    GIVEN {
+        ASSUME(B_CACHE_BATTLER_EFFECTS);
+        PLAYER(SPECIES_WOBBUFFET) { Item(ITEM_LEFTOVERS); }
+        PLAYER(SPECIES_WOBBUFFET) { Item(ITEM_ABILITY_SHIELD); }
+        OPPONENT(SPECIES_WEEZING) { Ability(ABILITY_LEVITATE); Item(ITEM_LEFTOVERS); }
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN { }
+    } THEN {
+        struct Benchmark oldAbility, newAbility, oldHoldEffect, newHoldEffect;
+        u32 i, battler, oldSum = 0, newSum = 0;
+
+        BENCHMARK(&oldAbility)
+        {
+            for (i = 0; i < BENCHMARK_LOOKUPS; i++)
+            {
+                for (battler = 0; battler < MAX_BATTLERS_COUNT; battler++)
+                    oldSum += Old_GetBattlerAbility(battler);
+            }
+        }
+        BENCHMARK(&newAbility)
+        {
+            for (i = 0; i < BENCHMARK_LOOKUPS; i++)
+            {
+                for (battler = 0; battler < MAX_BATTLERS_COUNT; battler++)
+                    newSum += GetBattlerAbility(battler);
+            }
+        }
+        EXPECT_EQ(newSum, oldSum);
+
+        oldSum = newSum = 0;
+        BENCHMARK(&oldHoldEffect)
+        {
+            for (i = 0; i < BENCHMARK_LOOKUPS; i++)
+            {
+                for (battler = 0; battler < MAX_BATTLERS_COUNT; battler++)
+                    oldSum += Old_GetBattlerHoldEffect(battler, TRUE, TRUE);
+            }
+        }
+        BENCHMARK(&newHoldEffect)
+        {
+            for (i = 0; i < BENCHMARK_LOOKUPS; i++)
+            {
+                for (battler = 0; battler < MAX_BATTLERS_COUNT; battler++)
+                    newSum += GetBattlerHoldEffect(battler, TRUE);
+            }
+        }
+        EXPECT_EQ(newSum, oldSum);
+
+        // Abilities still check Neutralizing Gas and Mold Breaker on every
+        // call, so only the ticks are printed.
+        Test_MgbaPrintf("newAbility: %d ticks, oldAbility: %d ticks", newAbility.ticks, oldAbility.ticks);
+        EXPECT_FASTER(newHoldEffect, oldHoldEffect);
+    }
+}
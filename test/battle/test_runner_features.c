@@ -25,3 +25,46 @@ SINGLE_BATTLE_TEST("Forced abilities activate on switch-in")
         MESSAGE("Kadabra's Sp. Atk was heightened!");
     }
 }
+
+// Turbo skips the OAM, palette and scanline effect copies, and runs VBlank
+// as soon as the frame is done. None of that may change what happens in the
+// battle, so this covers moves with sprite, palette and scanline effect
+// animations, a stat change and a switch, and checks that the battle drew
+// the same random numbers.
+SINGLE_BATTLE_TEST("Battles play out the same with and without headless turbo", s16 scratchDamage, s16 emberDamage, s16 surfDamage, u32 status, u32 rng)
+{
+    bool32 turbo;
+
+    PARAMETRIZE { turbo = FALSE; }
+    PARAMETRIZE { turbo = TRUE; }
+    GIVEN {
+        gTestRunnerTurbo = turbo;
+        PLAYER(SPECIES_WOBBUFFET);
+        PLAYER(SPECIES_WYNAUT);
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN { MOVE(player, MOVE_SCRATCH); MOVE(opponent, MOVE_EMBER); }
+        TURN { MOVE(player, MOVE_GROWL); MOVE(opponent, MOVE_SWORDS_DANCE); }
+        TURN { SWITCH(player, 1); MOVE(opponent, MOVE_SURF); }
+    } SCENE {
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_SCRATCH, player);
+        HP_BAR(opponent, captureDamage: &results[i].scratchDamage);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_EMBER, opponent);
+        HP_BAR(player, captureDamage: &results[i].emberDamage);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_GROWL, player);
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_SWORDS_DANCE, opponent);
+        SWITCH_OUT_MESSAGE("Wobbuffet");
+        SEND_IN_MESSAGE("Wynaut");
+        ANIMATION(ANIM_TYPE_MOVE, MOVE_SURF, opponent);
+        HP_BAR(player, captureDamage: &results[i].surfDamage);
+    } THEN {
+        results[i].status = GetMonData(&PLAYER_PARTY[0], MON_DATA_STATUS);
+        results[i].rng = Random32();
+    } FINALLY {
+        EXPECT_EQ(results[0].scratchDamage, results[1].scratchDamage);
+        EXPECT_EQ(results[0].emberDamage, results[1].emberDamage);
+        EXPECT_EQ(results[0].surfDamage, results[1].surfDamage);
+        EXPECT_EQ(results[0].status, results[1].status);
+        EXPECT_EQ(results[0].rng, results[1].rng);
+    }
+}
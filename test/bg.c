@@ -0,0 +1,86 @@
+#include "global.h"
+#include "bg.h"
+#include "dma3.h"
+#include "malloc.h"
+#include "window.h"
+#include "test/test.h"
+
+static const struct BgTemplate sBgTemplate =
+{
+    .bg = 0,
+    .charBaseIndex = 0,
+    .mapBaseIndex = 31,
+    .screenSize = 0,
+    .paletteMode = 0,
+    .priority = 0,
+    .baseTile = 0,
+};
+
+static const struct WindowTemplate sWindowTemplates[] =
+{
+    {
+        .bg = 0,
+        .tilemapLeft = 1,
+        .tilemapTop = 1,
+        .width = 8,
+        .height = 4,
+        .paletteNum = 15,
+        .baseBlock = 1,
+    },
+    DUMMY_WIN_TEMPLATE,
+};
+
+// With interrupts off, so that the real VBlank doesn't run any of them.
+static void FlushDma3Requests(void)
+{
+    u16 ime = REG_IME;
+
+    REG_IME = 0;
+    while (WaitDma3Request(-1))
+        ProcessDma3Requests();
+    REG_IME = ime;
+}
+
+TEST("ProcessDma3Requests counts the bytes it copies")
+{
+    u16 *tilemap = AllocZeroed(BG_SCREEN_SIZE);
+    u32 totalBytes;
+
+    ResetBgsAndClearDma3BusyFlags(FALSE);
+    InitBgsFromTemplates(0, &sBgTemplate, 1);
+    SetBgTilemapBuffer(0, tilemap);
+    FlushDma3Requests();
+
+    tilemap[5 * 32 + 3] = 1;
+    totalBytes = gDma3Stats.totalBytes;
+    CopyBgTilemapBufferToVram(0);
+    FlushDma3Requests();
+
+    EXPECT_EQ(gDma3Stats.totalBytes - totalBytes, BG_SCREEN_SIZE);
+    EXPECT_EQ(gDma3Stats.lastVBlankBytes, BG_SCREEN_SIZE);
+    EXPECT(memcmp(BG_SCREEN_ADDR(31), tilemap, BG_SCREEN_SIZE) == 0);
+
+    UnsetBgTilemapBuffer(0);
+    Free(tilemap);
+}
+
+TEST("CopyWindowToVram copies all the tiles of the window")
+{
+    u32 totalBytes;
+
+    ResetBgsAndClearDma3BusyFlags(FALSE);
+    InitBgsFromTemplates(0, &sBgTemplate, 1);
+    InitWindows(sWindowTemplates);
+    FillWindowPixelBuffer(0, PIXEL_FILL(0));
+    FillWindowPixelRect(0, PIXEL_FILL(1), 8, 8, 8, 8);
+    FlushDma3Requests();
+
+    totalBytes = gDma3Stats.totalBytes;
+    CopyWindowToVram(0, COPYWIN_GFX);
+    FlushDma3Requests();
+
+    EXPECT_EQ(gDma3Stats.totalBytes - totalBytes, 8 * 4 * TILE_SIZE_4BPP);
+    EXPECT(memcmp((u8 *)BG_CHAR_ADDR(0) + TILE_SIZE_4BPP, gWindows[0].tileData, 8 * 4 * TILE_SIZE_4BPP) == 0);
+
+    FreeAllWindowBuffers();
+}
@@ -1,9 +1,11 @@
 #include "global.h"
+#include "battle_terrain.h"
 #include "decompress.h"
 #include "main.h"
 #include "malloc.h"
 #include "random.h"
 #include "sprite.h"
+#include "task.h"
 #include "test/test.h"
 #include "config/test.h"
 #include "config/general.h"
@@ -220,6 +222,41 @@ static bool32 DecompressTilemapPrintResultsVram(const u32 *tilemap, const u16 *o
     return areEqual;
 }
 
+//  Decompresses img over numSteps steps into VRAM, decompressing interruptImg in between every step
+static bool32 DecompressImgStreamed(const u32 *img, const u32 *orgImg, u32 numSteps, const u32 *interruptImg, u32 *stepsTaken)
+{
+    u32 imageSize = GetDecompressedDataSize(img);
+    u32 *compBuffer = (u32 *)VRAM;
+    u32 *interruptBuffer = NULL;
+    struct DecompressionStream stream;
+
+    if (interruptImg != NULL)
+        interruptBuffer = Alloc(GetDecompressedDataSize(interruptImg));
+
+    *stepsTaken = 0;
+    InitDecompressionStream(&stream, img, compBuffer, numSteps);
+    do
+    {
+        (*stepsTaken)++;
+        if (interruptImg != NULL)
+            DecompressDataWithHeaderWram(interruptImg, interruptBuffer);
+    } while (!ContinueDecompressionStream(&stream, 0));
+
+    Free(interruptBuffer);
+
+    bool32 areEqual = TRUE;
+    for (u32 i = 0; i < imageSize/4; i++)
+    {
+        if (orgImg[i] != compBuffer[i])
+        {
+            areEqual = FALSE;
+            break;
+        }
+    }
+
+    return areEqual;
+}
+
 TEST("Compression test: tileset smol VRAM")
 {
     static const u32 origFile[] = INCBIN_U32("test/compression/tilesetTest.4bpp");
@@ -6328,6 +6365,123 @@ TEST("Compression test: tilemap large LZ VRAM")
     EXPECT_EQ(areEqual, TRUE);
 }
 
+TEST("Compression test: large mode 0 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_0.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_0.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: large mode 1 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_1.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_1.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: large mode 2 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_2.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_2.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: large mode 3 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_3.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_3.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: large mode 4 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_4.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_4.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: large mode 5 smol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/large_mode_5.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/large_mode_5.4bpp.smol");
+    static const u32 interruptFile[] = INCBIN_U32("test/compression/small_mode_5.4bpp.smol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 8, interruptFile, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 8);
+}
+
+TEST("Compression test: tileset fastSmol streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/tilesetTest.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/tilesetTest.4bpp.fastSmol");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 16, NULL, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_GT(stepsTaken, 1);
+    EXPECT_LE(stepsTaken, 16);
+}
+
+TEST("Compression test: tileset LZ streamed")
+{
+    static const u32 origFile[] = INCBIN_U32("test/compression/tilesetTest.4bpp");
+    static const u32 compFile[] = INCBIN_U32("test/compression/tilesetTest.4bpp.lz");
+    u32 stepsTaken;
+
+    bool32 areEqual = DecompressImgStreamed(compFile, origFile, 16, NULL, &stepsTaken);
+    EXPECT_EQ(areEqual, TRUE);
+    EXPECT_EQ(stepsTaken, 1);
+}
+
+//  The way CB2_InitBattleInternal loads the battle background
+TEST("Compression test: battle background streamed by a task")
+{
+    const u32 *tileset = gBattleEnvironmentInfo[BATTLE_ENVIRONMENT_GRASS].background.tileset;
+    u32 imageSize = GetDecompressedDataSize(tileset);
+    u32 *orgImg = Alloc(imageSize);
+
+    DecompressDataWithHeaderWram(tileset, orgImg);
+    CreateDecompressionTask(tileset, (void *)BG_CHAR_ADDR(2), 0);
+    while (IsDecompressionTaskActive())
+        RunTasks();
+
+    EXPECT(memcmp((void *)BG_CHAR_ADDR(2), orgImg, imageSize) == 0);
+    Free(orgImg);
+}
+
 //  The fastLZ function for this doesn't exist
 /*
 TEST("Compression test: tilemap large fastLZ VRAM")
@@ -0,0 +1,100 @@
+#include "global.h"
+#include "dma3.h"
+#include "malloc.h"
+#include "test/test.h"
+
+#define SPRITE_COPY_SIZE 0x4000
+
+// Runs one VBlank's worth of requests from the start of the frame, with
+// interrupts off so that the real VBlank doesn't run any of them.
+static void ProcessDma3RequestsOnce(void)
+{
+    u16 ime = REG_IME;
+
+    REG_IME = 0;
+    while (REG_VCOUNT != 0)
+        ;
+    ProcessDma3Requests();
+    REG_IME = ime;
+}
+
+static void FlushDma3Requests(void)
+{
+    while (WaitDma3Request(-1))
+        ProcessDma3RequestsOnce();
+}
+
+TEST("DMA3 requests for sprite tiles go before bg tiles")
+{
+    s16 bgRequest, spriteRequest;
+
+    ASSUME(SPRITE_COPY_SIZE * 3 > DMA3_VBLANK_BYTE_BUDGET);
+    bgRequest = RequestDma3Copy((const void *)ROM_START, BG_CHAR_ADDR(0), SPRITE_COPY_SIZE * 2, DMA3_16BIT);
+    spriteRequest = RequestDma3Copy((const void *)ROM_START, OBJ_VRAM0, SPRITE_COPY_SIZE, DMA3_16BIT);
+
+    ProcessDma3RequestsOnce();
+    EXPECT_EQ(WaitDma3Request(spriteRequest), 0);
+    EXPECT_EQ(WaitDma3Request(bgRequest), -1);
+
+    FlushDma3Requests();
+    EXPECT_EQ(WaitDma3Request(bgRequest), 0);
+}
+
+TEST("DMA3 requests finish within DMA3_MAX_WAIT_VBLANKS")
+{
+    u32 *buffer = AllocZeroed(0x100);
+    u32 i, frames = 0;
+    s16 request;
+
+    ASSUME(SPRITE_COPY_SIZE * 3 > DMA3_VBLANK_BYTE_BUDGET);
+    request = RequestDma3Fill(0x12345678, buffer, 0x100, DMA3_32BIT);
+
+    // Every frame asks for more sprite tiles than fit in one VBlank.
+    while (WaitDma3Request(request))
+    {
+        for (i = 0; i < 3; i++)
+            RequestDma3Copy((const void *)ROM_START, OBJ_VRAM0, SPRITE_COPY_SIZE, DMA3_16BIT);
+        ProcessDma3RequestsOnce();
+        frames++;
+    }
+    FlushDma3Requests();
+
+    EXPECT_LE(frames, DMA3_MAX_WAIT_VBLANKS);
+    for (i = 0; i < 0x100 / sizeof(u32); i++)
+        EXPECT_EQ(buffer[i], 0x12345678);
+
+    Free(buffer);
+}
+
+TEST("DMA3 requests that continue the last one are merged")
+{
+    u8 *src = AllocZeroed(0x80);
+    u8 *dest = AllocZeroed(0x80);
+    u32 mergedRequests = gDma3Stats.mergedRequests;
+    u32 i;
+
+    for (i = 0; i < 0x80; i++)
+        src[i] = i;
+    EXPECT_EQ(RequestDma3Copy(src, dest, 0x40, DMA3_32BIT), RequestDma3Copy(src + 0x40, dest + 0x40, 0x40, DMA3_32BIT));
+    EXPECT_EQ(gDma3Stats.mergedRequests, mergedRequests + 1);
+    FlushDma3Requests();
+    EXPECT(memcmp(src, dest, 0x80) == 0);
+
+    Free(dest);
+    Free(src);
+}
+
+TEST("DMA3 requests wait for older requests that they depend on")
+{
+    u32 *buffer = AllocZeroed(0x80);
+    u32 i;
+
+    RequestDma3Fill(0x12345678, buffer, 0x80, DMA3_32BIT);
+    RequestDma3Copy(buffer, OBJ_VRAM0, 0x80, DMA3_32BIT);
+    FlushDma3Requests();
+
+    for (i = 0; i < 0x80 / sizeof(u32); i++)
+        EXPECT_EQ(((u32 *)OBJ_VRAM0)[i], 0x12345678);
+
+    Free(buffer);
+}
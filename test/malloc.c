@@ -0,0 +1,163 @@
+#include "global.h"
+#include "malloc.h"
+#include "test/test.h"
+
+TEST("Alloc reuses a freed block of the same size")
+{
+    void *a = Alloc(24);
+    void *b = Alloc(24);
+    void *c;
+
+    Free(a);
+    c = Alloc(24);
+    EXPECT_EQ(a, c);
+
+    Free(b);
+    Free(c);
+}
+
+TEST("Alloc skips free blocks that are too small")
+{
+    void *small = Alloc(300);
+    void *guard = Alloc(16);
+    void *large;
+
+    Free(small);
+    large = Alloc(400);
+    EXPECT_NE(small, large);
+    EXPECT(CheckHeap());
+
+    Free(guard);
+    Free(large);
+}
+
+TEST("Free merges neighbouring free blocks")
+{
+    const struct MemBlock *head = HeapHead();
+    void *a = Alloc(100);
+    void *b = Alloc(200);
+    void *c = Alloc(300);
+
+    Free(b);
+    Free(a);
+    Free(c);
+    EXPECT(CheckHeap());
+    EXPECT(head->next == head);
+    EXPECT_EQ((u32)head->size, HEAP_SIZE - sizeof(struct MemBlock));
+    EXPECT_EQ(GetHeapFragmentation(), 0);
+}
+
+TEST("Heap stats track the used bytes and their high-water mark")
+{
+    void *a = Alloc(1000);
+    void *b = Alloc(2000);
+
+    EXPECT_EQ(gHeapStats.numAllocations, 2);
+    EXPECT_EQ(gHeapStats.usedBytes, 3000 + 2 * sizeof(struct MemBlock));
+    Free(a);
+    Free(b);
+    EXPECT_EQ(gHeapStats.numAllocations, 0);
+    EXPECT_EQ(gHeapStats.usedBytes, 0);
+    EXPECT_EQ(gHeapStats.peakUsedBytes, 3000 + 2 * sizeof(struct MemBlock));
+}
+
+TEST("Heap fragmentation counts free memory outside of the largest free block")
+{
+    void *a = Alloc(1024);
+    void *b = Alloc(16);
+    void *c = Alloc(1024);
+    void *d = Alloc(16);
+
+    Free(a);
+    Free(c);
+    EXPECT_EQ(GetHeapFragmentation(), 2 * (1024 + sizeof(struct MemBlock)) * 100 / HEAP_SIZE);
+
+    Free(b);
+    Free(d);
+    EXPECT_EQ(GetHeapFragmentation(), 0);
+    EXPECT_GE(gHeapStats.peakFragmentation, 2 * (1024 + sizeof(struct MemBlock)) * 100 / HEAP_SIZE);
+}
+
+TEST("ArenaAlloc bumps through a single heap block until FreeArena")
+{
+    struct Arena arena = {0};
+    u8 *a = ArenaAlloc(&arena, 10);
+    u8 *b = ArenaAlloc(&arena, 20);
+
+    EXPECT_EQ(b, a + 12);
+    EXPECT_EQ(gHeapStats.numAllocations, 1);
+
+    FreeArena(&arena);
+    EXPECT_EQ(gHeapStats.numAllocations, 0);
+    EXPECT(arena.chunks == NULL);
+}
+
+TEST("ArenaAlloc takes a new chunk when the current one is full")
+{
+    struct Arena arena = {0};
+    u32 i;
+
+    for (i = 0; i < 8; i++)
+        ArenaAlloc(&arena, ARENA_CHUNK_SIZE / 4);
+    EXPECT_EQ(gHeapStats.numAllocations, 2);
+
+    FreeArena(&arena);
+    EXPECT_EQ(gHeapStats.usedBytes, 0);
+}
+
+TEST("ArenaAlloc gives large allocations their own heap block")
+{
+    struct Arena arena = {0};
+    u8 *a = ArenaAlloc(&arena, 16);
+    u8 *large = ArenaAlloc(&arena, ARENA_CHUNK_SIZE);
+    u8 *b = ArenaAlloc(&arena, 16);
+
+    EXPECT_EQ(b, a + 16);
+    EXPECT(large < a || large >= a + ARENA_CHUNK_SIZE);
+    EXPECT_EQ(gHeapStats.numAllocations, 2);
+
+    FreeArena(&arena);
+    EXPECT_EQ(gHeapStats.usedBytes, 0);
+}
+
+TEST("ArenaAllocZeroed clears reused memory")
+{
+    struct Arena arena = {0};
+    u32 *a = ArenaAlloc(&arena, 64);
+    u32 i;
+
+    for (i = 0; i < 16; i++)
+        a[i] = 0xFFFFFFFF;
+    FreeArena(&arena);
+
+    a = ArenaAllocZeroed(&arena, 64);
+    for (i = 0; i < 16; i++)
+        EXPECT_EQ(a[i], 0);
+    FreeArena(&arena);
+}
+
+// Roughly what the summary screen allocates for its state and sprite objects.
+static const u16 sMenuAllocSizes[] = { 1200, 56, 8, 8, 8, 8, 12, 52, 56, 12, 12 };
+
+TEST("FreeArena is faster than freeing every allocation")
+{
+    struct Benchmark heap, arena;
+    struct Arena menuArena = {0};
+    void *pointers[ARRAY_COUNT(sMenuAllocSizes)];
+    u32 i;
+
+    BENCHMARK(&heap)
+    {
+        for (i = 0; i < ARRAY_COUNT(sMenuAllocSizes); i++)
+            pointers[i] = Alloc(sMenuAllocSizes[i]);
+        for (i = 0; i < ARRAY_COUNT(sMenuAllocSizes); i++)
+            Free(pointers[i]);
+    }
+    BENCHMARK(&arena)
+    {
+        for (i = 0; i < ARRAY_COUNT(sMenuAllocSizes); i++)
+            pointers[i] = ArenaAlloc(&menuArena, sMenuAllocSizes[i]);
+        FreeArena(&menuArena);
+    }
+    EXPECT_FASTER(arena, heap);
+}
@@ -450,3 +450,165 @@ TEST("Pokémon level up learnsets fit within MAX_LEVEL_UP_MOVES and MAX_RELEARNE
     EXPECT_LT(count, MAX_LEVEL_UP_MOVES);
     EXPECT_LT(count, MAX_RELEARNER_MOVES - 1); // - 1 because at least one move is already known
 }
+
+TEST("BoxMonView reads the same fields as GetBoxMonData")
+{
+    u32 field;
+    struct Pokemon mon;
+    struct BoxMonView view;
+    u32 expected, actual;
+    PARAMETRIZE { field = MON_DATA_SPECIES; }
+    PARAMETRIZE { field = MON_DATA_EXP; }
+    PARAMETRIZE { field = MON_DATA_MOVE1; }
+    PARAMETRIZE { field = MON_DATA_HP_EV; }
+    PARAMETRIZE { field = MON_DATA_SPDEF_IV; }
+    PARAMETRIZE { field = MON_DATA_IVS; }
+    PARAMETRIZE { field = MON_DATA_PERSONALITY; }
+    PARAMETRIZE { field = MON_DATA_HIDDEN_NATURE; }
+    CreateMon(&mon, SPECIES_WOBBUFFET, 42, USE_RANDOM_IVS, FALSE, 0, OT_ID_PRESET, 0);
+    expected = GetBoxMonData(&mon.box, field);
+    OpenBoxMonView(&view, &mon.box);
+    actual = GetBoxMonViewData(&view, field);
+    CloseBoxMonView(&view);
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(GetBoxMonData(&mon.box, field), expected);
+    EXPECT_EQ(GetBoxMonData(&mon.box, MON_DATA_SANITY_IS_BAD_EGG), FALSE);
+}
+
+TEST("BoxMonView writes update the checksum")
+{
+    u32 heldItem = ITEM_LEFTOVERS, friendship = 123;
+    struct Pokemon mon;
+    struct BoxMonView view;
+    CreateMon(&mon, SPECIES_WOBBUFFET, 42, 0, FALSE, 0, OT_ID_PRESET, 0);
+    OpenBoxMonView(&view, &mon.box);
+    SetBoxMonViewData(&view, MON_DATA_HELD_ITEM, &heldItem);
+    SetBoxMonViewData(&view, MON_DATA_FRIENDSHIP, &friendship);
+    EXPECT_EQ(GetBoxMonViewData(&view, MON_DATA_HELD_ITEM), ITEM_LEFTOVERS);
+    CloseBoxMonView(&view);
+    EXPECT_EQ(GetMonData(&mon, MON_DATA_HELD_ITEM), ITEM_LEFTOVERS);
+    EXPECT_EQ(GetMonData(&mon, MON_DATA_FRIENDSHIP), 123);
+    EXPECT_EQ(GetMonData(&mon, MON_DATA_SANITY_IS_BAD_EGG), FALSE);
+}
+
+TEST("BoxMonView of a corrupted Pokémon is a Bad Egg")
+{
+    u32 heldItem = ITEM_LEFTOVERS;
+    struct Pokemon mon;
+    struct BoxMonView view;
+    CreateMon(&mon, SPECIES_WOBBUFFET, 42, 0, FALSE, 0, OT_ID_PRESET, 0);
+    mon.box.secure.raw[0] ^= 1;
+    OpenBoxMonView(&view, &mon.box);
+    SetBoxMonViewData(&view, MON_DATA_HELD_ITEM, &heldItem);
+    EXPECT_EQ(GetBoxMonViewData(&view, MON_DATA_SPECIES), SPECIES_EGG);
+    CloseBoxMonView(&view);
+    EXPECT_EQ(GetMonData(&mon, MON_DATA_SANITY_IS_BAD_EGG), TRUE);
+    EXPECT_NE(GetMonData(&mon, MON_DATA_HELD_ITEM), ITEM_LEFTOVERS);
+}
+
+#define CALC_STAT_PER_FIELD(base, iv, ev, statIndex, field)     \
+{                                                               \
+    u8 baseStat = gSpeciesInfo[species].base;                   \
+    s32 n = (((2 * baseStat + iv + ev / 4) * level) / 100) + 5; \
+    n = ModifyStatByNature(nature, n, statIndex);               \
+    if (B_FRIENDSHIP_BOOST == TRUE)                             \
+        n = n + ((n * 10 * friendship) / (MAX_FRIENDSHIP * 100));\
+    SetMonData(mon, field, &n);                                 \
+}
+
+// CalculateMonStats as it was before BoxMonView, with every field read
+// decrypting the Pokémon separately.
+static void CalculateMonStatsPerField(struct Pokemon *mon)
+{
+    s32 oldMaxHP = GetMonData(mon, MON_DATA_MAX_HP, NULL);
+    s32 currentHP = GetMonData(mon, MON_DATA_HP, NULL);
+    s32 hpIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_HP) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_HP_IV, NULL);
+    s32 hpEV = GetMonData(mon, MON_DATA_HP_EV, NULL);
+    s32 attackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_ATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_ATK_IV, NULL);
+    s32 attackEV = GetMonData(mon, MON_DATA_ATK_EV, NULL);
+    s32 defenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_DEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_DEF_IV, NULL);
+    s32 defenseEV = GetMonData(mon, MON_DATA_DEF_EV, NULL);
+    s32 speedIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPEED) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPEED_IV, NULL);
+    s32 speedEV = GetMonData(mon, MON_DATA_SPEED_EV, NULL);
+    s32 spAttackIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPATK) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPATK_IV, NULL);
+    s32 spAttackEV = GetMonData(mon, MON_DATA_SPATK_EV, NULL);
+    s32 spDefenseIV = GetMonData(mon, MON_DATA_HYPER_TRAINED_SPDEF) ? MAX_PER_STAT_IVS : GetMonData(mon, MON_DATA_SPDEF_IV, NULL);
+    s32 spDefenseEV = GetMonData(mon, MON_DATA_SPDEF_EV, NULL);
+    u16 species = GetMonData(mon, MON_DATA_SPECIES, NULL);
+    u8 friendship = GetMonData(mon, MON_DATA_FRIENDSHIP, NULL);
+    u32 exp = GetMonData(mon, MON_DATA_EXP, NULL);
+    s32 level = 1;
+    s32 newMaxHP;
+    u8 nature = GetMonData(mon, MON_DATA_HIDDEN_NATURE, NULL);
+
+    while (level <= MAX_LEVEL && gExperienceTables[gSpeciesInfo[species].growthRate][level] <= exp)
+        level++;
+    level--;
+
+    SetMonData(mon, MON_DATA_LEVEL, &level);
+
+    if (species == SPECIES_SHEDINJA)
+    {
+        newMaxHP = 1;
+    }
+    else
+    {
+        s32 n = 2 * GetSpeciesBaseHP(species) + hpIV;
+        newMaxHP = (((n + hpEV / 4) * level) / 100) + level + 10;
+    }
+
+    SetMonData(mon, MON_DATA_MAX_HP, &newMaxHP);
+
+    CALC_STAT_PER_FIELD(baseAttack, attackIV, attackEV, STAT_ATK, MON_DATA_ATK)
+    CALC_STAT_PER_FIELD(baseDefense, defenseIV, defenseEV, STAT_DEF, MON_DATA_DEF)
+    CALC_STAT_PER_FIELD(baseSpeed, speedIV, speedEV, STAT_SPEED, MON_DATA_SPEED)
+    CALC_STAT_PER_FIELD(baseSpAttack, spAttackIV, spAttackEV, STAT_SPATK, MON_DATA_SPATK)
+    CALC_STAT_PER_FIELD(baseSpDefense, spDefenseIV, spDefenseEV, STAT_SPDEF, MON_DATA_SPDEF)
+
+    if (currentHP == 0 && oldMaxHP != 0)
+        return;
+    if (newMaxHP > oldMaxHP)
+        currentHP += newMaxHP - oldMaxHP;
+    if (currentHP > newMaxHP)
+        currentHP = newMaxHP;
+
+    SetMonData(mon, MON_DATA_HP, &currentHP);
+}
+
+TEST("CalculateMonStats with a BoxMonView is faster than per-field reads")
+{
+    u32 i;
+    struct Benchmark viewBenchmark, perFieldBenchmark;
+
+    ZeroPlayerPartyMons();
+    for (i = 0; i < PARTY_SIZE; i++)
+        CreateMon(&gPlayerParty[i], SPECIES_WOBBUFFET + i, 10 + 15 * i, USE_RANDOM_IVS, FALSE, 0, OT_ID_PRESET, 0);
+
+    BENCHMARK(&perFieldBenchmark)
+    {
+        for (i = 0; i < PARTY_SIZE; i++)
+            CalculateMonStatsPerField(&gPlayerParty[i]);
+    }
+
+    BENCHMARK(&viewBenchmark)
+    {
+        for (i = 0; i < PARTY_SIZE; i++)
+            CalculateMonStats(&gPlayerParty[i]);
+    }
+
+    EXPECT_FASTER(viewBenchmark, perFieldBenchmark);
+
+    for (i = 0; i < PARTY_SIZE; i++)
+    {
+        struct Pokemon mon = gPlayerParty[i];
+        CalculateMonStatsPerField(&mon);
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_LEVEL), GetMonData(&gPlayerParty[i], MON_DATA_LEVEL));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_MAX_HP), GetMonData(&gPlayerParty[i], MON_DATA_MAX_HP));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_ATK), GetMonData(&gPlayerParty[i], MON_DATA_ATK));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_DEF), GetMonData(&gPlayerParty[i], MON_DATA_DEF));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_SPEED), GetMonData(&gPlayerParty[i], MON_DATA_SPEED));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_SPATK), GetMonData(&gPlayerParty[i], MON_DATA_SPATK));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_SPDEF), GetMonData(&gPlayerParty[i], MON_DATA_SPDEF));
+        EXPECT_EQ(GetMonData(&mon, MON_DATA_HP), GetMonData(&gPlayerParty[i], MON_DATA_HP));
+    }
+}
@@ -153,3 +153,52 @@ TEST("Every species has a description")
 
     EXPECT_NE(StringCompare(GetSpeciesPokedexDescription(species), gFallbackPokedexText), 0);
 }
+
+TEST("NationalPokedexNumToSpecies finds the first species with that National Dex number")
+{
+    u32 i, nationalNum, expected;
+
+    for (nationalNum = NATIONAL_DEX_NONE + 1; nationalNum < NATIONAL_DEX_END; nationalNum++)
+    {
+        expected = SPECIES_NONE;
+        for (i = 1; i < NUM_SPECIES; i++)
+        {
+            if (gSpeciesInfo[i].natDexNum == nationalNum)
+            {
+                expected = GET_BASE_SPECIES_ID(i);
+                break;
+            }
+        }
+        EXPECT_EQ(NationalPokedexNumToSpecies(nationalNum), expected);
+    }
+    EXPECT_EQ(NationalPokedexNumToSpecies(NATIONAL_DEX_NONE), SPECIES_NONE);
+}
+
+TEST("National to regional Dex lookups are the inverse of the regional Dex orders")
+{
+    u32 i, nationalNum, expectedKanto, expectedHoenn;
+
+    for (nationalNum = NATIONAL_DEX_NONE + 1; nationalNum < NATIONAL_DEX_END; nationalNum++)
+    {
+        expectedKanto = KANTO_DEX_NONE;
+        for (i = KANTO_DEX_BULBASAUR; i <= KANTO_DEX_COUNT; i++)
+        {
+            if (KantoToNationalDexNum(i) == nationalNum)
+            {
+                expectedKanto = i;
+                break;
+            }
+        }
+        expectedHoenn = HOENN_DEX_NONE;
+        for (i = HOENN_DEX_START; i < HOENN_DEX_COUNT; i++)
+        {
+            if (HoennToNationalOrder(i) == nationalNum)
+            {
+                expectedHoenn = i;
+                break;
+            }
+        }
+        EXPECT_EQ(NationalToKantoDexNum(nationalNum), expectedKanto);
+        EXPECT_EQ(NationalToHoennOrder(nationalNum), expectedHoenn);
+    }
+}
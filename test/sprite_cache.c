@@ -0,0 +1,131 @@
+#include "global.h"
+#include "decompress.h"
+#include "malloc.h"
+#include "sprite_cache.h"
+#include "test/test.h"
+
+#define PIC_BUFFER_SIZE (MON_PIC_SIZE * MAX_MON_PIC_FRAMES)
+
+// Tests use the SPRITE_CACHE_SIZE that ships, so the tests of a cache with
+// slots only run when it is turned on.
+
+TEST("Pics are decompressed again every time without the sprite cache")
+{
+    u8 *firstBuffer, *secondBuffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT == 0);
+    firstBuffer = Alloc(PIC_BUFFER_SIZE);
+    secondBuffer = Alloc(PIC_BUFFER_SIZE);
+
+    LoadSpecialPokePic(firstBuffer, SPECIES_BULBASAUR, 0, TRUE);
+    LoadSpecialPokePic(secondBuffer, SPECIES_BULBASAUR, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.uncached, 2);
+    EXPECT_EQ(gSpriteCacheStats.hits, 0);
+    EXPECT(memcmp(firstBuffer, secondBuffer, PIC_BUFFER_SIZE) == 0);
+
+    Free(firstBuffer);
+    Free(secondBuffer);
+}
+
+TEST("Sprite cache returns the same pic on a hit")
+{
+    u8 *missBuffer, *hitBuffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT > 0);
+    missBuffer = Alloc(PIC_BUFFER_SIZE);
+    hitBuffer = Alloc(PIC_BUFFER_SIZE);
+
+    LoadSpecialPokePic(missBuffer, SPECIES_BULBASAUR, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.misses, 1);
+    EXPECT_EQ(gSpriteCacheStats.hits, 0);
+    LoadSpecialPokePic(hitBuffer, SPECIES_BULBASAUR, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.misses, 1);
+    EXPECT_EQ(gSpriteCacheStats.hits, 1);
+    EXPECT(memcmp(missBuffer, hitBuffer, PIC_BUFFER_SIZE) == 0);
+
+    Free(missBuffer);
+    Free(hitBuffer);
+}
+
+TEST("Sprite cache keeps front and back pics apart")
+{
+    u8 *buffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT > 0);
+    buffer = Alloc(PIC_BUFFER_SIZE);
+
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR, 0, TRUE);
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR, 0, FALSE);
+    EXPECT_EQ(gSpriteCacheStats.misses, 2);
+    EXPECT_EQ(gSpriteCacheStats.hits, 0);
+
+    Free(buffer);
+}
+
+TEST("Sprite cache evicts the least recently used pic")
+{
+    u32 i;
+    u8 *buffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT >= 2);
+    buffer = Alloc(PIC_BUFFER_SIZE);
+
+    for (i = 0; i < SPRITE_CACHE_SLOT_COUNT; i++)
+        LoadSpecialPokePic(buffer, SPECIES_BULBASAUR + i, 0, TRUE);
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.hits, 1);
+    EXPECT_EQ(gSpriteCacheStats.evictions, 0);
+
+    // Evicts SPECIES_BULBASAUR + 1, which is now the least recently used.
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR + SPRITE_CACHE_SLOT_COUNT, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.evictions, 1);
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.hits, 2);
+    LoadSpecialPokePic(buffer, SPECIES_BULBASAUR + 1, 0, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.misses, SPRITE_CACHE_SLOT_COUNT + 2);
+
+    Free(buffer);
+}
+
+TEST("Sprite cache draws Spinda's spots for the requested personality")
+{
+    u8 *expected, *buffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT > 0);
+    expected = Alloc(PIC_BUFFER_SIZE);
+    buffer = Alloc(PIC_BUFFER_SIZE);
+
+    LoadSpecialPokePic(expected, SPECIES_SPINDA, 0x12345678, TRUE);
+    ResetSpriteCache();
+
+    LoadSpecialPokePic(buffer, SPECIES_SPINDA, 0x87654321, TRUE);
+    EXPECT(memcmp(expected, buffer, PIC_BUFFER_SIZE) != 0);
+    LoadSpecialPokePic(buffer, SPECIES_SPINDA, 0x12345678, TRUE);
+    EXPECT_EQ(gSpriteCacheStats.hits, 1);
+    EXPECT(memcmp(expected, buffer, PIC_BUFFER_SIZE) == 0);
+
+    Free(expected);
+    Free(buffer);
+}
+
+TEST("Sprite cache hits are faster than decompressing")
+{
+    struct Benchmark miss, hit;
+    u8 *buffer;
+
+    ASSUME(SPRITE_CACHE_SLOT_COUNT > 0);
+    buffer = Alloc(PIC_BUFFER_SIZE);
+
+    BENCHMARK(&miss)
+    {
+        LoadSpecialPokePic(buffer, SPECIES_CHARIZARD, 0, TRUE);
+    }
+    BENCHMARK(&hit)
+    {
+        LoadSpecialPokePic(buffer, SPECIES_CHARIZARD, 0, TRUE);
+    }
+    EXPECT_EQ(gSpriteCacheStats.hits, 1);
+    EXPECT_FASTER(hit, miss);
+
+    Free(buffer);
+}
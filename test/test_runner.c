@@ -5,17 +5,21 @@
 #include "main.h"
 #include "malloc.h"
 #include "random.h"
+#include "sprite_cache.h"
 #include "task.h"
 #include "constants/characters.h"
 #include "test_runner.h"
 #include "test/test.h"
 
 #define TIMEOUT_SECONDS 60
+#define TIMER2_TICKS (274 * 60) // Approx. 1 second.
 
 void CB2_TestRunner(void);
 
 EWRAM_DATA struct TestRunnerState gTestRunnerState;
 EWRAM_DATA struct FunctionTestRunnerState *gFunctionTestRunnerState;
+// Whether this run skips the VBlank waits, see T_HEADLESS_TURBO.
+EWRAM_DATA bool8 gTestRunnerTurbo = FALSE;
 
 enum {
     CURRENT_TEST_STATE_ESTIMATE,
@@ -82,28 +86,85 @@ static u32 MinCostProcess(void)
     return minCostProcess;
 }
 
-// Greedily assign tests to processes based on estimated cost.
+// FNV-1a, see also tools/mgba-rom-test-hydra/main.c
+static u32 HashTestName(const char *name)
+{
+    u32 hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (u8)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static const struct TestTiming *FindTestTiming(const char *name)
+{
+    u32 nameHash = HashTestName(name);
+    s32 lo = 0, hi = gTestRunnerTimingsCount;
+
+    while (lo < hi)
+    {
+        s32 mi = lo + (hi - lo) / 2;
+        if (nameHash < gTestRunnerTimings[mi].nameHash)
+            hi = mi;
+        else if (nameHash > gTestRunnerTimings[mi].nameHash)
+            lo = mi + 1;
+        else
+            return &gTestRunnerTimings[mi];
+    }
+    return NULL;
+}
+
+// Tests with a recorded timing have already been assigned by hydra,
+// longest first, so start from the load it gave each process.
+static void InitProcessCosts(void)
+{
+    u32 i;
+
+    memset(gTestRunnerState.processCosts, 0, sizeof(gTestRunnerState.processCosts));
+    for (i = 0; i < gTestRunnerTimingsCount; i++)
+    {
+        if (gTestRunnerTimings[i].runner < gTestRunnerN)
+            gTestRunnerState.processCosts[gTestRunnerTimings[i].runner] += gTestRunnerTimings[i].cost;
+    }
+}
+
+// Tests that hydra has timings for go to the process it chose, the
+// rest are greedily assigned to processes based on estimated cost,
+// scaled to the same units as the timings.
 // TODO: Make processCosts a min heap.
 static u32 AssignCostToRunner(void)
 {
     u32 minCostProcess;
+    const struct TestTiming *timing;
 
     if (gTestRunnerState.test->runner == &gAssumptionsRunner)
         return gTestRunnerI;
 
-    minCostProcess = MinCostProcess();
-
     // XXX: If estimateCost returns only on some processes, or
     // returns inconsistent results then processCosts will be
     // inconsistent and some tests may not run.
     if (gTestRunnerState.test->runner->estimateCost)
-        gTestRunnerState.processCosts[minCostProcess] += gTestRunnerState.test->runner->estimateCost(gTestRunnerState.test->data);
+        gTestRunnerState.estimatedCost = gTestRunnerState.test->runner->estimateCost(gTestRunnerState.test->data);
     else
-        gTestRunnerState.processCosts[minCostProcess] += 1;
+        gTestRunnerState.estimatedCost = 1;
+
+    timing = FindTestTiming(gTestRunnerState.test->name);
+    if (timing != NULL && timing->runner < gTestRunnerN)
+        return timing->runner;
+
+    minCostProcess = MinCostProcess();
+    gTestRunnerState.processCosts[minCostProcess] += gTestRunnerState.estimatedCost * gTestRunnerCostScale;
 
     return minCostProcess;
 }
 
+static u32 ElapsedTicks(void)
+{
+    return gTestRunnerState.timerInterrupts * TIMER2_TICKS + (u16)(REG_TM2CNT_L - (UINT16_MAX - TIMER2_TICKS));
+}
+
 void TestRunner_CheckMemory(void)
 {
     if (gTestRunnerState.result == TEST_RESULT_PASS
@@ -158,8 +219,32 @@ void TestRunner_CheckMemory(void)
             }
         }
     }
+
+#if T_HEAP_FRAGMENTATION_LIMIT
+    if (gTestRunnerState.result == TEST_RESULT_PASS
+     && gHeapStats.peakFragmentation > T_HEAP_FRAGMENTATION_LIMIT)
+    {
+        Test_MgbaPrintf(":L%s:%d - heap fragmentation peaked at %d%%, limit is %d%%", gTestRunnerState.test->filename, SourceLine(0), gHeapStats.peakFragmentation, T_HEAP_FRAGMENTATION_LIMIT);
+        gTestRunnerState.result = TEST_RESULT_FAIL;
+    }
+#endif
 }
 
+#if T_HEAP_PROFILE
+static void TestRunner_ReportHeapProfile(void)
+{
+    u32 i;
+
+    Test_MgbaPrintf(":H%d %d", gHeapStats.peakUsedBytes, HEAP_SIZE);
+    for (i = 0; i < HEAP_PROFILE_MAX_SITES; i++)
+    {
+        const struct HeapAllocSite *site = &gHeapAllocSites[i];
+        if (site->numAllocations != 0)
+            Test_MgbaPrintf(":S%d %d %d %d %s", site->numAllocations, site->totalBytes, site->peakLiveBytes, site->bytesAtPeak, site->location != NULL ? site->location : "<other>");
+    }
+}
+#endif
+
 void CB2_TestRunner(void)
 {
 top:
@@ -175,6 +260,7 @@ top:
         }
 
         MoveSaveBlocks_ResetHeap();
+        InitProcessCosts();
         ClearSav1();
         ClearSav2();
         ClearSav3();
@@ -246,10 +332,13 @@ top:
             gTestRunnerState.timeoutSeconds = TIMEOUT_SECONDS;
         else
             gTestRunnerState.timeoutSeconds = UINT_MAX;
+        gTestRunnerTurbo = T_HEADLESS_TURBO && gTestRunnerHeadless;
         InitHeap(gHeap, HEAP_SIZE);
         ResetTasks();
+        ResetSpriteCache();
         EnableInterrupts(INTR_FLAG_TIMER2);
-        REG_TM2CNT_L = UINT16_MAX - (274 * 60); // Approx. 1 second.
+        gTestRunnerState.timerInterrupts = 0;
+        REG_TM2CNT_L = UINT16_MAX - TIMER2_TICKS;
         REG_TM2CNT_H = TIMER_ENABLE | TIMER_INTR_ENABLE | TIMER_1024CLK;
 
         sCurrentTest.address = (uintptr_t)gTestRunnerState.test;
@@ -267,6 +356,7 @@ top:
     case STATE_RUN_TEST:
         gTestRunnerState.state = STATE_REPORT_RESULT;
         sCurrentTest.state = CURRENT_TEST_STATE_RUN;
+        gTestRunnerState.startTicks = ElapsedTicks();
         SeedRng(0);
         SeedRng2(0);
         if (gTestRunnerState.test->runner->setUp)
@@ -312,6 +402,14 @@ top:
             const char *color;
             const char *result;
 
+            // Timings for the next run, in 1024 cycle ticks.
+            if (gTestRunnerState.result != TEST_RESULT_CRASH)
+                Test_MgbaPrintf(":C%d %d %s", ElapsedTicks() - gTestRunnerState.startTicks, gTestRunnerState.estimatedCost, gTestRunnerState.test->name);
+
+#if T_HEAP_PROFILE
+            TestRunner_ReportHeapProfile();
+#endif
+
             if (gTestRunnerState.result == gTestRunnerState.expectedResult
              || (gTestRunnerState.result == TEST_RESULT_FAIL
               && gTestRunnerState.expectedResult == TEST_RESULT_KNOWN_FAIL))
@@ -505,6 +603,7 @@ void ReinitCallbacks(void)
 
 static void Intr_Timer2(void)
 {
+    gTestRunnerState.timerInterrupts++;
     if (--gTestRunnerState.timeoutSeconds == 0)
     {
         if (gTestRunnerState.test->runner->checkProgress
@@ -1,5 +1,6 @@
 #include "global.h"
 #include "battle.h"
+#include "battle_ai_main.h"
 #include "battle_ai_util.h"
 #include "battle_anim.h"
 #include "battle_controllers.h"
@@ -879,6 +880,24 @@ void TestRunner_Battle_InvalidNoHPMon(u32 battlerId, u32 partyIndex)
                         gTestRunnerState.test->filename, BattlerIdentifier(battlerId), gBattlerPartyIndexes[battlerId]);
 }
 
+void TestRunner_Battle_AiDamageCacheMismatch(u32 battlerAtk, u32 battlerDef, u32 move)
+{
+    Test_ExitWithResult(TEST_RESULT_FAIL, SourceLine(0), ":L%s: AI damage of %s using %S on %s from the cache differs from working it out again.",
+                        gTestRunnerState.test->filename, BattlerIdentifier(battlerAtk), GetMoveName(move), BattlerIdentifier(battlerDef));
+}
+
+// Benchmarks measure the cache on its own, see T_BATTLER_EFFECT_CACHE_VERIFY.
+bool32 TestRunner_Battle_VerifiesBattlerEffectCache(void)
+{
+    return T_BATTLER_EFFECT_CACHE_VERIFY && !gTestRunnerState.inBenchmark;
+}
+
+void TestRunner_Battle_BattlerEffectCacheMismatch(u32 battlerId)
+{
+    Test_ExitWithResult(TEST_RESULT_FAIL, SourceLine(0), ":L%s: Ability or hold effect of %s from the cache differs from working it out again.",
+                        gTestRunnerState.test->filename, BattlerIdentifier(battlerId));
+}
+
 static bool32 CheckComparision(s32 val1, s32 val2, u32 cmp)
 {
     switch (cmp)
@@ -1891,6 +1910,17 @@ static void PushBattlerAction(u32 sourceLine, s32 battlerId, u32 actionType, u32
     DATA.recordedBattle.battleRecord[battlerId][recordIndex] = byte;
 }
 
+// Every AI battler has to decide before any action is taken, see
+// HandleTurnActionSelectionState.
+void TestRunner_Battle_CheckActionTaken(u32 battlerId)
+{
+    if (!IsAiLogicDataForTurnFinished())
+    {
+        const char *filename = gTestRunnerState.test->filename;
+        Test_ExitWithResult(TEST_RESULT_FAIL, SourceLine(0), ":L%s:%d: %s's action taken before the AI damage simulation finished", filename, SourceLine(0), BattlerIdentifier(battlerId));
+    }
+}
+
 void TestRunner_Battle_CheckBattleRecordActionType(u32 battlerId, u32 recordIndex, u32 actionType)
 {
     // An illegal move choice will cause the battle to request a new
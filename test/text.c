@@ -4,11 +4,13 @@
 #include "battle_main.h"
 #include "battle_message.h"
 #include "battle_setup.h"
+#include "bg.h"
 #include "item.h"
 #include "malloc.h"
 #include "main_menu.h"
 #include "string_util.h"
 #include "text.h"
+#include "window.h"
 #include "constants/abilities.h"
 #include "constants/battle.h"
 #include "constants/battle_string_ids.h"
@@ -828,3 +830,152 @@ TEST("Battle strings fit on the battle message window")
     Free(battleString);
 }
 //*/
+
+static const struct BgTemplate sTextBgTemplate =
+{
+    .bg = 0,
+    .charBaseIndex = 0,
+    .mapBaseIndex = 31,
+    .priority = 0,
+};
+
+static const struct WindowTemplate sTextWindowTemplates[] =
+{
+    {
+        .bg = 0,
+        .tilemapLeft = 1,
+        .tilemapTop = 1,
+        .width = 28,
+        .height = 18,
+        .paletteNum = 15,
+        .baseBlock = 1,
+    },
+    DUMMY_WIN_TEMPLATE,
+};
+
+static const u8 sMenuPageText[] = _(
+    "POKéDEX\n"
+    "POKéMON\n"
+    "BAG\n"
+    "PLAYER\n"
+    "SAVE\n"
+    "OPTION\n"
+    "EXIT\n"
+    "Check the POKéMON in your party.");
+
+static void PrintMenuPage(u8 fontId)
+{
+    FillWindowPixelBuffer(0, PIXEL_FILL(1));
+    AddTextPrinterParameterized(0, fontId, sMenuPageText, 0, 1, TEXT_SKIP_DRAW, NULL);
+}
+
+TEST("Glyph cache draws the same text as decompressing every glyph")
+{
+    u8 *uncached = Alloc(28 * 18 * TILE_SIZE_4BPP);
+    u32 fontId = 0;
+
+    ASSUME(GLYPH_CACHE_SLOTS > 0);
+    PARAMETRIZE { fontId = FONT_NORMAL; }
+    PARAMETRIZE { fontId = FONT_SMALL; }
+    PARAMETRIZE { fontId = FONT_NARROW; }
+    InitBgsFromTemplates(0, &sTextBgTemplate, 1);
+    InitWindows(sTextWindowTemplates);
+
+    ResetGlyphCache();
+    PrintMenuPage(fontId);
+    memcpy(uncached, gWindows[0].tileData, 28 * 18 * TILE_SIZE_4BPP);
+    PrintMenuPage(fontId);
+
+    EXPECT_GT(gGlyphCacheStats.hits, gGlyphCacheStats.misses);
+    EXPECT(memcmp(uncached, gWindows[0].tileData, 28 * 18 * TILE_SIZE_4BPP) == 0);
+
+    FreeAllWindowBuffers();
+    Free(uncached);
+}
+
+TEST("Glyph cache speeds up printing a menu page")
+{
+    struct Benchmark cold, warm;
+
+    ASSUME(GLYPH_CACHE_SLOTS > 0);
+    InitBgsFromTemplates(0, &sTextBgTemplate, 1);
+    InitWindows(sTextWindowTemplates);
+
+    ResetGlyphCache();
+    BENCHMARK(&cold)
+        PrintMenuPage(FONT_NORMAL);
+    BENCHMARK(&warm)
+        PrintMenuPage(FONT_NORMAL);
+    EXPECT_FASTER(warm, cold);
+
+    FreeAllWindowBuffers();
+}
+
+// Prints the same text one character at a time, as a text printer with a
+// speed does.
+static void PrintMenuPageSlowly(u8 fontId)
+{
+    FillWindowPixelBuffer(0, PIXEL_FILL(1));
+    AddTextPrinterParameterized(0, fontId, sMenuPageText, 3, 1, 1, NULL);
+    while (IsTextPrinterActive(0))
+        RunTextPrinters();
+}
+
+TEST("Printing text instantly draws the same text as printing it slowly")
+{
+    u8 *slow = Alloc(28 * 18 * TILE_SIZE_4BPP);
+    u32 fontId = 0;
+
+    PARAMETRIZE { fontId = FONT_NORMAL; }
+    PARAMETRIZE { fontId = FONT_SMALL; }
+    PARAMETRIZE { fontId = FONT_NARROW; }
+    PARAMETRIZE { fontId = FONT_MALE; }
+    InitBgsFromTemplates(0, &sTextBgTemplate, 1);
+    InitWindows(sTextWindowTemplates);
+
+    PrintMenuPageSlowly(fontId);
+    memcpy(slow, gWindows[0].tileData, 28 * 18 * TILE_SIZE_4BPP);
+    FillWindowPixelBuffer(0, PIXEL_FILL(1));
+    AddTextPrinterParameterized(0, fontId, sMenuPageText, 3, 1, TEXT_SKIP_DRAW, NULL);
+
+    EXPECT(memcmp(slow, gWindows[0].tileData, 28 * 18 * TILE_SIZE_4BPP) == 0);
+
+    FreeAllWindowBuffers();
+    Free(slow);
+}
+
+TEST("Printing text instantly is faster than one character at a time")
+{
+    u8 text[3 + 100 + 4 + 1];
+    struct Benchmark instant, oneAtATime;
+    u32 i, j, fontId = 0;
+
+    PARAMETRIZE { fontId = FONT_NORMAL; }
+    PARAMETRIZE { fontId = FONT_SMALL; }
+    PARAMETRIZE { fontId = FONT_NARROW; }
+    PARAMETRIZE { fontId = FONT_MALE; }
+    InitBgsFromTemplates(0, &sTextBgTemplate, 1);
+    InitWindows(sTextWindowTemplates);
+
+    // A pause, which only the state machine handles, then 100 glyphs.
+    text[0] = EXT_CTRL_CODE_BEGIN;
+    text[1] = EXT_CTRL_CODE_PAUSE;
+    text[2] = 0;
+    for (i = 0, j = 3; i < 100; i++)
+    {
+        text[j++] = CHAR_a + i % 26;
+        if (i % 25 == 24)
+            text[j++] = CHAR_NEWLINE;
+    }
+    text[j] = EOS;
+
+    ResetGlyphCache();
+    AddTextPrinterParameterized(0, fontId, &text[3], 0, 1, TEXT_SKIP_DRAW, NULL);
+    BENCHMARK(&instant)
+        AddTextPrinterParameterized(0, fontId, &text[3], 0, 1, TEXT_SKIP_DRAW, NULL);
+    BENCHMARK(&oneAtATime)
+        AddTextPrinterParameterized(0, fontId, text, 0, 1, TEXT_SKIP_DRAW, NULL);
+    EXPECT_FASTER(instant, oneAtATime);
+
+    FreeAllWindowBuffers();
+}
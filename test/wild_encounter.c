@@ -0,0 +1,58 @@
+#include "global.h"
+#include "event_data.h"
+#include "wild_encounter.h"
+#include "test/test.h"
+#include "constants/maps.h"
+
+TEST("GetCurrentMapWildMonHeaderId finds the first header of the current map")
+{
+    u32 i, j, headerId = 0;
+
+    for (i = 0; gWildMonHeaders[i].mapGroup != MAP_GROUP(MAP_UNDEFINED); i++)
+    {
+        PARAMETRIZE { headerId = i; }
+    }
+
+    gSaveBlock1Ptr->location.mapGroup = gWildMonHeaders[headerId].mapGroup;
+    gSaveBlock1Ptr->location.mapNum = gWildMonHeaders[headerId].mapNum;
+    FlagSet(FLAG_SYS_UNLOCKED_TANOBY_RUINS);
+    VarSet(VAR_ALTERING_CAVE_WILD_SET, 0);
+
+    for (j = 0; j < headerId; j++)
+    {
+        if (gWildMonHeaders[j].mapGroup == gWildMonHeaders[headerId].mapGroup
+         && gWildMonHeaders[j].mapNum == gWildMonHeaders[headerId].mapNum)
+            break;
+    }
+    EXPECT_EQ(GetCurrentMapWildMonHeaderId(), j);
+}
+
+TEST("GetCurrentMapWildMonHeaderId uses the Altering Cave header of VAR_ALTERING_CAVE_WILD_SET")
+{
+    u32 alteringCaveId;
+    u16 firstHeaderId;
+
+    gSaveBlock1Ptr->location.mapGroup = MAP_GROUP(MAP_SIX_ISLAND_ALTERING_CAVE);
+    gSaveBlock1Ptr->location.mapNum = MAP_NUM(MAP_SIX_ISLAND_ALTERING_CAVE);
+    VarSet(VAR_ALTERING_CAVE_WILD_SET, 0);
+    firstHeaderId = GetCurrentMapWildMonHeaderId();
+
+    for (alteringCaveId = 0; alteringCaveId < NUM_ALTERING_CAVE_TABLES; alteringCaveId++)
+    {
+        VarSet(VAR_ALTERING_CAVE_WILD_SET, alteringCaveId);
+        EXPECT_EQ(GetCurrentMapWildMonHeaderId(), firstHeaderId + alteringCaveId);
+    }
+    VarSet(VAR_ALTERING_CAVE_WILD_SET, NUM_ALTERING_CAVE_TABLES);
+    EXPECT_EQ(GetCurrentMapWildMonHeaderId(), firstHeaderId);
+}
+
+TEST("GetCurrentMapWildMonHeaderId has no header in Tanoby Ruins chambers until they are unlocked")
+{
+    gSaveBlock1Ptr->location.mapGroup = MAP_GROUP(MAP_SEVEN_ISLAND_TANOBY_RUINS_MONEAN_CHAMBER);
+    gSaveBlock1Ptr->location.mapNum = MAP_NUM(MAP_SEVEN_ISLAND_TANOBY_RUINS_MONEAN_CHAMBER);
+
+    FlagClear(FLAG_SYS_UNLOCKED_TANOBY_RUINS);
+    EXPECT_EQ(GetCurrentMapWildMonHeaderId(), HEADER_NONE);
+    FlagSet(FLAG_SYS_UNLOCKED_TANOBY_RUINS);
+    EXPECT_NE(GetCurrentMapWildMonHeaderId(), HEADER_NONE);
+}
@@ -0,0 +1,266 @@
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include "assetCache.h"
+
+#define FNV_OFFSET_BASIS    0xcbf29ce484222325ULL
+#define FNV_PRIME           0x100000001b3ULL
+
+static unsigned long long hashBytes(unsigned long long hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static unsigned long long hashFile(unsigned long long hash, std::string filePath)
+{
+    std::ifstream iStream(filePath, std::ios::binary);
+    if (!iStream.is_open())
+        return hash;
+    std::vector<char> buffer(4096);
+    while (iStream.read(buffer.data(), buffer.size()) || iStream.gcount() != 0)
+        hash = hashBytes(hash, buffer.data(), iStream.gcount());
+    return hash;
+}
+
+static bool isCacheEntryName(std::string name)
+{
+    if (name.size() != ASSET_CACHE_KEY_LENGTH)
+        return false;
+    return name.find_first_not_of("0123456789abcdef") == std::string::npos;
+}
+
+//  The cache keeps a few running totals in small text files next to the entries:
+//  the total size of the entries in "size", and the hits and misses of each tool
+//  in "stats-<tool>". Returns false if the file is missing or unreadable
+static bool readCounters(std::filesystem::path path, std::vector<long long> *pValues)
+{
+    std::ifstream iStream(path);
+    for (long long &value : *pValues)
+    {
+        if (!(iStream >> value))
+        {
+            std::fill(pValues->begin(), pValues->end(), 0);
+            return false;
+        }
+    }
+    return true;
+}
+
+//  Replaced through a rename so that a parallel reader never sees a partial file.
+//  Two processes updating a file at the same time can lose one of the updates,
+//  so the totals are estimates. Eviction rescans the directory and corrects the size
+static void writeCounters(std::filesystem::path path, const std::vector<long long> &values)
+{
+    std::filesystem::path tempPath = path;
+    tempPath += "." + std::to_string(std::random_device()()) + ".tmp";
+    {
+        std::ofstream fileOut(tempPath, std::ios::out | std::ios::binary);
+        if (!fileOut.is_open())
+            return;
+        for (long long value : values)
+            fileOut << value << "\n";
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, path, error);
+    if (error)
+        std::filesystem::remove(tempPath, error);
+}
+
+static unsigned long long hashTool(std::string toolPath)
+{
+    unsigned long long hash = hashFile(FNV_OFFSET_BASIS, "/proc/self/exe");
+    if (hash == FNV_OFFSET_BASIS)
+        hash = hashFile(FNV_OFFSET_BASIS, toolPath);
+    return hash;
+}
+
+AssetCache::AssetCache(std::string toolPath, InputSettings settings, std::vector<unsigned char> *pInput)
+{
+    const char *dir = getenv("ASSET_CACHE_DIR");
+    const char *size = getenv("ASSET_CACHE_SIZE");
+    if (dir == nullptr || *dir == 0)
+        return;
+
+    std::error_code error;
+    cacheDir = dir;
+    std::filesystem::create_directories(cacheDir, error);
+    maxSize = (unsigned long long)ASSET_CACHE_DEFAULT_SIZE_MB << 20;
+    if (size != nullptr && atoll(size) > 0)
+        maxSize = (unsigned long long)atoll(size) << 20;
+
+    //  Hashing the binary itself means any rebuild of compresSmol invalidates old entries.
+    //  The match finder isn't part of the key, every finder produces the same output.
+    //  Batch mode makes one AssetCache per asset, so the binary is only hashed once per process.
+    static const unsigned long long toolHash = hashTool(toolPath);
+    unsigned long long key = toolHash;
+    bool settingValues[] = {settings.canEncodeLO, settings.canEncodeSyms, settings.canDeltaSyms, settings.useFrames, settings.useOptimalParse};
+    key = hashBytes(key, settingValues, sizeof(settingValues));
+    size_t inputSize = pInput->size();
+    key = hashBytes(key, &inputSize, sizeof(inputSize));
+    key = hashBytes(key, pInput->data(), inputSize);
+
+    char name[ASSET_CACHE_KEY_LENGTH + 1];
+    snprintf(name, sizeof(name), "%016llx", key);
+    entryPath = cacheDir / name;
+    enabled = true;
+}
+
+bool AssetCache::isEnabled()
+{
+    return enabled;
+}
+
+void AssetCache::recordEvent(char event)
+{
+    std::vector<long long> counts(2); //  Hits, misses
+    readCounters(cacheDir / "stats-compresSmol", &counts);
+    counts[event == 'H' ? 0 : 1]++;
+    writeCounters(cacheDir / "stats-compresSmol", counts);
+}
+
+bool AssetCache::read(std::vector<unsigned int> *pOutput)
+{
+    if (!enabled)
+        return false;
+    std::ifstream iStream(entryPath, std::ios::binary);
+    if (!iStream.is_open())
+    {
+        recordEvent('M');
+        return false;
+    }
+    std::vector<unsigned char> ucVec((std::istreambuf_iterator<char>(iStream)), std::istreambuf_iterator<char>());
+    if (ucVec.size() % 4 != 0)
+    {
+        recordEvent('M');
+        return false;
+    }
+    pOutput->resize(ucVec.size()/4);
+    memcpy(pOutput->data(), ucVec.data(), ucVec.size());
+
+    //  Refresh the modification time, which eviction uses as the last use time
+    std::error_code error;
+    std::filesystem::last_write_time(entryPath, std::filesystem::file_time_type::clock::now(), error);
+    recordEvent('H');
+    return true;
+}
+
+void AssetCache::write(std::vector<unsigned int> *pData)
+{
+    if (!enabled)
+        return;
+    //  Write to a temporary file first so that a parallel reader never sees a partial entry
+    std::filesystem::path tempPath = entryPath;
+    tempPath += "." + std::to_string(std::random_device()()) + ".tmp";
+    {
+        std::ofstream fileOut(tempPath, std::ios::out | std::ios::binary);
+        if (!fileOut.is_open())
+            return;
+        fileOut.write(reinterpret_cast<const char *>(pData->data()), pData->size()*4);
+    }
+    std::error_code error;
+    unsigned long long oldSize = std::filesystem::file_size(entryPath, error);
+    if (error)
+        oldSize = 0;
+    std::filesystem::rename(tempPath, entryPath, error);
+    if (error)
+    {
+        std::filesystem::remove(tempPath, error);
+        return;
+    }
+    updateSize((long long)(pData->size()*4) - (long long)oldSize);
+}
+
+//  Adds an entry that changed size by sizeChange to the running total, and only
+//  scans the directory when the total goes over the budget, or when there is no
+//  total yet
+void AssetCache::updateSize(long long sizeChange)
+{
+    std::vector<long long> totalSize(1);
+    if (!readCounters(cacheDir / "size", &totalSize))
+        return evict();
+    totalSize[0] += sizeChange;
+    if (totalSize[0] > (long long)maxSize)
+        return evict();
+    writeCounters(cacheDir / "size", totalSize);
+}
+
+//  Removes the least recently used entries until the cache is below 3/4 of
+//  its budget, so that the next scan is a while away, and stores the size
+//  that is left
+void AssetCache::evict()
+{
+    struct Entry {
+        std::filesystem::path path;
+        unsigned long long size;
+        std::filesystem::file_time_type lastUsed;
+    };
+    std::vector<Entry> entries;
+    unsigned long long totalSize = 0;
+    std::error_code error;
+    for (const std::filesystem::directory_entry &dirEntry : std::filesystem::directory_iterator(cacheDir, error))
+    {
+        if (!dirEntry.is_regular_file(error) || !isCacheEntryName(dirEntry.path().filename().string()))
+            continue;
+        Entry entry;
+        entry.path = dirEntry.path();
+        entry.size = dirEntry.file_size(error);
+        entry.lastUsed = dirEntry.last_write_time(error);
+        totalSize += entry.size;
+        entries.push_back(entry);
+    }
+    if (totalSize <= maxSize)
+    {
+        writeCounters(cacheDir / "size", {(long long)totalSize});
+        return;
+    }
+    std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+        return a.lastUsed < b.lastUsed;
+    });
+    for (Entry entry : entries)
+    {
+        if (totalSize <= maxSize / 4 * 3)
+            break;
+        if (std::filesystem::remove(entry.path, error))
+            totalSize -= entry.size;
+    }
+    writeCounters(cacheDir / "size", {(long long)totalSize});
+}
+
+void printAssetCacheStats()
+{
+    const char *dir = getenv("ASSET_CACHE_DIR");
+    if (dir == nullptr || *dir == 0)
+    {
+        printf("ASSET_CACHE_DIR is not set, the asset cache is disabled.\n");
+        return;
+    }
+    std::filesystem::path cacheDir = dir;
+    std::vector<long long> counts(2); //  Hits, misses
+    readCounters(cacheDir / "stats-compresSmol", &counts);
+    size_t hits = counts[0];
+    size_t misses = counts[1];
+    size_t numEntries = 0;
+    unsigned long long totalSize = 0;
+    std::error_code error;
+    for (const std::filesystem::directory_entry &dirEntry : std::filesystem::directory_iterator(cacheDir, error))
+    {
+        if (!dirEntry.is_regular_file(error) || !isCacheEntryName(dirEntry.path().filename().string()))
+            continue;
+        numEntries++;
+        totalSize += dirEntry.file_size(error);
+    }
+    size_t lookups = hits + misses;
+    printf("Cache directory: %s\n", dir);
+    printf("compresSmol hits: %zu\n", hits);
+    printf("compresSmol misses: %zu\n", misses);
+    printf("compresSmol hit rate: %.1f%%\n", lookups == 0 ? 0.0 : 100.0 * hits / lookups);
+    printf("Entries: %zu\n", numEntries);
+    printf("Total size: %llu bytes\n", totalSize);
+}
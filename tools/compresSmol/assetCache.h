@@ -0,0 +1,31 @@
+#ifndef ASSET_CACHE
+#define ASSET_CACHE
+#include <stdio.h>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "compressAlgo.h"
+
+//  Compressed outputs are cached in ASSET_CACHE_DIR, keyed by a hash of the
+//  compresSmol binary, the InputSettings and the input data.
+//  The cache is disabled when ASSET_CACHE_DIR is not set.
+#define ASSET_CACHE_DEFAULT_SIZE_MB     512
+#define ASSET_CACHE_KEY_LENGTH          16
+
+class AssetCache {
+    bool enabled = false;
+    std::filesystem::path cacheDir;
+    std::filesystem::path entryPath;
+    unsigned long long maxSize = 0;
+    void recordEvent(char event);
+    void updateSize(long long sizeChange);
+    void evict();
+public:
+    AssetCache(std::string toolPath, InputSettings settings, std::vector<unsigned char> *pInput);
+    bool isEnabled();
+    bool read(std::vector<unsigned int> *pOutput);
+    void write(std::vector<unsigned int> *pData);
+};
+
+void printAssetCacheStats();
+#endif
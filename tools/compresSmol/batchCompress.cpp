@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+#include "batchCompress.h"
+#include "assetCache.h"
+
+WorkStealingQueues::WorkStealingQueues(size_t numWorkers) : queues(numWorkers) {}
+
+void WorkStealingQueues::push(size_t worker, size_t job)
+{
+    std::lock_guard<std::mutex> lock(queues[worker].queueMutex);
+    queues[worker].jobs.push_back(job);
+}
+
+bool WorkStealingQueues::pop(size_t worker, size_t *pJob)
+{
+    {
+        std::lock_guard<std::mutex> lock(queues[worker].queueMutex);
+        if (!queues[worker].jobs.empty())
+        {
+            *pJob = queues[worker].jobs.front();
+            queues[worker].jobs.pop_front();
+            return true;
+        }
+    }
+    for (size_t i = 1; i < queues.size(); i++)
+    {
+        WorkerQueue &victim = queues[(worker + i) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.queueMutex);
+        if (!victim.jobs.empty())
+        {
+            *pJob = victim.jobs.back();
+            victim.jobs.pop_back();
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool parseSetting(std::string value, bool *pSetting)
+{
+    if (value.compare("true") == 0)
+        *pSetting = true;
+    else if (value.compare("false") == 0)
+        *pSetting = false;
+    else
+        return false;
+    return true;
+}
+
+/*
+    Every non-empty line of the manifest that doesn't start with # is one file:
+        <w|fw> <input> <output> [<canEncodeLO> <canEncodeSyms> <canDeltaSyms>]
+    w and fw match the -w and -fw modes, the settings are true or false.
+*/
+bool readBatchManifest(std::string manifestPath, InputSettings baseSettings, std::vector<BatchJob> *pJobs)
+{
+    std::ifstream manifest(manifestPath);
+    if (!manifest.is_open())
+    {
+        fprintf(stderr, "Error: Couldn't open manifest %s\n", manifestPath.c_str());
+        return false;
+    }
+    std::string line;
+    size_t lineNum = 0;
+    while (std::getline(manifest, line))
+    {
+        lineNum++;
+        std::istringstream lineStream(line);
+        std::vector<std::string> fields;
+        std::string field;
+        while (lineStream >> field)
+            fields.push_back(field);
+        if (fields.size() == 0 || fields[0][0] == '#')
+            continue;
+        if ((fields.size() != 3 && fields.size() != 6)
+         || (fields[0].compare("w") != 0 && fields[0].compare("fw") != 0))
+        {
+            fprintf(stderr, "%s:%zu: Expected \"<w|fw> <input> <output> [<true|false> x3]\"\n", manifestPath.c_str(), lineNum);
+            return false;
+        }
+        BatchJob job;
+        job.input = fields[1];
+        job.output = fields[2];
+        job.settings = baseSettings;
+        job.settings.useFrames = fields[0].compare("fw") == 0;
+        if (fields.size() == 6
+         && (!parseSetting(fields[3], &job.settings.canEncodeLO)
+          || !parseSetting(fields[4], &job.settings.canEncodeSyms)
+          || !parseSetting(fields[5], &job.settings.canDeltaSyms)))
+        {
+            fprintf(stderr, "%s:%zu: Settings must be true or false\n", manifestPath.c_str(), lineNum);
+            return false;
+        }
+        pJobs->push_back(job);
+    }
+    return true;
+}
+
+static bool isUpToDate(BatchJob *pJob)
+{
+    std::error_code error;
+    if (!std::filesystem::exists(pJob->output, error))
+        return false;
+    std::filesystem::file_time_type inputTime = std::filesystem::last_write_time(pJob->input, error);
+    if (error)
+        return false;
+    std::filesystem::file_time_type outputTime = std::filesystem::last_write_time(pJob->output, error);
+    if (error)
+        return false;
+    return outputTime >= inputTime;
+}
+
+static void batchWorker(size_t worker, WorkStealingQueues *pQueues, std::vector<BatchJob> *pJobs, BatchResults *pResults, std::string toolPath)
+{
+    size_t jobIndex;
+    while (pQueues->pop(worker, &jobIndex))
+    {
+        BatchJob *pJob = &(*pJobs)[jobIndex];
+        if (isUpToDate(pJob))
+        {
+            pResults->numSkipped++;
+            continue;
+        }
+        if (compressFile(pJob->input, pJob->output, pJob->settings, toolPath))
+        {
+            pResults->numCompressed++;
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(pResults->failMutex);
+            pResults->failedFiles.push_back(pJob->input);
+        }
+    }
+}
+
+bool runBatch(std::vector<BatchJob> *pJobs, size_t numThreads, std::string toolPath)
+{
+    if (numThreads == 0)
+        numThreads = 1;
+
+    //  Deal the largest files out first so that every queue starts with a similar amount of work
+    std::vector<std::pair<size_t, size_t>> jobSizes;
+    for (size_t i = 0; i < pJobs->size(); i++)
+    {
+        std::error_code error;
+        size_t size = std::filesystem::file_size((*pJobs)[i].input, error);
+        jobSizes.push_back(std::make_pair(error ? 0 : size, i));
+    }
+    std::stable_sort(jobSizes.begin(), jobSizes.end(), [](const std::pair<size_t, size_t> &a, const std::pair<size_t, size_t> &b) {
+        return a.first > b.first;
+    });
+    WorkStealingQueues queues(numThreads);
+    for (size_t i = 0; i < jobSizes.size(); i++)
+        queues.push(i % numThreads, jobSizes[i].second);
+
+    BatchResults results;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++)
+        threads.emplace_back(batchWorker, i, &queues, pJobs, &results, toolPath);
+    for (size_t i = 0; i < numThreads; i++)
+        threads[i].join();
+
+    fprintf(stderr, "Compressed: %zu, Up to date: %zu, Failed: %zu\n",
+            results.numCompressed.load(), results.numSkipped.load(), results.failedFiles.size());
+    return results.failedFiles.size() == 0;
+}
+
+bool compressFile(std::string input, std::string output, InputSettings settings, std::string toolPath)
+{
+    if (!std::filesystem::exists(input))
+    {
+        fprintf(stderr, "Input file %s doesn't exist\n", input.c_str());
+        return false;
+    }
+    std::vector<unsigned char> inputData = readFileAsUC(input);
+    AssetCache cache(toolPath, settings, &inputData);
+    CompressedImage image;
+    if (cache.read(&image.writeVec))
+    {
+        image.isValid = true;
+    }
+    else
+    {
+        if (settings.useFrames)
+            image = processImageFrames(input, settings);
+        else
+            image = processImage(input, settings);
+        if (image.isValid)
+            cache.write(&image.writeVec);
+    }
+    if (!image.isValid)
+    {
+        fprintf(stderr, "Failed to compress image %s\n", input.c_str());
+        return false;
+    }
+    return writeFileAtomic(output, &image.writeVec);
+}
+
+//  Writes to a temporary file next to the output and renames it over the output,
+//  so an interrupted build never leaves a truncated file that looks up to date
+bool writeFileAtomic(std::string output, std::vector<unsigned int> *pData)
+{
+    std::string tempPath = output + "." + std::to_string(std::random_device()()) + ".tmp";
+    {
+        std::ofstream fileOut(tempPath, std::ios::out | std::ios::binary);
+        if (!fileOut.is_open())
+        {
+            fprintf(stderr, "Error: Couldn't open %s for writing\n", tempPath.c_str());
+            return false;
+        }
+        fileOut.write(reinterpret_cast<const char *>(pData->data()), pData->size()*4);
+        if (!fileOut)
+        {
+            fprintf(stderr, "Error: Couldn't write %s\n", tempPath.c_str());
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(tempPath, output, error);
+    if (error)
+    {
+        fprintf(stderr, "Error: Couldn't rename %s to %s\n", tempPath.c_str(), output.c_str());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+    return true;
+}
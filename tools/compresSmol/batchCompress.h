@@ -0,0 +1,43 @@
+#ifndef BATCH_COMPRESS
+#define BATCH_COMPRESS
+#include <stdio.h>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "compressAlgo.h"
+
+struct BatchJob {
+    std::string input;
+    std::string output;
+    InputSettings settings;
+};
+
+//  Every worker owns a queue and takes jobs from its front,
+//  when it runs dry it steals from the back of the other queues
+class WorkStealingQueues {
+    struct WorkerQueue {
+        std::deque<size_t> jobs;
+        std::mutex queueMutex;
+    };
+    std::vector<WorkerQueue> queues;
+public:
+    WorkStealingQueues(size_t numWorkers);
+    void push(size_t worker, size_t job);
+    bool pop(size_t worker, size_t *pJob);
+};
+
+struct BatchResults {
+    std::atomic<size_t> numCompressed{0};
+    std::atomic<size_t> numSkipped{0};
+    std::vector<std::string> failedFiles;
+    std::mutex failMutex;
+};
+
+bool readBatchManifest(std::string manifestPath, InputSettings baseSettings, std::vector<BatchJob> *pJobs);
+bool runBatch(std::vector<BatchJob> *pJobs, size_t numThreads, std::string toolPath);
+
+bool compressFile(std::string input, std::string output, InputSettings settings, std::string toolPath);
+bool writeFileAtomic(std::string output, std::vector<unsigned int> *pData);
+#endif
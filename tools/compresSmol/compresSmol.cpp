@@ -6,6 +6,9 @@
 #include <algorithm>
 #include "fileDispatcher.h"
 #include "compressAlgo.h"
+#include "matchFinder.h"
+#include "assetCache.h"
+#include "batchCompress.h"
 
 struct ThingCount {
     size_t number = 0;
@@ -22,6 +25,9 @@ enum Option {
     WRITE,
     FRAME_WRITE,
     DECODE,
+    VERIFY,
+    CACHE_STATS,
+    BATCH,
     USAGE,
 };
 
@@ -34,6 +40,30 @@ int main(int argc, char *argv[])
     int numThreads = 1;
     InputSettings settings(true, true, true);
 
+    //  The match finder and parser can be chosen in any mode, so strip them from the arguments first
+    for (int i = 1; i < argc; i++)
+    {
+        std::string argument = argv[i];
+        int numArgs = 0;
+        if (argument.compare("-m") == 0 && i + 1 < argc)
+        {
+            if (!parseMatchFinder(argv[i + 1], &settings.matchFinder))
+                fprintf(stderr, "Unrecognized match finder \"%s\", defaulting to \"hash\"\n", argv[i + 1]);
+            numArgs = 2;
+        }
+        else if (argument.compare("-opt") == 0)
+        {
+            settings.useOptimalParse = true;
+            numArgs = 1;
+        }
+        if (numArgs == 0)
+            continue;
+        for (int j = i; j + numArgs < argc; j++)
+            argv[j] = argv[j + numArgs];
+        argc -= numArgs;
+        i--;
+    }
+
     if (argc > 1)
     {
         std::string argument = argv[1];
@@ -45,6 +75,12 @@ int main(int argc, char *argv[])
             option = FRAME_WRITE;
         else if (argument.compare("-d") == 0)
             option = DECODE;
+        else if (argument.compare("-v") == 0)
+            option = VERIFY;
+        else if (argument.compare("-cs") == 0)
+            option = CACHE_STATS;
+        else if (argument.compare("-b") == 0)
+            option = BATCH;
     }
     switch (option)
     {
@@ -134,6 +170,22 @@ int main(int argc, char *argv[])
                 printUsage = true;
             }
             break;
+        case BATCH:
+        case VERIFY:
+            if (argc > 2)
+                input = argv[2];
+            else
+                printUsage = true;
+            if (argc > 4)
+            {
+                std::string arg2 = argv[3];
+                std::string arg2arg = argv[4];
+                if (arg2.compare("-t") == 0 && isNumber(arg2arg))
+                    numThreads = std::stoi(arg2arg.c_str());
+            }
+            break;
+        case CACHE_STATS:
+            break;
         case USAGE:
             printUsage = true;
             break;
@@ -153,7 +205,25 @@ int main(int argc, char *argv[])
                     - If the compression instructions can be delta encoded.\n\
                     - If the raw symbols in the compression ca be delta encoded.\n\
                 %s -d \"path/to/some/file.4bpp.smol\" \"path/to/some/file.4bpp\"\n\
-                    Decompresses the first argument and writes it to the second argument.", argv[0], argv[0], argv[0]);
+                    Decompresses the first argument and writes it to the second argument.\n\
+                %s -v \"path/to/some/directory\"\n\
+                    Compresses every .4bpp file in the directory, checks that the selected match finder\n\
+                    finds the same copies as the brute force search and that every image decodes back to its input.\n\
+                    -t <number> can be appended to this mode to specify how many threads to use.\n\
+                \n\
+                %s -b \"path/to/manifest.txt\"\n\
+                    Compresses every file listed in the manifest in a single process and skips outputs that are up to date.\n\
+                    Each line is \"<w|fw> <input> <output>\", optionally followed by the 3 true/false settings.\n\
+                    -t <number> can be appended to this mode to specify how many threads to use.\n\
+                \n\
+                %s -cs\n\
+                    Prints the hit/miss statistics of the compressed asset cache.\n\
+                \n\
+                -m <brute|hash> can be added to any mode to select the match finder, defaults to hash.\n\
+                -opt can be added to any mode to also search for the instructions with the lowest estimated\n\
+                tANS coded size, the result is only used if it is smaller than the greedy one.\n\
+                Setting ASSET_CACHE_DIR makes -w and -fw reuse earlier outputs for identical inputs,\n\
+                ASSET_CACHE_SIZE sets the cache budget in MiB.", argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
 
         return 0;
     }
@@ -185,6 +255,7 @@ int main(int argc, char *argv[])
             threads[i].join();
 
         size_t lzSizes = 0;
+        size_t greedySizes = 0;
         size_t newSizes = 0;
         size_t rawSizes = 0;
         size_t totalImages = 0;
@@ -195,8 +266,13 @@ int main(int argc, char *argv[])
             if (currImage.isValid)
             {
                 lzSizes += currImage.lzSize;
+                greedySizes += currImage.greedySize;
                 newSizes += currImage.compressedSize;
                 rawSizes += currImage.rawNumBytes;
+                if (settings.useOptimalParse)
+                    fprintf(stderr, "%s: greedy %zu, optimal %zu (%.2f%%)\n", currImage.fileName.c_str(),
+                            currImage.greedySize, currImage.compressedSize,
+                            100.0 * currImage.compressedSize / currImage.greedySize);
             }
             else
             {
@@ -207,34 +283,56 @@ int main(int argc, char *argv[])
 
         fprintf(stderr, "RawSize: %zu\n", rawSizes);
         fprintf(stderr, "LZsize: %zu\n", lzSizes);
+        if (settings.useOptimalParse)
+            fprintf(stderr, "GreedySmolSize: %zu\n", greedySizes);
         fprintf(stderr, "SmolSize: %zu\n", newSizes);
         fprintf(stderr, "Total Images: %zu\n", totalImages);
         fprintf(stderr, "Invalid Images: %zu\n", invalidImages);
     }
-    if (option == WRITE)
+    if (option == CACHE_STATS)
+        printAssetCacheStats();
+    if (option == VERIFY)
     {
-        if (std::filesystem::exists(input))
+        std::filesystem::path dirPath = input;
+        FileDispatcher dispatcher(dirPath);
+        dispatcher.setFileExtension(".4bpp");
+        if (!dispatcher.initFileList())
         {
-            CompressedImage image;
-            if (settings.useFrames)
-                image = processImageFrames(input, settings);
-            else
-                image = processImage(input, settings);
-            if (image.isValid)
-            {
-                std::ofstream fileOut(output.c_str(), std::ios::out | std::ios::binary);
-                fileOut.write(reinterpret_cast<const char *>(image.writeVec.data()), image.writeVec.size()*4);
-                fileOut.close();
-            }
-            else
-            {
-                fprintf(stderr, "Failed to compress image %s\n", image.fileName.c_str());
-            }
+            fprintf(stderr, "Failed to init file list\n");
+            return 1;
         }
-        else
+        std::mutex dispatchMutex;
+        std::vector<std::string> failedImages;
+        std::mutex failMutex;
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < numThreads; i++)
         {
-            fprintf(stderr, "Input file %s doesn't exist\n", input.c_str());
+            threads.emplace_back(verifyImages, &failedImages, &failMutex,
+                                               &dispatcher, &dispatchMutex,
+                                               settings);
         }
+
+        for (int i = 0; i < numThreads; i++)
+            threads[i].join();
+
+        for (std::string fileName : failedImages)
+            fprintf(stderr, "Failed to verify %s\n", fileName.c_str());
+        fprintf(stderr, "Failed Images: %zu\n", failedImages.size());
+        if (failedImages.size() != 0)
+            return 1;
+    }
+    if (option == BATCH)
+    {
+        std::vector<BatchJob> jobs;
+        if (!readBatchManifest(input, settings, &jobs))
+            return 1;
+        if (!runBatch(&jobs, numThreads, argv[0]))
+            return 1;
+    }
+    if (option == WRITE)
+    {
+        compressFile(input, output, settings, argv[0]);
     }
     if (option == DECODE)
     {
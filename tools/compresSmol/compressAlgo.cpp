@@ -1,4 +1,6 @@
 #include "compressAlgo.h"
+#include "matchFinder.h"
+#include "optimalParse.h"
 
 std::vector<ShortCopy> getShortCopies(std::vector<unsigned short> input, size_t minLength)
 {
@@ -31,38 +33,7 @@ std::vector<ShortCopy> getShortCopies(std::vector<unsigned short> input, size_t
             startIndex += longestLength;
         }
     }
-    std::vector<unsigned short> checkVec(input.size());
-    for (ShortCopy copy : copies)
-        for (size_t i = 0; i <= copy.length; i++)
-            checkVec[copy.index + i - 1]++;
-    size_t currStart = 0;
-    size_t currLength = 1;
-    unsigned short prevSym = checkVec[0];
-    for (size_t i = 1; i < checkVec.size(); i++)
-    {
-        unsigned short currSym = checkVec[i];
-        if (currSym == 0 && prevSym == 0)
-            currLength++;
-        else if (currSym == 0 && prevSym == 1)
-        {
-            currStart = i;
-            currLength = 1;
-        }
-        else if (currSym == 1 && prevSym == 0)
-        {
-            std::vector<unsigned short>::const_iterator start = input.begin() + currStart;
-            std::vector<unsigned short>::const_iterator end = input.begin() + currStart + currLength;
-            copies.push_back(ShortCopy(currStart, currLength, 0, std::vector<unsigned short>(start, end)));
-        }
-        prevSym = currSym;
-    }
-    if (prevSym == 0)
-    {
-        std::vector<unsigned short>::const_iterator start = input.begin() + currStart;
-        std::vector<unsigned short>::const_iterator end = input.begin() + currStart + currLength;
-        copies.push_back(ShortCopy(currStart, currLength, 0, std::vector<unsigned short>(start, end)));
-    }
-
+    appendRawShortCopies(&copies, &input);
     return copies;
 }
 
@@ -397,21 +368,15 @@ CompressedImage processImageData(std::vector<unsigned char> input, InputSettings
     std::vector<unsigned char> bestLO;
     std::vector<unsigned short> bestSym;
     std::vector<ShortCompressionInstruction> bestInstructions;
-    for (size_t minCodeLength = 2; minCodeLength <= 15; minCodeLength++)
+    //  Tries every allowed mode on one set of instructions and keeps the smallest result
+    auto tryInstructions = [&](std::vector<ShortCompressionInstruction> shortInstructions)
     {
-        std::vector<ShortCopy> shortCopies = getShortCopies(usBase, minCodeLength);
-        if (!verifyShortCopies(&shortCopies, &usBase))
-        {
-            copyFail = true;
-            continue;
-        }
-        std::vector<ShortCompressionInstruction> shortInstructions = getShortInstructions(shortCopies, minCodeLength-1);
         std::vector<unsigned char> loVec = getLosFromInstructions(shortInstructions);
         std::vector<unsigned short> symVec = getSymsFromInstructions(shortInstructions);
         if (!verifyBytesShort(&loVec, &symVec, &usBase))
         {
             byteFail = true;
-            continue;
+            return;
         }
         CompressionMode mode = BASE_ONLY;
         //std::vector<CompressionMode> modesToUse = {ENCODE_SYMS};
@@ -494,7 +459,45 @@ CompressedImage processImageData(std::vector<unsigned char> input, InputSettings
                 someMode = mode;
             }
         }
+    };
+
+    for (size_t minCodeLength = 2; minCodeLength <= 15; minCodeLength++)
+    {
+        std::vector<ShortCopy> shortCopies = findShortCopies(&usBase, minCodeLength, settings.matchFinder);
+        if (!verifyShortCopies(&shortCopies, &usBase))
+        {
+            copyFail = true;
+            continue;
+        }
+        tryInstructions(getShortInstructions(shortCopies, minCodeLength-1));
+    }
+    size_t greedySize = hasImage ? bestImage.compressedSize : 0;
+
+    //  The first pass estimates the nibble costs from the best greedy instructions,
+    //  every later pass from the instructions of the pass before it
+    if (settings.useOptimalParse && hasImage)
+    {
+        std::vector<unsigned char> modelLO = bestLO;
+        std::vector<unsigned short> modelSym = bestSym;
+        for (size_t pass = 0; pass < OPTIMAL_PARSE_PASSES; pass++)
+        {
+            SmolCostModel model = getCostModel(&modelLO, &modelSym);
+            std::vector<ShortCopy> shortCopies = getShortCopiesOptimal(&usBase, &model);
+            if (!verifyShortCopies(&shortCopies, &usBase))
+            {
+                copyFail = true;
+                break;
+            }
+            std::vector<ShortCompressionInstruction> shortInstructions = getShortInstructions(shortCopies, 0);
+            modelLO = getLosFromInstructions(shortInstructions);
+            modelSym = getSymsFromInstructions(shortInstructions);
+            //  Don't overflow the header fields
+            if (modelLO.size() > LO_SIZE_MASK || modelSym.size() > SYM_SIZE_MASK)
+                break;
+            tryInstructions(shortInstructions);
+        }
     }
+    bestImage.greedySize = greedySize;
     bestImage.mode = someMode;
     bestImage.fileName = fileName;
     bestImage.lzSize = baseLZsize;
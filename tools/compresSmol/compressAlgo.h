@@ -49,6 +49,11 @@ enum CompressionMode {
     IS_TILEMAP = 8,
 };
 
+enum MatchFinder {
+    MATCH_BRUTE_FORCE = 0,
+    MATCH_HASH_CHAIN = 1,
+};
+
 struct ShortCopy {
     size_t index;
     size_t length;
@@ -104,6 +109,7 @@ struct CompressedImage {
     unsigned int loFreqs[3];
     unsigned int symFreqs[3];
     size_t compressedSize;
+    size_t greedySize = 0;
     bool isValid = false;
     std::vector<unsigned int> writeVec;
     std::vector<unsigned int> tANSbits;
@@ -118,6 +124,8 @@ struct InputSettings {
     bool canDeltaSyms = true;
     bool shouldCompare = false;
     bool useFrames = false;
+    MatchFinder matchFinder = MATCH_HASH_CHAIN;
+    bool useOptimalParse = false;
     InputSettings();
     InputSettings(bool canEncodeLO, bool canEncodeSyms, bool canDeltaSyms);
 };
@@ -134,6 +142,7 @@ CompressedImage processImageFrames(std::string fileName, InputSettings settings)
 CompressedImage processImageData(std::vector<unsigned char> input, InputSettings settings, std::string fileName);
 
 std::vector<unsigned int> readFileAsUInt(std::string filePath);
+std::vector<unsigned char> readFileAsUC(std::string filePath);
 
 size_t getCompressedSize(CompressedImage *pImage);
 
@@ -10,6 +10,11 @@ void FileDispatcher::setFilePath(std::filesystem::path inPath)
     filePath = inPath;
 }
 
+void FileDispatcher::setFileExtension(std::string extension)
+{
+    fileExtension = extension;
+}
+
 bool FileDispatcher::initFileList()
 {
     std::string fileName;
@@ -18,7 +23,8 @@ bool FileDispatcher::initFileList()
         if (dirEntry.is_regular_file())
         {
             fileName = dirEntry.path().string();
-            if (fileName.find(".4bpp.lz") == std::string::npos)
+            if (fileName.size() < fileExtension.size()
+             || fileName.compare(fileName.size() - fileExtension.size(), fileExtension.size(), fileExtension) != 0)
                 continue;
         }
         else
@@ -12,10 +12,12 @@ class FileDispatcher {
     int currentIndex = 0;
     std::mutex requestMutex;
     std::filesystem::path filePath;
+    std::string fileExtension = ".4bpp.lz";
 public:
     FileDispatcher();
     FileDispatcher(std::filesystem::path inPath);
     void setFilePath(std::filesystem::path inPath);
+    void setFileExtension(std::string extension);
     bool initFileList();
     std::string requestFileName();
 };
@@ -0,0 +1,201 @@
+#include "matchFinder.h"
+
+std::vector<ShortCopy> findShortCopies(std::vector<unsigned short> *pInput, size_t minLength, MatchFinder finder)
+{
+    //  The hash chains are keyed on the first two symbols of a match,
+    //  so anything shorter can only be found by the brute force search
+    if (finder == MATCH_HASH_CHAIN && minLength >= HASH_CHAIN_MIN_LENGTH)
+        return getShortCopiesHashChain(pInput, minLength);
+    return getShortCopies(*pInput, minLength);
+}
+
+//  Produces the exact same copies as getShortCopies, but only visits earlier
+//  positions that start with the same two symbols as the current one.
+//  Chains are walked from the most recent position backwards, so the first
+//  longest match found is also the one with the smallest offset, matching
+//  the tie-breaking of the brute force search.
+std::vector<ShortCopy> getShortCopiesHashChain(std::vector<unsigned short> *pInput, size_t minLength)
+{
+    std::vector<ShortCopy> copies;
+    std::vector<unsigned short> &input = *pInput;
+    size_t inputSize = input.size();
+    std::vector<long> head(HASH_CHAIN_SIZE, -1);
+    std::vector<long> prev(inputSize, -1);
+    size_t numInserted = 0;
+
+    for (size_t startIndex = 1; startIndex < inputSize; startIndex++)
+    {
+        while (numInserted < startIndex)
+        {
+            if (numInserted + 1 < inputSize)
+            {
+                size_t key = getHashChainKey(input[numInserted], input[numInserted + 1]);
+                prev[numInserted] = head[key];
+                head[key] = numInserted;
+            }
+            numInserted++;
+        }
+        if (startIndex + 1 >= inputSize)
+            break;
+
+        size_t longestLength = 0;
+        size_t longestOffset = 0;
+        size_t maxLength = inputSize - startIndex;
+        size_t key = getHashChainKey(input[startIndex], input[startIndex + 1]);
+        for (long candidate = head[key]; candidate >= 0; candidate = prev[candidate])
+        {
+            size_t searchOffset = startIndex - candidate;
+            if (searchOffset >= MAX_SHORT_COPY_OFFSET)
+                break;
+            if (input[candidate] != input[startIndex]
+             || input[candidate + 1] != input[startIndex + 1])
+                continue;
+            size_t currLength = HASH_CHAIN_MIN_LENGTH;
+            while (currLength < maxLength
+                && input[startIndex + currLength] == input[candidate + currLength])
+                currLength++;
+            if (currLength > longestLength)
+            {
+                longestLength = currLength;
+                longestOffset = searchOffset;
+                if (longestLength == maxLength)
+                    break;
+            }
+        }
+
+        if (longestLength > MAX_SHORT_COPY_LENGTH)
+            longestLength = MAX_SHORT_COPY_LENGTH;
+        if (longestLength >= minLength)
+        {
+            std::vector<unsigned short>::const_iterator start = input.begin() + startIndex;
+            std::vector<unsigned short>::const_iterator end = input.begin() + startIndex + longestLength;
+            copies.push_back(ShortCopy(startIndex, longestLength, longestOffset, std::vector<unsigned short>(start, end)));
+            copies[copies.size() - 1].firstSymbol = input[startIndex - 1];
+            startIndex += longestLength;
+        }
+    }
+    appendRawShortCopies(&copies, pInput);
+    return copies;
+}
+
+//  Fills every gap between the found copies with raw, offset 0, copies
+void appendRawShortCopies(std::vector<ShortCopy> *pCopies, std::vector<unsigned short> *pInput)
+{
+    std::vector<ShortCopy> &copies = *pCopies;
+    std::vector<unsigned short> &input = *pInput;
+    std::vector<unsigned short> checkVec(input.size());
+    for (ShortCopy copy : copies)
+        for (size_t i = 0; i <= copy.length; i++)
+            checkVec[copy.index + i - 1]++;
+    size_t currStart = 0;
+    size_t currLength = 1;
+    unsigned short prevSym = checkVec[0];
+    for (size_t i = 1; i < checkVec.size(); i++)
+    {
+        unsigned short currSym = checkVec[i];
+        if (currSym == 0 && prevSym == 0)
+            currLength++;
+        else if (currSym == 0 && prevSym == 1)
+        {
+            currStart = i;
+            currLength = 1;
+        }
+        else if (currSym == 1 && prevSym == 0)
+        {
+            std::vector<unsigned short>::const_iterator start = input.begin() + currStart;
+            std::vector<unsigned short>::const_iterator end = input.begin() + currStart + currLength;
+            copies.push_back(ShortCopy(currStart, currLength, 0, std::vector<unsigned short>(start, end)));
+        }
+        prevSym = currSym;
+    }
+    if (prevSym == 0)
+    {
+        std::vector<unsigned short>::const_iterator start = input.begin() + currStart;
+        std::vector<unsigned short>::const_iterator end = input.begin() + currStart + currLength;
+        copies.push_back(ShortCopy(currStart, currLength, 0, std::vector<unsigned short>(start, end)));
+    }
+}
+
+bool compareShortCopies(std::vector<ShortCopy> *pCopies1, std::vector<ShortCopy> *pCopies2)
+{
+    if (pCopies1->size() != pCopies2->size())
+        return false;
+    for (size_t i = 0; i < pCopies1->size(); i++)
+    {
+        ShortCopy *pCopy1 = &(*pCopies1)[i];
+        ShortCopy *pCopy2 = &(*pCopies2)[i];
+        if (pCopy1->index != pCopy2->index
+         || pCopy1->length != pCopy2->length
+         || pCopy1->offset != pCopy2->offset
+         || pCopy1->usSequence != pCopy2->usSequence)
+            return false;
+        if (pCopy1->offset != 0 && pCopy1->firstSymbol != pCopy2->firstSymbol)
+            return false;
+    }
+    return true;
+}
+
+//  Checks that every match finder agrees with the brute force search for
+//  every copy length the compressor tries, and that the final compressed
+//  image decodes back to the input
+bool verifyMatchFinders(std::string fileName, InputSettings settings)
+{
+    std::vector<unsigned char> input = readFileAsUC(fileName);
+    std::vector<unsigned short> usBase(input.size()/2);
+    memcpy(usBase.data(), input.data(), usBase.size()*2);
+    bool isValid = true;
+    for (size_t minCodeLength = 2; minCodeLength <= 15; minCodeLength++)
+    {
+        std::vector<ShortCopy> bruteCopies = findShortCopies(&usBase, minCodeLength, MATCH_BRUTE_FORCE);
+        std::vector<ShortCopy> finderCopies = findShortCopies(&usBase, minCodeLength, settings.matchFinder);
+        if (!compareShortCopies(&bruteCopies, &finderCopies))
+        {
+            fprintf(stderr, "%s: copy mismatch with min length %zu\n", fileName.c_str(), minCodeLength);
+            isValid = false;
+        }
+    }
+    CompressedImage image = processImageData(input, settings, fileName);
+    if (!image.isValid)
+    {
+        fprintf(stderr, "%s: failed to compress\n", fileName.c_str());
+        return false;
+    }
+    CompressedImage readImage = getDataFromUIntVec(&image.writeVec);
+    std::vector<unsigned short> decodedImage = decodeImageShort(&readImage);
+    if (!compareVectorsShort(&decodedImage, &usBase))
+    {
+        fprintf(stderr, "%s: round trip mismatch\n", fileName.c_str());
+        isValid = false;
+    }
+    return isValid;
+}
+
+void verifyImages(std::vector<std::string> *failedImages, std::mutex *failMutex, FileDispatcher *dispatcher, std::mutex *dispatchMutex, InputSettings settings)
+{
+    std::string fileName = "Initial Value";
+    while (fileName != "")
+    {
+        dispatchMutex->lock();
+        fileName = dispatcher->requestFileName();
+        dispatchMutex->unlock();
+        if (fileName == "")
+            break;
+        if (!verifyMatchFinders(fileName, settings))
+        {
+            failMutex->lock();
+            failedImages->push_back(fileName);
+            failMutex->unlock();
+        }
+    }
+}
+
+bool parseMatchFinder(std::string name, MatchFinder *pFinder)
+{
+    if (name.compare("brute") == 0)
+        *pFinder = MATCH_BRUTE_FORCE;
+    else if (name.compare("hash") == 0)
+        *pFinder = MATCH_HASH_CHAIN;
+    else
+        return false;
+    return true;
+}
@@ -0,0 +1,28 @@
+#ifndef MATCH_FINDER
+#define MATCH_FINDER
+#include <vector>
+#include <string>
+#include "compressAlgo.h"
+
+#define MAX_SHORT_COPY_LENGTH   32767
+#define MAX_SHORT_COPY_OFFSET   32767   //  Exclusive, like the original search
+#define HASH_CHAIN_BITS         16
+#define HASH_CHAIN_SIZE         (1 << HASH_CHAIN_BITS)
+#define HASH_CHAIN_MIN_LENGTH   2
+
+inline size_t getHashChainKey(unsigned short sym1, unsigned short sym2)
+{
+    unsigned int key = ((unsigned int)sym1 << 16) | sym2;
+    return (key * 2654435761u) >> (32 - HASH_CHAIN_BITS);
+}
+
+std::vector<ShortCopy> findShortCopies(std::vector<unsigned short> *pInput, size_t minLength, MatchFinder finder);
+std::vector<ShortCopy> getShortCopiesHashChain(std::vector<unsigned short> *pInput, size_t minLength);
+void appendRawShortCopies(std::vector<ShortCopy> *pCopies, std::vector<unsigned short> *pInput);
+
+bool compareShortCopies(std::vector<ShortCopy> *pCopies1, std::vector<ShortCopy> *pCopies2);
+bool verifyMatchFinders(std::string fileName, InputSettings settings);
+void verifyImages(std::vector<std::string> *failedImages, std::mutex *failMutex, FileDispatcher *dispatcher, std::mutex *dispatchMutex, InputSettings settings);
+
+bool parseMatchFinder(std::string name, MatchFinder *pFinder);
+#endif
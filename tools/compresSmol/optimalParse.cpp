@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "optimalParse.h"
+#include "matchFinder.h"
+
+enum ParseStep {
+    STEP_NONE,
+    STEP_RAW,
+    STEP_COPY,
+};
+
+struct ParseNode {
+    double cost;
+    size_t prevPos;
+    ParseStep step = STEP_NONE;
+    size_t length;
+    size_t offset;
+};
+
+struct MatchCandidate {
+    size_t length;
+    size_t offset;
+    double offsetCost;
+};
+
+static void fillNibbleBits(std::vector<size_t> *pCounts, double *pBits)
+{
+    //  Every nibble gets a count of at least 1, otherwise unused values would be free
+    size_t total = 0;
+    for (size_t i = 0; i < 16; i++)
+        total += (*pCounts)[i] + 1;
+    for (size_t i = 0; i < 16; i++)
+        pBits[i] = std::log2((double)total / ((*pCounts)[i] + 1));
+}
+
+SmolCostModel getCostModel(std::vector<unsigned char> *pLoVec, std::vector<unsigned short> *pSymVec)
+{
+    SmolCostModel model;
+    std::vector<size_t> loCounts(16);
+    std::vector<size_t> symCounts(16);
+    for (unsigned char uc : *pLoVec)
+    {
+        loCounts[uc & NIBBLE_MASK]++;
+        loCounts[(uc >> 4) & NIBBLE_MASK]++;
+    }
+    for (unsigned short us : *pSymVec)
+        for (size_t j = 0; j < 4; j++)
+            symCounts[(us >> (4*j)) & NIBBLE_MASK]++;
+    fillNibbleBits(&loCounts, model.loNibbleBits);
+    fillNibbleBits(&symCounts, model.symNibbleBits);
+    return model;
+}
+
+static double getLoByteCost(SmolCostModel *pModel, unsigned char value)
+{
+    return pModel->loNibbleBits[value & NIBBLE_MASK] + pModel->loNibbleBits[(value >> 4) & NIBBLE_MASK];
+}
+
+//  Same 1 or 2 byte layout as ShortCompressionInstruction::buildBytes
+static double getLoValueCost(SmolCostModel *pModel, size_t value)
+{
+    if ((value >> LO_NUM_LOW_BITS) == 0)
+        return getLoByteCost(pModel, value & LO_LOW_BITS_MASK);
+    return getLoByteCost(pModel, (value & LO_LOW_BITS_MASK) + LO_CONTINUE_BIT)
+         + getLoByteCost(pModel, (value >> LO_NUM_LOW_BITS) & BYTE_MASK);
+}
+
+static double getSymbolCost(SmolCostModel *pModel, unsigned short symbol)
+{
+    double cost = 0;
+    for (size_t j = 0; j < 4; j++)
+        cost += pModel->symNibbleBits[(symbol >> (4*j)) & NIBBLE_MASK];
+    return cost;
+}
+
+//  Shortest path over the input where every edge is one instruction,
+//  either a raw run of symbols or a symbol followed by a copy,
+//  weighted by its estimated tANS coded size
+std::vector<ShortCopy> getShortCopiesOptimal(std::vector<unsigned short> *pInput, SmolCostModel *pModel)
+{
+    std::vector<unsigned short> &input = *pInput;
+    size_t inputSize = input.size();
+    std::vector<ShortCopy> copies;
+    if (inputSize == 0)
+        return copies;
+
+    std::vector<double> loValueCosts(MAX_SHORT_COPY_LENGTH + 1);
+    for (size_t i = 0; i <= MAX_SHORT_COPY_LENGTH; i++)
+        loValueCosts[i] = getLoValueCost(pModel, i);
+    double rawMarkerCost = getLoByteCost(pModel, 0);
+
+    std::vector<double> symbolCostSums(inputSize + 1);
+    for (size_t i = 0; i < inputSize; i++)
+        symbolCostSums[i + 1] = symbolCostSums[i] + getSymbolCost(pModel, input[i]);
+
+    std::vector<ParseNode> nodes(inputSize + 1);
+    for (size_t i = 1; i <= inputSize; i++)
+        nodes[i].cost = std::numeric_limits<double>::infinity();
+    nodes[0].cost = 0;
+
+    std::vector<long> head(HASH_CHAIN_SIZE, -1);
+    std::vector<long> prev(inputSize, -1);
+    size_t numInserted = 0;
+    std::vector<MatchCandidate> candidates;
+
+    for (size_t pos = 0; pos < inputSize; pos++)
+    {
+        double baseCost = nodes[pos].cost;
+
+        //  Raw runs
+        size_t maxRaw = std::min(inputSize - pos, (size_t)OPTIMAL_MAX_RAW_LENGTH);
+        for (size_t length = 1; length <= maxRaw; length++)
+        {
+            double cost = baseCost + rawMarkerCost + loValueCosts[length] + symbolCostSums[pos + length] - symbolCostSums[pos];
+            if (cost < nodes[pos + length].cost)
+            {
+                nodes[pos + length].cost = cost;
+                nodes[pos + length].prevPos = pos;
+                nodes[pos + length].step = STEP_RAW;
+                nodes[pos + length].length = length;
+            }
+        }
+
+        //  The symbol at pos followed by a copy starting at copyStart
+        size_t copyStart = pos + 1;
+        while (numInserted < copyStart && numInserted + 1 < inputSize)
+        {
+            size_t key = getHashChainKey(input[numInserted], input[numInserted + 1]);
+            prev[numInserted] = head[key];
+            head[key] = numInserted;
+            numInserted++;
+        }
+        if (copyStart + 1 >= inputSize)
+            continue;
+
+        candidates.clear();
+        size_t maxLength = std::min(inputSize - copyStart, (size_t)MAX_SHORT_COPY_LENGTH);
+        size_t longestLength = 0;
+        size_t numVisited = 0;
+        size_t key = getHashChainKey(input[copyStart], input[copyStart + 1]);
+        for (long candidate = head[key]; candidate >= 0 && numVisited < OPTIMAL_MAX_CANDIDATES; candidate = prev[candidate])
+        {
+            numVisited++;
+            size_t offset = copyStart - candidate;
+            if (offset >= MAX_SHORT_COPY_OFFSET)
+                break;
+            if (input[candidate] != input[copyStart]
+             || input[candidate + 1] != input[copyStart + 1])
+                continue;
+            size_t length = HASH_CHAIN_MIN_LENGTH;
+            while (length < maxLength && input[copyStart + length] == input[candidate + length])
+                length++;
+            MatchCandidate match;
+            match.length = length;
+            match.offset = offset;
+            match.offsetCost = loValueCosts[offset];
+            candidates.push_back(match);
+            longestLength = std::max(longestLength, length);
+            if (length == maxLength)
+                break;
+        }
+        if (candidates.size() == 0)
+            continue;
+
+        //  Walk the lengths from longest to shortest, keeping the cheapest
+        //  offset out of every candidate that is at least that long
+        std::sort(candidates.begin(), candidates.end(), [](const MatchCandidate &a, const MatchCandidate &b) {
+            return a.length > b.length;
+        });
+        double literalCost = baseCost + symbolCostSums[copyStart] - symbolCostSums[pos];
+        size_t minLength = longestLength >= OPTIMAL_SUFFICIENT_LENGTH ? longestLength : HASH_CHAIN_MIN_LENGTH;
+        size_t candidateIndex = 0;
+        double bestOffsetCost = std::numeric_limits<double>::infinity();
+        size_t bestOffset = 0;
+        for (size_t length = longestLength; length >= minLength; length--)
+        {
+            while (candidateIndex < candidates.size() && candidates[candidateIndex].length >= length)
+            {
+                if (candidates[candidateIndex].offsetCost < bestOffsetCost)
+                {
+                    bestOffsetCost = candidates[candidateIndex].offsetCost;
+                    bestOffset = candidates[candidateIndex].offset;
+                }
+                candidateIndex++;
+            }
+            double cost = literalCost + loValueCosts[length] + bestOffsetCost;
+            size_t end = copyStart + length;
+            if (cost < nodes[end].cost)
+            {
+                nodes[end].cost = cost;
+                nodes[end].prevPos = pos;
+                nodes[end].step = STEP_COPY;
+                nodes[end].length = length;
+                nodes[end].offset = bestOffset;
+            }
+        }
+    }
+
+    size_t pos = inputSize;
+    while (pos != 0)
+    {
+        ParseNode *pNode = &nodes[pos];
+        size_t start = pNode->prevPos;
+        if (pNode->step == STEP_RAW)
+        {
+            std::vector<unsigned short>::const_iterator startIt = input.begin() + start;
+            std::vector<unsigned short>::const_iterator endIt = input.begin() + pos;
+            copies.push_back(ShortCopy(start, pNode->length, 0, std::vector<unsigned short>(startIt, endIt)));
+        }
+        else
+        {
+            std::vector<unsigned short>::const_iterator startIt = input.begin() + start + 1;
+            std::vector<unsigned short>::const_iterator endIt = input.begin() + pos;
+            copies.push_back(ShortCopy(start + 1, pNode->length, pNode->offset, std::vector<unsigned short>(startIt, endIt)));
+            copies[copies.size() - 1].firstSymbol = input[start];
+        }
+        pos = start;
+    }
+    std::reverse(copies.begin(), copies.end());
+    return copies;
+}
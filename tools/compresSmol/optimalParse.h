@@ -0,0 +1,19 @@
+#ifndef OPTIMAL_PARSE
+#define OPTIMAL_PARSE
+#include <vector>
+#include "compressAlgo.h"
+
+#define OPTIMAL_PARSE_PASSES        3
+#define OPTIMAL_MAX_CANDIDATES      256
+#define OPTIMAL_MAX_RAW_LENGTH      1024
+#define OPTIMAL_SUFFICIENT_LENGTH   256
+
+//  Estimated number of bits for every nibble value in the tANS coded LO and symbol streams
+struct SmolCostModel {
+    double loNibbleBits[16];
+    double symNibbleBits[16];
+};
+
+SmolCostModel getCostModel(std::vector<unsigned char> *pLoVec, std::vector<unsigned short> *pSymVec);
+std::vector<ShortCopy> getShortCopiesOptimal(std::vector<unsigned short> *pInput, SmolCostModel *pModel);
+#endif
@@ -0,0 +1,218 @@
+#!/usr/bin/env python3
+
+"""
+Usage: python3 make_dex_index.py OUTPUT_HEADER
+
+Build a C-header with constant reverse lookup tables for the Pokédex:
+    1. sNationalDexNumToSpecies, from a National Dex number to the base
+       species with that number, taken from the species data in
+       src/data/pokemon/species_info/.
+    2. sNationalToKantoDexNum and sNationalToHoennDexNum, the inverses of
+       sKantoDexNumToNationalDexNum and sHoennToNationalOrder in
+       src/pokemon.c.
+
+The species data is behind config checks (e.g. P_FAMILY_BULBASAUR or
+P_MEGA_EVOLUTIONS), so every entry keeps the checks that surround it in
+the source. When several entries share a Dex number, the first one is
+used, like the linear searches that these tables replace.
+"""
+
+import glob
+import re
+import sys
+import typing
+
+
+SPECIES_DEFINE_PAT = re.compile(r"#define\s+(SPECIES_\w+)\s+\(?\s*(\w+)\s*(?:\+\s*(\d+))?\s*\)?\s*$")
+SPECIES_ENTRY_PAT = re.compile(r"^\s*\[(SPECIES_\w+)\]\s*=(.*)$")
+NAT_DEX_NUM_PAT = re.compile(r"\.natDexNum\s*=\s*(NATIONAL_DEX_\w+)")
+MACRO_DEFINE_PAT = re.compile(r"^\s*#\s*define\s+(\w+)(.*)$")
+IDENTIFIER_PAT = re.compile(r"\b[A-Za-z_]\w*\b")
+PREPROC_PAT = re.compile(r"^\s*#\s*(if|ifdef|ifndef|elif|else|endif)\b(.*?)(?://.*)?$")
+REGIONAL_ENTRY_PAT = re.compile(r"^\s*(KANTO|HOENN)_TO_NATIONAL\((\w+)\)")
+
+
+class Conditions:
+    """
+    Tracks the preprocessor conditions around the current line.
+    """
+    def __init__(self):
+        self.stack = []
+
+    def handle(self, directive: str, expr: str):
+        expr = expr.strip()
+        if directive == "if":
+            self.stack.append(([], f"({expr})"))
+        elif directive == "ifdef":
+            self.stack.append(([], f"defined({expr})"))
+        elif directive == "ifndef":
+            self.stack.append(([], f"!defined({expr})"))
+        elif directive == "elif":
+            previous, current = self.stack.pop()
+            self.stack.append((previous + [current], f"({expr})"))
+        elif directive == "else":
+            previous, current = self.stack.pop()
+            self.stack.append((previous + [current], None))
+        elif directive == "endif":
+            self.stack.pop()
+
+    def current(self) -> typing.Tuple[str, ...]:
+        atoms = []
+        for previous, current in self.stack:
+            atoms.extend(f"!{p}" for p in previous)
+            if current is not None:
+                atoms.append(current)
+        return tuple(atoms)
+
+
+def read_species_ids() -> typing.Dict[str, int]:
+    values = {}
+    with open("./include/constants/species.h", "r") as species_fp:
+        for line in species_fp:
+            m = SPECIES_DEFINE_PAT.match(line.strip())
+            if not m:
+                continue
+            name, value, offset = m.groups()
+            if value.isdigit():
+                values[name] = int(value)
+            elif value in values:
+                values[name] = values[value] + int(offset or 0)
+    return values
+
+
+def find_nat_dex_num(text: str, macro_nat_dex_nums: typing.Dict[str, str]) -> typing.Optional[str]:
+    """
+    Return the natDexNum set in text, either directly or by a macro.
+    """
+    m = NAT_DEX_NUM_PAT.search(text)
+    if m:
+        return m.group(1)
+    for identifier in IDENTIFIER_PAT.findall(text):
+        if identifier in macro_nat_dex_nums:
+            return macro_nat_dex_nums[identifier]
+    return None
+
+
+def read_species_nat_dex_nums() -> typing.List[typing.Tuple[str, str, typing.Tuple[str, ...]]]:
+    """
+    Return (species, natDexNum, conditions) for every entry of gSpeciesInfo.
+    """
+    entries = []
+    for fname in sorted(glob.glob("./src/data/pokemon/species_info/gen_*_families.h")):
+        conditions = Conditions()
+        macro_nat_dex_nums = {}
+        macro_name = None
+        pending = None
+        with open(fname, "r") as species_info_fp:
+            for line in species_info_fp:
+                if macro_name is not None:
+                    nat_dex_num = find_nat_dex_num(line, macro_nat_dex_nums)
+                    if nat_dex_num is not None:
+                        macro_nat_dex_nums.setdefault(macro_name, nat_dex_num)
+                    if not line.rstrip().endswith("\\"):
+                        macro_name = None
+                    continue
+
+                m = MACRO_DEFINE_PAT.match(line)
+                if m:
+                    nat_dex_num = find_nat_dex_num(m.group(2), macro_nat_dex_nums)
+                    if nat_dex_num is not None:
+                        macro_nat_dex_nums[m.group(1)] = nat_dex_num
+                    if line.rstrip().endswith("\\"):
+                        macro_name = m.group(1)
+                    continue
+
+                m = PREPROC_PAT.match(line)
+                if m:
+                    conditions.handle(m.group(1), m.group(2))
+                    continue
+
+                m = SPECIES_ENTRY_PAT.match(line)
+                if m:
+                    pending = (m.group(1), conditions.current())
+                    line = m.group(2)
+
+                if pending is not None:
+                    nat_dex_num = find_nat_dex_num(line, macro_nat_dex_nums)
+                    if nat_dex_num is not None:
+                        entries.append((pending[0], nat_dex_num, pending[1]))
+                        pending = None
+    return entries
+
+
+def read_regional_dex(region: str) -> typing.List[typing.Tuple[str, typing.Tuple[str, ...]]]:
+    """
+    Return (name, conditions) for every entry of the region's Dex order in
+    src/pokemon.c.
+    """
+    entries = []
+    conditions = Conditions()
+    with open("./src/pokemon.c", "r") as pokemon_fp:
+        for line in pokemon_fp:
+            m = PREPROC_PAT.match(line)
+            if m:
+                conditions.handle(m.group(1), m.group(2))
+                continue
+            m = REGIONAL_ENTRY_PAT.match(line)
+            if m and m.group(1) == region:
+                entries.append((m.group(2), conditions.current()))
+    return entries
+
+
+def render_table(decl: str, candidates: typing.Dict[str, typing.List[typing.Tuple[str, typing.Tuple[str, ...]]]]) -> str:
+    """
+    candidates maps each index to its possible values, most preferred first.
+    """
+    lines = [decl, "{"]
+    for index, values in candidates.items():
+        # A value whose conditions include all of an earlier value's
+        # conditions can never be chosen.
+        kept = []
+        for value, atoms in values:
+            if not any(set(earlier).issubset(atoms) for _, earlier in kept):
+                kept.append((value, atoms))
+
+        if len(kept) == 1 and len(kept[0][1]) == 0:
+            lines.append(f"    [{index}] = {kept[0][0]},")
+            continue
+        for i, (value, atoms) in enumerate(kept):
+            condition = " && ".join(atoms) if atoms else "TRUE"
+            lines.append(f"#{'if' if i == 0 else 'elif'} {condition}")
+            lines.append(f"    [{index}] = {value},")
+        lines.append("#endif")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__, file=sys.stderr)
+        sys.exit(1)
+
+    species_ids = read_species_ids()
+    national = {}
+    for species, nat_dex_num, atoms in sorted(read_species_nat_dex_nums(), key=lambda e: species_ids.get(e[0], sys.maxsize)):
+        national.setdefault(nat_dex_num, []).append((species, atoms))
+
+    kanto = {}
+    for name, atoms in read_regional_dex("KANTO"):
+        kanto.setdefault(f"NATIONAL_DEX_{name}", []).append((f"KANTO_DEX_{name}", atoms))
+
+    hoenn = {}
+    for name, atoms in read_regional_dex("HOENN"):
+        hoenn.setdefault(f"NATIONAL_DEX_{name}", []).append((f"HOENN_DEX_{name}", atoms))
+
+    with open(sys.argv[1], "w") as header_fp:
+        header_fp.write("//\n")
+        header_fp.write("// DO NOT MODIFY THIS FILE! It is auto-generated by tools/dex_index/make_dex_index.py\n")
+        header_fp.write("//\n\n")
+        header_fp.write(render_table("static const u16 sNationalDexNumToSpecies[NATIONAL_DEX_END] =", national))
+        header_fp.write("\n\n")
+        header_fp.write(render_table("static const u16 sNationalToKantoDexNum[NATIONAL_DEX_END] =", kanto))
+        header_fp.write("\n\n")
+        header_fp.write(render_table("static const u16 sNationalToHoennDexNum[NATIONAL_DEX_END] =", hoenn))
+        header_fp.write("\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+
+"""
+Usage: python3 report.py LOG [--map pokefirered.map] [--top N]
+
+Summarizes the frame times printed by a DEBUG_FRAME_PROFILER build. LOG
+is the mGBA log (or anything else that contains the "FP ..." lines
+printed by src/frame_profiler.c), and the linker map turns the addresses
+of callbacks, tasks and sprite callbacks into function names.
+
+Every screen, i.e. every gMain.callback2, gets its own report of how much
+of the frame budget each stage of the main loop took, how many frames
+went over budget, and which tasks and sprite callbacks took the longest.
+"""
+
+import argparse
+import collections
+import re
+import sys
+
+
+CYCLES_PER_FRAME = 280896  # See FRAME_PROFILER_CYCLES_PER_FRAME.
+NUM_BUCKETS = 11
+
+FP_PAT = re.compile(r"\bFP ([WSFDE])\b ?(.*)$")
+MAP_SYMBOL_PAT = re.compile(r"^\s+0x([0-9a-fA-F]{8,16})\s+([A-Za-z_]\w*)\s*$")
+
+
+class StageStats:
+    def __init__(self):
+        self.frames = 0
+        self.total = 0
+        self.max = 0
+        self.histogram = [0] * NUM_BUCKETS
+
+    def add(self, total, maximum, histogram):
+        self.total += total
+        self.max = max(self.max, maximum)
+        for i, count in enumerate(histogram):
+            self.histogram[i] += count
+        self.frames += sum(histogram)
+
+
+class Screen:
+    def __init__(self):
+        self.frames = 0
+        self.stages = collections.defaultdict(StageStats)
+        self.funcs = collections.defaultdict(lambda: [0, 0])
+        self.dma_bytes = 0
+        self.max_dma_bytes = 0
+
+
+def read_symbols(map_path):
+    symbols = {}
+    if map_path is None:
+        return symbols
+    with open(map_path, "r") as map_file:
+        for line in map_file:
+            m = MAP_SYMBOL_PAT.match(line)
+            if m:
+                symbols.setdefault(int(m.group(1), 16), m.group(2))
+    return symbols
+
+
+def symbol_name(symbols, address):
+    # Thumb function pointers have their lowest bit set.
+    name = symbols.get(address & ~1)
+    return name if name is not None else f"0x{address:08x}"
+
+
+def read_log(log_path):
+    screens = collections.defaultdict(Screen)
+    screen = None
+    with open(log_path, "r", errors="replace") as log_file:
+        for line in log_file:
+            m = FP_PAT.search(line)
+            if not m:
+                continue
+            kind, fields = m.group(1), m.group(2).split()
+            if kind == "W":
+                screen = screens[int(fields[0], 16)]
+                screen.frames += int(fields[1])
+            elif screen is None:
+                continue
+            elif kind == "S":
+                values = [int(f) for f in fields[1:]]
+                screen.stages[fields[0]].add(values[1], values[2], values[3:3 + NUM_BUCKETS])
+            elif kind == "F":
+                entry = screen.funcs[(fields[0], int(fields[1], 16))]
+                entry[0] += int(fields[2])
+                entry[1] += int(fields[3])
+            elif kind == "D":
+                screen.dma_bytes += int(fields[0])
+                screen.max_dma_bytes = max(screen.max_dma_bytes, int(fields[1]))
+            elif kind == "E":
+                screen = None
+    return screens
+
+
+def percent(cycles):
+    return f"{100 * cycles / CYCLES_PER_FRAME:6.1f}%"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Summarize DEBUG_FRAME_PROFILER output.")
+    parser.add_argument("log")
+    parser.add_argument("--map", help="linker map, e.g. pokefirered.map")
+    parser.add_argument("--top", type=int, default=10, help="functions to list per screen")
+    args = parser.parse_args()
+
+    symbols = read_symbols(args.map)
+    screens = read_log(args.log)
+    if not screens:
+        print(f"No frame profiler output in {args.log}.", file=sys.stderr)
+        sys.exit(1)
+
+    def over_budget(item):
+        busy = item[1].stages["busy"]
+        return (busy.histogram[-1], busy.total)
+
+    for address, screen in sorted(screens.items(), key=over_budget, reverse=True):
+        busy = screen.stages["busy"]
+        print(f"{symbol_name(symbols, address)}: {screen.frames} frames, "
+              f"{busy.histogram[-1]} over budget")
+        print(f"    {'stage':<12} {'mean':>7} {'max':>7}  histogram (10% of a frame per bucket)")
+        for name, stats in screen.stages.items():
+            if stats.frames == 0:
+                continue
+            histogram = " ".join(f"{count:4}" for count in stats.histogram)
+            print(f"    {name:<12} {percent(stats.total / stats.frames)} {percent(stats.max)}  {histogram}")
+        print(f"    DMA3: {screen.dma_bytes / screen.frames:.0f} bytes/frame, {screen.max_dma_bytes} max")
+
+        funcs = sorted(screen.funcs.items(), key=lambda item: item[1][1], reverse=True)[:args.top]
+        if funcs:
+            print(f"    {'function':<40} {'stage':<10} {'calls/frame':>11} {'mean':>7}")
+            for (stage, func), (calls, cycles) in funcs:
+                print(f"    {symbol_name(symbols, func):<40} {stage:<10} "
+                      f"{calls / screen.frames:11.1f} {percent(cycles / screen.frames)}")
+        print()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,427 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <unistd.h>
+#include "global.h"
+#include "cache.h"
+
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+struct CacheEntry
+{
+    char *path;
+    long long size;
+    time_t lastUsed;
+};
+
+static uint64_t HashBytes(uint64_t hash, const void *data, size_t size)
+{
+    const unsigned char *bytes = data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+static uint64_t HashString(uint64_t hash, const char *s)
+{
+    // Include the terminator so that "ab" "c" and "a" "bc" hash differently.
+    return HashBytes(hash, s, strlen(s) + 1);
+}
+
+static uint64_t HashFile(uint64_t hash, const char *path)
+{
+    FILE *fp = fopen(path, "rb");
+    unsigned char buffer[4096];
+    size_t count;
+
+    if (fp == NULL)
+        return hash;
+
+    while ((count = fread(buffer, 1, sizeof(buffer), fp)) != 0)
+        hash = HashBytes(hash, buffer, count);
+
+    fclose(fp);
+    return hash;
+}
+
+static char *JoinPath(const char *dir, const char *name)
+{
+    char *path = malloc(strlen(dir) + strlen(name) + 2);
+
+    if (path == NULL)
+        FATAL_ERROR("Failed to allocate memory for cache path.\n");
+
+    sprintf(path, "%s/%s", dir, name);
+    return path;
+}
+
+static bool IsCacheEntryName(const char *name)
+{
+    if (strlen(name) != ASSET_CACHE_KEY_LENGTH)
+        return false;
+
+    for (int i = 0; i < ASSET_CACHE_KEY_LENGTH; i++)
+    {
+        if (!((name[i] >= '0' && name[i] <= '9') || (name[i] >= 'a' && name[i] <= 'f')))
+            return false;
+    }
+
+    return true;
+}
+
+// The cache keeps a few running totals in small text files next to the
+// entries: the total size of the entries in "size", and the hits and misses
+// of each tool in "stats-<tool>". Returns false if the file is missing or
+// unreadable, in which case all values are 0.
+static bool ReadCacheCounters(char *path, long long *values, int count)
+{
+    FILE *fp = fopen(path, "rb");
+    bool valid = fp != NULL;
+
+    for (int i = 0; i < count && valid; i++)
+        valid = fscanf(fp, "%lld", &values[i]) == 1;
+
+    if (!valid)
+    {
+        for (int i = 0; i < count; i++)
+            values[i] = 0;
+    }
+
+    if (fp != NULL)
+        fclose(fp);
+
+    return valid;
+}
+
+// Replaced through a rename so that a parallel reader never sees a partial
+// file. Two processes updating a file at the same time can lose one of the
+// updates, so the totals are estimates. Eviction rescans the directory and
+// corrects the size.
+static void WriteCacheCounters(char *path, long long *values, int count)
+{
+    char *tempPath = malloc(strlen(path) + 32);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for cache path.\n");
+
+    sprintf(tempPath, "%s.%ld.tmp", path, (long)getpid());
+
+    FILE *fp = fopen(tempPath, "wb");
+
+    if (fp != NULL)
+    {
+        for (int i = 0; i < count; i++)
+            fprintf(fp, "%lld\n", values[i]);
+
+        if (fclose(fp) != 0 || rename(tempPath, path) != 0)
+            remove(tempPath);
+    }
+
+    free(tempPath);
+}
+
+static void RecordCacheEvent(char *dir, char *toolName, char event)
+{
+    char statsName[64];
+    snprintf(statsName, sizeof(statsName), "stats-%s", toolName);
+    char *statsPath = JoinPath(dir, statsName);
+    long long counts[2]; // Hits, misses.
+
+    ReadCacheCounters(statsPath, counts, 2);
+    counts[event == 'H' ? 0 : 1]++;
+    WriteCacheCounters(statsPath, counts, 2);
+    free(statsPath);
+}
+
+static struct CacheEntry *ListCacheEntries(char *dir, int *count, long long *totalSize)
+{
+    DIR *d = opendir(dir);
+    struct CacheEntry *entries = NULL;
+    int capacity = 0;
+
+    *count = 0;
+    *totalSize = 0;
+
+    if (d == NULL)
+        return NULL;
+
+    struct dirent *dirEntry;
+
+    while ((dirEntry = readdir(d)) != NULL)
+    {
+        if (!IsCacheEntryName(dirEntry->d_name))
+            continue;
+
+        char *path = JoinPath(dir, dirEntry->d_name);
+        struct stat st;
+
+        if (stat(path, &st) != 0)
+        {
+            free(path);
+            continue;
+        }
+
+        if (*count == capacity)
+        {
+            capacity = capacity == 0 ? 256 : capacity * 2;
+            entries = realloc(entries, capacity * sizeof(struct CacheEntry));
+
+            if (entries == NULL)
+                FATAL_ERROR("Failed to allocate memory for cache entries.\n");
+        }
+
+        entries[*count].path = path;
+        entries[*count].size = st.st_size;
+        entries[*count].lastUsed = st.st_mtime;
+        *totalSize += st.st_size;
+        (*count)++;
+    }
+
+    closedir(d);
+    return entries;
+}
+
+static int CompareCacheEntries(const void *a, const void *b)
+{
+    const struct CacheEntry *entryA = a;
+    const struct CacheEntry *entryB = b;
+
+    if (entryA->lastUsed < entryB->lastUsed)
+        return -1;
+    if (entryA->lastUsed > entryB->lastUsed)
+        return 1;
+    return 0;
+}
+
+// Removes the least recently used entries until the cache is below 3/4 of
+// its budget, so that the next scan is a while away, and stores the size
+// that is left.
+static void EvictAssetCache(struct AssetCache *cache, char *sizePath)
+{
+    int count;
+    long long totalSize;
+    struct CacheEntry *entries = ListCacheEntries(cache->dir, &count, &totalSize);
+
+    if (totalSize > cache->maxSize)
+    {
+        qsort(entries, count, sizeof(struct CacheEntry), CompareCacheEntries);
+
+        for (int i = 0; i < count && totalSize > cache->maxSize / 4 * 3; i++)
+        {
+            if (remove(entries[i].path) == 0)
+                totalSize -= entries[i].size;
+        }
+    }
+
+    WriteCacheCounters(sizePath, &totalSize, 1);
+
+    for (int i = 0; i < count; i++)
+        free(entries[i].path);
+
+    free(entries);
+}
+
+// Adds an entry that changed size by sizeChange to the running total, and
+// only scans the directory when the total goes over the budget, or when
+// there is no total yet.
+static void UpdateAssetCacheSize(struct AssetCache *cache, long long sizeChange)
+{
+    char *sizePath = JoinPath(cache->dir, "size");
+    long long totalSize;
+
+    if (!ReadCacheCounters(sizePath, &totalSize, 1))
+    {
+        EvictAssetCache(cache, sizePath);
+    }
+    else
+    {
+        totalSize += sizeChange;
+
+        if (totalSize > cache->maxSize)
+            EvictAssetCache(cache, sizePath);
+        else
+            WriteCacheCounters(sizePath, &totalSize, 1);
+    }
+
+    free(sizePath);
+}
+
+void InitAssetCache(struct AssetCache *cache, char *toolPath, char *command, int argc, char **argv, unsigned char *input, int inputSize)
+{
+    char *dir = getenv("ASSET_CACHE_DIR");
+    char *maxSize = getenv("ASSET_CACHE_SIZE");
+
+    memset(cache, 0, sizeof(*cache));
+
+    if (dir == NULL || *dir == 0)
+        return;
+
+#ifdef _WIN32
+    mkdir(dir);
+#else
+    mkdir(dir, 0777);
+#endif
+
+    cache->maxSize = (long long)ASSET_CACHE_DEFAULT_SIZE_MB << 20;
+
+    if (maxSize != NULL && atoll(maxSize) > 0)
+        cache->maxSize = atoll(maxSize) << 20;
+
+    // Hashing the binary itself means any rebuild of gbagfx invalidates old entries.
+    uint64_t key = FNV_OFFSET_BASIS;
+    uint64_t toolHash = HashFile(key, "/proc/self/exe");
+
+    if (toolHash == key)
+        toolHash = HashFile(key, toolPath);
+
+    key = toolHash;
+    key = HashString(key, command);
+
+    for (int i = 3; i < argc; i++)
+        key = HashString(key, argv[i]);
+
+    key = HashBytes(key, &inputSize, sizeof(inputSize));
+    key = HashBytes(key, input, inputSize);
+
+    char name[ASSET_CACHE_KEY_LENGTH + 1];
+    snprintf(name, sizeof(name), "%016llx", (unsigned long long)key);
+
+    cache->enabled = true;
+    cache->dir = dir;
+    cache->key = key;
+    cache->entryPath = JoinPath(dir, name);
+}
+
+unsigned char *ReadAssetCache(struct AssetCache *cache, int *size)
+{
+    if (!cache->enabled)
+        return NULL;
+
+    FILE *fp = fopen(cache->entryPath, "rb");
+
+    if (fp == NULL)
+    {
+        RecordCacheEvent(cache->dir, "gbagfx", 'M');
+        return NULL;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    *size = ftell(fp);
+    rewind(fp);
+
+    unsigned char *buffer = malloc(*size);
+
+    if (buffer == NULL)
+        FATAL_ERROR("Failed to allocate memory for cached data.\n");
+
+    if (fread(buffer, *size, 1, fp) != 1 && *size != 0)
+    {
+        fclose(fp);
+        free(buffer);
+        RecordCacheEvent(cache->dir, "gbagfx", 'M');
+        return NULL;
+    }
+
+    fclose(fp);
+
+    // Refresh the modification time, which eviction uses as the last use time.
+    utime(cache->entryPath, NULL);
+    RecordCacheEvent(cache->dir, "gbagfx", 'H');
+    return buffer;
+}
+
+void WriteAssetCache(struct AssetCache *cache, unsigned char *data, int size)
+{
+    if (!cache->enabled)
+        return;
+
+    // Write to a temporary file first so that a parallel reader never sees a partial entry.
+    char *tempPath = malloc(strlen(cache->entryPath) + 32);
+
+    if (tempPath == NULL)
+        FATAL_ERROR("Failed to allocate memory for cache path.\n");
+
+    sprintf(tempPath, "%s.%ld.tmp", cache->entryPath, (long)getpid());
+
+    FILE *fp = fopen(tempPath, "wb");
+
+    if (fp == NULL)
+    {
+        free(tempPath);
+        return;
+    }
+
+    bool written = fwrite(data, size, 1, fp) == 1 || size == 0;
+    struct stat st;
+    long long oldSize = stat(cache->entryPath, &st) == 0 ? st.st_size : 0;
+
+    if (fclose(fp) != 0 || !written || rename(tempPath, cache->entryPath) != 0)
+    {
+        remove(tempPath);
+        free(tempPath);
+        return;
+    }
+
+    free(tempPath);
+    UpdateAssetCacheSize(cache, size - oldSize);
+}
+
+void FreeAssetCache(struct AssetCache *cache)
+{
+    free(cache->entryPath);
+    cache->entryPath = NULL;
+    cache->enabled = false;
+}
+
+void PrintAssetCacheStats(char *toolName)
+{
+    char *dir = getenv("ASSET_CACHE_DIR");
+
+    if (dir == NULL || *dir == 0)
+    {
+        printf("ASSET_CACHE_DIR is not set, the asset cache is disabled.\n");
+        return;
+    }
+
+    char statsName[64];
+    snprintf(statsName, sizeof(statsName), "stats-%s", toolName);
+    char *statsPath = JoinPath(dir, statsName);
+    long long counts[2]; // Hits, misses.
+
+    ReadCacheCounters(statsPath, counts, 2);
+    free(statsPath);
+
+    long long hits = counts[0];
+    long long misses = counts[1];
+
+    int count;
+    long long totalSize;
+    struct CacheEntry *entries = ListCacheEntries(dir, &count, &totalSize);
+
+    for (int i = 0; i < count; i++)
+        free(entries[i].path);
+
+    free(entries);
+
+    long long lookups = hits + misses;
+
+    printf("Cache directory: %s\n", dir);
+    printf("%s hits: %lld\n", toolName, hits);
+    printf("%s misses: %lld\n", toolName, misses);
+    printf("%s hit rate: %.1f%%\n", toolName, lookups == 0 ? 0.0 : 100.0 * hits / lookups);
+    printf("Entries: %d\n", count);
+    printf("Total size: %lld bytes\n", totalSize);
+}
@@ -0,0 +1,29 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Compressed outputs are cached in ASSET_CACHE_DIR, keyed by a hash of the
+// gbagfx binary, the compression command with its options and the input data.
+// The cache is disabled when ASSET_CACHE_DIR is not set.
+
+#define ASSET_CACHE_DEFAULT_SIZE_MB 512
+#define ASSET_CACHE_KEY_LENGTH 16
+
+struct AssetCache
+{
+    bool enabled;
+    char *dir;
+    char *entryPath;
+    uint64_t key;
+    long long maxSize;
+};
+
+void InitAssetCache(struct AssetCache *cache, char *toolPath, char *command, int argc, char **argv, unsigned char *input, int inputSize);
+unsigned char *ReadAssetCache(struct AssetCache *cache, int *size);
+void WriteAssetCache(struct AssetCache *cache, unsigned char *data, int size);
+void FreeAssetCache(struct AssetCache *cache);
+void PrintAssetCacheStats(char *toolName);
+
+#endif // CACHE_H
@@ -2,6 +2,7 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <limits.h>
 #include "global.h"
 #include "lz.h"
 
@@ -69,85 +70,280 @@ fail:
 	FATAL_ERROR("Fatal error while decompressing LZ file.\n");
 }
 
-unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+#define LZ_MIN_BLOCK_SIZE 3
+#define LZ_MAX_BLOCK_SIZE 18
+#define LZ_MAX_DISTANCE 0x1000
+#define LZ_HASH_BITS 15
+#define LZ_HASH_SIZE (1 << LZ_HASH_BITS)
+
+// Every position whose next three bytes hash the same is linked together,
+// most recent first, so only positions that can start a block are visited.
+struct LZMatchFinder {
+	unsigned char *src;
+	int srcSize;
+	int minDistance;
+	int *head;
+	int *prev;
+	int numInserted;
+};
+
+static int LZHash(unsigned char *src)
 {
-	if (srcSize <= 0)
-		goto fail;
+	unsigned int key = (src[0] << 16) | (src[1] << 8) | src[2];
+	return (key * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void InitLZMatchFinder(struct LZMatchFinder *finder, unsigned char *src, int srcSize, int minDistance)
+{
+	finder->src = src;
+	finder->srcSize = srcSize;
+	finder->minDistance = minDistance;
+	finder->head = malloc(LZ_HASH_SIZE * sizeof(int));
+	finder->prev = malloc(srcSize * sizeof(int));
+	finder->numInserted = 0;
+
+	if (finder->head == NULL || finder->prev == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ match finder.\n");
+
+	for (int i = 0; i < LZ_HASH_SIZE; i++)
+		finder->head[i] = -1;
+}
+
+static void FreeLZMatchFinder(struct LZMatchFinder *finder)
+{
+	free(finder->head);
+	free(finder->prev);
+}
+
+// Finds the longest block at srcPos, and the shortest distance among the
+// longest blocks. This is the same block that a search of every distance
+// from minDistance up to LZ_MAX_DISTANCE would find.
+static int FindLZBlock(struct LZMatchFinder *finder, int srcPos, int *blockDistance)
+{
+	unsigned char *src = finder->src;
+	int srcSize = finder->srcSize;
+
+	while (finder->numInserted < srcPos) {
+		int pos = finder->numInserted++;
+
+		if (pos + LZ_MIN_BLOCK_SIZE <= srcSize) {
+			int hash = LZHash(&src[pos]);
+			finder->prev[pos] = finder->head[hash];
+			finder->head[hash] = pos;
+		}
+	}
+
+	int bestBlockSize = 0;
+
+	if (srcPos + LZ_MIN_BLOCK_SIZE > srcSize)
+		return 0;
+
+	int maxBlockSize = srcSize - srcPos;
+
+	if (maxBlockSize > LZ_MAX_BLOCK_SIZE)
+		maxBlockSize = LZ_MAX_BLOCK_SIZE;
+
+	for (int blockStart = finder->head[LZHash(&src[srcPos])]; blockStart >= 0; blockStart = finder->prev[blockStart]) {
+		int distance = srcPos - blockStart;
+
+		if (distance > LZ_MAX_DISTANCE)
+			break;
+
+		if (distance < finder->minDistance)
+			continue;
 
+		int blockSize = 0;
+
+		while (blockSize < maxBlockSize && src[blockStart + blockSize] == src[srcPos + blockSize])
+			blockSize++;
+
+		if (blockSize > bestBlockSize) {
+			bestBlockSize = blockSize;
+			*blockDistance = distance;
+
+			if (blockSize == maxBlockSize)
+				break;
+		}
+	}
+
+	return bestBlockSize >= LZ_MIN_BLOCK_SIZE ? bestBlockSize : 0;
+}
+
+struct LZWriter {
+	unsigned char *dest;
+	int destPos;
+	int flagsPos;
+	int numBlocks;
+};
+
+static void InitLZWriter(struct LZWriter *writer, int srcSize)
+{
 	int worstCaseDestSize = 4 + srcSize + ((srcSize + 7) / 8);
 
 	// Round up to the next multiple of four.
 	worstCaseDestSize = (worstCaseDestSize + 3) & ~3;
 
-	unsigned char *dest = malloc(worstCaseDestSize);
+	writer->dest = malloc(worstCaseDestSize);
 
-	if (dest == NULL)
-		goto fail;
+	if (writer->dest == NULL)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
 
 	// header
-	dest[0] = 0x10; // LZ compression type
-	dest[1] = (unsigned char)srcSize;
-	dest[2] = (unsigned char)(srcSize >> 8);
-	dest[3] = (unsigned char)(srcSize >> 16);
+	writer->dest[0] = 0x10; // LZ compression type
+	writer->dest[1] = (unsigned char)srcSize;
+	writer->dest[2] = (unsigned char)(srcSize >> 8);
+	writer->dest[3] = (unsigned char)(srcSize >> 16);
+
+	writer->destPos = 4;
+	writer->numBlocks = 0;
+}
+
+// Every group of eight literals and blocks is preceded by a byte of flags.
+static unsigned char *StartLZBlock(struct LZWriter *writer)
+{
+	if (writer->numBlocks++ % 8 == 0) {
+		writer->flagsPos = writer->destPos;
+		writer->dest[writer->destPos++] = 0;
+	}
+
+	return &writer->dest[writer->flagsPos];
+}
+
+static void WriteLZLiteral(struct LZWriter *writer, unsigned char value)
+{
+	StartLZBlock(writer);
+	writer->dest[writer->destPos++] = value;
+}
+
+static void WriteLZBlock(struct LZWriter *writer, int blockSize, int blockDistance)
+{
+	unsigned char *flags = StartLZBlock(writer);
+	*flags |= 0x80 >> ((writer->numBlocks - 1) % 8);
+	blockSize -= 3;
+	blockDistance--;
+	writer->dest[writer->destPos++] = (blockSize << 4) | ((unsigned int)blockDistance >> 8);
+	writer->dest[writer->destPos++] = (unsigned char)blockDistance;
+}
+
+static unsigned char *FinishLZWriter(struct LZWriter *writer, int *compressedSize)
+{
+	// Pad to multiple of 4 bytes.
+	while (writer->destPos % 4 != 0)
+		writer->dest[writer->destPos++] = 0;
+
+	*compressedSize = writer->destPos;
+	return writer->dest;
+}
+
+unsigned char *LZCompress(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	if (srcSize <= 0)
+		FATAL_ERROR("Fatal error while compressing LZ file.\n");
+
+	struct LZMatchFinder finder;
+	struct LZWriter writer;
+
+	InitLZMatchFinder(&finder, src, srcSize, minDistance);
+	InitLZWriter(&writer, srcSize);
 
 	int srcPos = 0;
-	int destPos = 4;
 
-	for (;;) {
-		unsigned char *flags = &dest[destPos++];
-		*flags = 0;
+	while (srcPos < srcSize) {
+		int blockDistance;
+		int blockSize = FindLZBlock(&finder, srcPos, &blockDistance);
 
-		for (int i = 0; i < 8; i++) {
-			int bestBlockDistance = 0;
-			int bestBlockSize = 0;
-			int blockDistance = minDistance;
+		if (blockSize != 0) {
+			WriteLZBlock(&writer, blockSize, blockDistance);
+			srcPos += blockSize;
+		} else {
+			WriteLZLiteral(&writer, src[srcPos++]);
+		}
+	}
 
-			while (blockDistance <= srcPos && blockDistance <= 0x1000) {
-				int blockStart = srcPos - blockDistance;
-				int blockSize = 0;
+	FreeLZMatchFinder(&finder);
+	return FinishLZWriter(&writer, compressedSize);
+}
 
-				while (blockSize < 18
-				    && srcPos + blockSize < srcSize
-				    && src[blockStart + blockSize] == src[srcPos + blockSize])
-					blockSize++;
+// Chooses the literals and blocks that take the fewest bits overall: a
+// literal costs 9 bits and a block 17, counting its flag. Any block can be
+// shortened, so every size up to the longest block at a position is tried.
+// The result can still round up to more bytes than the greedy encoding, so
+// the smaller of the two is returned.
+unsigned char *LZCompressOptimal(unsigned char *src, int srcSize, int *compressedSize, const int minDistance)
+{
+	unsigned char *greedy = LZCompress(src, srcSize, compressedSize, minDistance);
 
-				if (blockSize > bestBlockSize) {
-					bestBlockDistance = blockDistance;
-					bestBlockSize = blockSize;
+	int *costs = malloc((srcSize + 1) * sizeof(int));
+	int *blockSizes = malloc((srcSize + 1) * sizeof(int));
+	int *blockDistances = malloc((srcSize + 1) * sizeof(int));
 
-					if (blockSize == 18)
-						break;
-				}
+	if (costs == NULL || blockSizes == NULL || blockDistances == NULL)
+		FATAL_ERROR("Failed to allocate memory for LZ optimal parse.\n");
 
-				blockDistance++;
-			}
+	for (int i = 1; i <= srcSize; i++)
+		costs[i] = INT_MAX;
+	costs[0] = 0;
 
-			if (bestBlockSize >= 3) {
-				*flags |= (0x80 >> i);
-				srcPos += bestBlockSize;
-				bestBlockSize -= 3;
-				bestBlockDistance--;
-				dest[destPos++] = (bestBlockSize << 4) | ((unsigned int)bestBlockDistance >> 8);
-				dest[destPos++] = (unsigned char)bestBlockDistance;
-			} else {
-				dest[destPos++] = src[srcPos++];
-			}
+	struct LZMatchFinder finder;
 
-			if (srcPos == srcSize) {
-				// Pad to multiple of 4 bytes.
-				int remainder = destPos % 4;
+	InitLZMatchFinder(&finder, src, srcSize, minDistance);
 
-				if (remainder != 0) {
-					for (int i = 0; i < 4 - remainder; i++)
-						dest[destPos++] = 0;
-				}
+	for (int srcPos = 0; srcPos < srcSize; srcPos++) {
+		if (costs[srcPos] + 9 < costs[srcPos + 1]) {
+			costs[srcPos + 1] = costs[srcPos] + 9;
+			blockSizes[srcPos + 1] = 1;
+		}
 
-				*compressedSize = destPos;
-				return dest;
+		int blockDistance;
+		int longestBlockSize = FindLZBlock(&finder, srcPos, &blockDistance);
+
+		for (int blockSize = LZ_MIN_BLOCK_SIZE; blockSize <= longestBlockSize; blockSize++) {
+			if (costs[srcPos] + 17 < costs[srcPos + blockSize]) {
+				costs[srcPos + blockSize] = costs[srcPos] + 17;
+				blockSizes[srcPos + blockSize] = blockSize;
+				blockDistances[srcPos + blockSize] = blockDistance;
 			}
 		}
 	}
 
-fail:
-	FATAL_ERROR("Fatal error while compressing LZ file.\n");
+	FreeLZMatchFinder(&finder);
+
+	// Walk back from the end, then reverse the chosen steps in place.
+	int numSteps = 0;
+
+	for (int srcPos = srcSize; srcPos > 0; srcPos -= blockSizes[srcPos])
+		costs[numSteps++] = srcPos;
+
+	struct LZWriter writer;
+
+	InitLZWriter(&writer, srcSize);
+
+	int srcPos = 0;
+
+	for (int i = numSteps - 1; i >= 0; i--) {
+		int end = costs[i];
+
+		if (blockSizes[end] == 1)
+			WriteLZLiteral(&writer, src[srcPos]);
+		else
+			WriteLZBlock(&writer, blockSizes[end], blockDistances[end]);
+
+		srcPos = end;
+	}
+
+	free(costs);
+	free(blockSizes);
+	free(blockDistances);
+
+	int optimalSize;
+	unsigned char *optimal = FinishLZWriter(&writer, &optimalSize);
+
+	if (optimalSize >= *compressedSize) {
+		free(optimal);
+		return greedy;
+	}
+
+	free(greedy);
+	*compressedSize = optimalSize;
+	return optimal;
 }
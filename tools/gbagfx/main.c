@@ -13,6 +13,7 @@
 #include "rl.h"
 #include "font.h"
 #include "huff.h"
+#include "cache.h"
 
 struct CommandHandler
 {
@@ -426,6 +427,8 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
 {
     int overflowSize = 0;
     int minDistance = 2; // default, for compatibility with DecompressDataWithHeaderVram()
+    bool optimal = false;
+    bool verify = false;
 
     for (int i = 3; i < argc; i++)
     {
@@ -457,6 +460,14 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
             if (minDistance < 1)
                 FATAL_ERROR("LZ min search distance must be positive.\n");
         }
+        else if (strcmp(option, "-optimal") == 0)
+        {
+            optimal = true;
+        }
+        else if (strcmp(option, "-verify") == 0)
+        {
+            verify = true;
+        }
         else
         {
             FATAL_ERROR("Unrecognized option \"%s\".\n", option);
@@ -472,12 +483,38 @@ void HandleLZCompressCommand(char *inputPath, char *outputPath, int argc, char *
     int fileSize;
     unsigned char *buffer = ReadWholeFileZeroPadded(inputPath, &fileSize, overflowSize);
 
+    struct AssetCache cache;
+    InitAssetCache(&cache, argv[0], "lz", argc, argv, buffer, fileSize + overflowSize);
+
     int compressedSize;
-    unsigned char *compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+    unsigned char *compressedData = ReadAssetCache(&cache, &compressedSize);
+
+    if (compressedData == NULL)
+    {
+        if (optimal)
+            compressedData = LZCompressOptimal(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+        else
+            compressedData = LZCompress(buffer, fileSize + overflowSize, &compressedSize, minDistance);
+
+        compressedData[1] = (unsigned char)fileSize;
+        compressedData[2] = (unsigned char)(fileSize >> 8);
+        compressedData[3] = (unsigned char)(fileSize >> 16);
+
+        WriteAssetCache(&cache, compressedData, compressedSize);
+    }
+
+    FreeAssetCache(&cache);
+
+    if (verify)
+    {
+        int uncompressedSize;
+        unsigned char *uncompressedData = LZDecompress(compressedData, compressedSize, &uncompressedSize);
 
-    compressedData[1] = (unsigned char)fileSize;
-    compressedData[2] = (unsigned char)(fileSize >> 8);
-    compressedData[3] = (unsigned char)(fileSize >> 16);
+        if (uncompressedSize != fileSize || memcmp(uncompressedData, buffer, fileSize) != 0)
+            FATAL_ERROR("LZ compressed \"%s\" does not decompress to the input.\n", inputPath);
+
+        free(uncompressedData);
+    }
 
     free(buffer);
 
@@ -501,14 +538,24 @@ void HandleLZDecompressCommand(char *inputPath, char *outputPath, int argc UNUSE
     free(uncompressedData);
 }
 
-void HandleRLCompressCommand(char *inputPath, char *outputPath, int argc UNUSED, char **argv UNUSED)
+void HandleRLCompressCommand(char *inputPath, char *outputPath, int argc, char **argv)
 {
     int fileSize;
     unsigned char *buffer = ReadWholeFile(inputPath, &fileSize);
 
+    struct AssetCache cache;
+    InitAssetCache(&cache, argv[0], "rl", argc, argv, buffer, fileSize);
+
     int compressedSize;
-    unsigned char *compressedData = RLCompress(buffer, fileSize, &compressedSize);
+    unsigned char *compressedData = ReadAssetCache(&cache, &compressedSize);
 
+    if (compressedData == NULL)
+    {
+        compressedData = RLCompress(buffer, fileSize, &compressedSize);
+        WriteAssetCache(&cache, compressedData, compressedSize);
+    }
+
+    FreeAssetCache(&cache);
     free(buffer);
 
     WriteWholeFile(outputPath, compressedData, compressedSize);
@@ -561,9 +608,19 @@ void HandleHuffCompressCommand(char *inputPath, char *outputPath, int argc, char
 
     unsigned char *buffer = ReadWholeFile(inputPath, &fileSize);
 
+    struct AssetCache cache;
+    InitAssetCache(&cache, argv[0], "huff", argc, argv, buffer, fileSize);
+
     int compressedSize;
-    unsigned char *compressedData = HuffCompress(buffer, fileSize, &compressedSize, bitDepth);
+    unsigned char *compressedData = ReadAssetCache(&cache, &compressedSize);
 
+    if (compressedData == NULL)
+    {
+        compressedData = HuffCompress(buffer, fileSize, &compressedSize, bitDepth);
+        WriteAssetCache(&cache, compressedData, compressedSize);
+    }
+
+    FreeAssetCache(&cache);
     free(buffer);
 
     WriteWholeFile(outputPath, compressedData, compressedSize);
@@ -590,6 +647,12 @@ int main(int argc, char **argv)
 {
     char converted = 0;
 
+    if (argc == 2 && strcmp(argv[1], "--cache-stats") == 0)
+    {
+        PrintAssetCacheStats("gbagfx");
+        return 0;
+    }
+
     if (argc < 3)
         FATAL_ERROR("Usage: gbagfx INPUT_PATH OUTPUT_PATH [options...]\n");
 
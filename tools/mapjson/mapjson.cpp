@@ -24,6 +24,12 @@ using std::ostringstream;
 #include <limits>
 using std::numeric_limits;
 
+#include <thread>
+using std::thread;
+
+#include <atomic>
+using std::atomic;
+
 #include "json11.h"
 using json11::Json;
 
@@ -63,6 +69,22 @@ void write_text_file(string filepath, string text) {
     out_file.close();
 }
 
+// Leaves the file (and its timestamp) alone if it already has this content,
+// so that nothing which depends on it has to be rebuilt.
+void write_text_file_if_changed(string filepath, string text) {
+    ifstream in_file(filepath, std::ifstream::binary);
+
+    if (in_file.is_open()) {
+        ostringstream old_text;
+        old_text << in_file.rdbuf();
+        in_file.close();
+        if (old_text.str() == text)
+            return;
+    }
+
+    write_text_file(filepath, text);
+}
+
 
 string json_to_string(const Json &data, const string &field = "", bool silent = false) {
     const Json value = !field.empty() ? data[field] : data;
@@ -119,20 +141,30 @@ string get_include_guard_end(const string &name) {
     return guard.str();
 }
 
-string generate_map_header_text(Json map_data, Json layouts_data) {
-    string map_layout_id = json_to_string(map_data, "layout");
+// Layouts by ID. An ID that is shared by more than one layout maps to null.
+typedef map<string, Json> LayoutIndex;
 
-    vector<Json> matched;
+LayoutIndex index_layouts(Json layouts_data) {
+    LayoutIndex layouts;
 
     for (auto &layout : layouts_data["layouts"].array_items()) {
-        if (map_layout_id == json_to_string(layout, "id", true))
-            matched.push_back(layout);
+        auto inserted = layouts.insert({json_to_string(layout, "id", true), layout});
+        if (!inserted.second)
+            inserted.first->second = Json();
     }
 
-    if (matched.size() != 1)
+    return layouts;
+}
+
+string generate_map_header_text(Json map_data, const LayoutIndex &layouts) {
+    string map_layout_id = json_to_string(map_data, "layout");
+
+    auto matched = layouts.find(map_layout_id);
+
+    if (matched == layouts.end() || matched->second == Json())
         FATAL_ERROR("Failed to find matching layout for %s.\n", map_layout_id.c_str());
 
-    Json layout = matched[0];
+    Json layout = matched->second;
 
     ostringstream text;
 
@@ -367,28 +399,63 @@ string file_parent(string filename){
     return filename.substr(0, dir_pos + 1);
 }
 
-void process_map(string map_filepath, string layouts_filepath, string output_dir) {
-    string mapdata_err, layouts_err;
+Json read_layouts_file(string layouts_filepath) {
+    string layouts_err;
 
-    string mapdata_json_text = read_text_file(map_filepath);
     string layouts_json_text = read_text_file(layouts_filepath);
 
-    Json map_data = Json::parse(mapdata_json_text, mapdata_err);
-    if (map_data == Json())
-        FATAL_ERROR("%s\n", mapdata_err.c_str());
-
     Json layouts_data = Json::parse(layouts_json_text, layouts_err);
     if (layouts_data == Json())
         FATAL_ERROR("%s\n", layouts_err.c_str());
 
-    string header_text = generate_map_header_text(map_data, layouts_data);
+    return layouts_data;
+}
+
+void write_map_files(string map_filepath, const LayoutIndex &layouts, string output_dir, bool only_if_changed) {
+    string mapdata_err;
+
+    string mapdata_json_text = read_text_file(map_filepath);
+
+    Json map_data = Json::parse(mapdata_json_text, mapdata_err);
+    if (map_data == Json())
+        FATAL_ERROR("%s\n", mapdata_err.c_str());
+
+    string header_text = generate_map_header_text(map_data, layouts);
     string events_text = generate_map_events_text(map_data);
     string connections_text = generate_map_connections_text(map_data);
 
     string out_dir = strip_trailing_separator(output_dir).append(sep);
-    write_text_file(out_dir + "header.inc", header_text);
-    write_text_file(out_dir + "events.inc", events_text);
-    write_text_file(out_dir + "connections.inc", connections_text);
+    auto write = only_if_changed ? write_text_file_if_changed : write_text_file;
+    write(out_dir + "header.inc", header_text);
+    write(out_dir + "events.inc", events_text);
+    write(out_dir + "connections.inc", connections_text);
+}
+
+void process_map(string map_filepath, string layouts_filepath, string output_dir) {
+    LayoutIndex layouts = index_layouts(read_layouts_file(layouts_filepath));
+
+    write_map_files(map_filepath, layouts, output_dir, false);
+}
+
+// Like process_map for every map at once, writing each map's files next to
+// its map.json. layouts.json is only parsed once, and the maps are split
+// between threads.
+void process_maps(string layouts_filepath, const vector<string> &map_filepaths) {
+    const LayoutIndex layouts = index_layouts(read_layouts_file(layouts_filepath));
+
+    atomic<size_t> next_map(0);
+    auto worker = [&]() {
+        for (size_t i = next_map++; i < map_filepaths.size(); i = next_map++)
+            write_map_files(map_filepaths[i], layouts, file_parent(map_filepaths[i]), true);
+    };
+
+    size_t num_threads = std::min<size_t>(std::max(thread::hardware_concurrency(), 1u), map_filepaths.size());
+    vector<thread> threads;
+    for (size_t i = 1; i < num_threads; i++)
+        threads.emplace_back(worker);
+    worker();
+    for (thread &t : threads)
+        t.join();
 }
 
 void process_event_constants(const vector<string> &map_filepaths, string output_ids_file) {
@@ -708,6 +775,20 @@ int main(int argc, char *argv[]) {
 
         process_map(filepath, layouts_filepath, output_dir);
     }
+    else if (mode == "maps") {
+        if (argc < 5)
+            FATAL_ERROR("USAGE: mapjson maps <game-version> <layouts_file> <map_file> [additional_map_files]\n");
+
+        infer_separator(argv[4]);
+        string layouts_filepath(argv[3]);
+
+        vector<string> filepaths;
+        for (int i = 4; i < argc; i++) {
+            filepaths.push_back(argv[i]);
+        }
+
+        process_maps(layouts_filepath, filepaths);
+    }
     else if (mode == "groups") {
         if (argc != 6)
             FATAL_ERROR("USAGE: mapjson groups <game-version> <groups_file> <output_asm_dir> <output_c_dir>\n");
@@ -747,7 +828,7 @@ int main(int argc, char *argv[]) {
         process_event_constants(filepaths, output_ids_file);
     }
     else {
-        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'event_constants', or 'groups'.\n");
+        FATAL_ERROR("ERROR: <mode> must be 'layouts', 'map', 'maps', 'event_constants', or 'groups'.\n");
     }
 
     return 0;
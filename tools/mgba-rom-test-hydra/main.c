@@ -14,6 +14,15 @@
  * P/K/F/A: Sets the result to the remaining of the line, flushes any
  *    output since the previous P/K/F/A and increment the number of
  *    passes/known fails/assumption fails/fails.
+ * H: Sets the peak heap usage of the current test, followed by the
+ *    heap size, in bytes.
+ * S: Adds an allocation site to the current test: the number of
+ *    allocations, the total, peak live, and live at the heap peak
+ *    bytes, then the location in the remainder of the line.
+ * C: Records the cost of a test: the number of 1024 cycle ticks it
+ *    took, its estimated cost, then its name in the remainder of the
+ *    line. If a timings file is passed, the costs are saved to it, and
+ *    the next run assigns tests to runners based on them.
  */
 #include <fcntl.h>
 #include <math.h>
@@ -40,6 +49,8 @@
 #define MAX_PROCESSES               32 // See also test/test.h
 #define MAX_SUMMARY_TESTS_TO_LIST   50
 #define MAX_TEST_LIST_BUFFER_LENGTH 256
+#define MAX_HEAP_SUMMARY_ENTRIES    10
+#define MAX_TEST_TIMINGS            8192 // See also test/test.h
 
 #define ARRAY_COUNT(arr) (sizeof((arr)) / sizeof((arr)[0]))
 
@@ -63,6 +74,7 @@ struct Runner
     int assumptionFails;
     int fails;
     int results;
+    size_t heap_test; // 1 + the index in heap_tests of the current test, or 0.
     char failed_TestNames[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
     char failed_TestFilenameLine[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
     char knownFailingPassed_TestNames[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
@@ -71,6 +83,33 @@ struct Runner
     char assumeFailed_FilenameLine[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
 };
 
+struct HeapTest
+{
+    char test_name[256];
+    unsigned long peak_bytes;
+    unsigned long heap_size;
+    // The allocation site with the most bytes live at the peak.
+    char largest_location[256];
+    unsigned long largest_bytes;
+};
+
+struct HeapSite
+{
+    char location[256];
+    unsigned long allocations;
+    unsigned long total_bytes;
+    unsigned long peak_live_bytes;
+    char peak_test_name[256];
+};
+
+struct TestTiming
+{
+    char name[256];
+    unsigned long ticks;
+    unsigned long estimate;
+    bool measured; // Whether ticks is from this run.
+};
+
 struct Symbol {
     const char *name;
     uint32_t address;
@@ -86,6 +125,17 @@ static unsigned nrunners = 0;
 static unsigned runners_digits = 0;
 static struct Runner *runners = NULL;
 
+static struct HeapTest *heap_tests = NULL;
+static size_t heap_tests_n = 0;
+static size_t heap_tests_c = 0;
+static struct HeapSite *heap_sites = NULL;
+static size_t heap_sites_n = 0;
+static size_t heap_sites_c = 0;
+
+static struct TestTiming *test_timings = NULL;
+static size_t test_timings_n = 0;
+static size_t test_timings_c = 0;
+
 // TODO: Build the symbol table on demand.
 static struct SymbolTable symbol_table = { NULL, 0 };
 
@@ -192,6 +242,385 @@ static void fprint_buffer(FILE *f, const char *buffer, size_t size)
     }
 }
 
+static void handle_heap_test(struct Runner *runner, const char *soc)
+{
+    struct HeapTest test = {0};
+    if (sscanf(soc, "%lu %lu", &test.peak_bytes, &test.heap_size) != 2)
+        return;
+    strcpy(test.test_name, runner->test_name);
+    if (heap_tests_n == heap_tests_c)
+    {
+        heap_tests_c = heap_tests_c ? heap_tests_c * 2 : 256;
+        heap_tests = realloc(heap_tests, heap_tests_c * sizeof(*heap_tests));
+        if (!heap_tests)
+        {
+            perror("realloc heap_tests failed");
+            exit(2);
+        }
+    }
+    heap_tests[heap_tests_n++] = test;
+    runner->heap_test = heap_tests_n;
+}
+
+static void handle_heap_site(struct Runner *runner, const char *soc, const char *eol)
+{
+    unsigned long allocations, total_bytes, peak_live_bytes, bytes_at_peak;
+    int location_offset;
+    if (sscanf(soc, "%lu %lu %lu %lu %n", &allocations, &total_bytes, &peak_live_bytes, &bytes_at_peak, &location_offset) != 4)
+        return;
+
+    char location[256];
+    size_t location_n = eol - (soc + location_offset) - 1;
+    if (location_n >= sizeof(location))
+        location_n = sizeof(location) - 1;
+    memcpy(location, soc + location_offset, location_n);
+    location[location_n] = '\0';
+
+    if (runner->heap_test)
+    {
+        struct HeapTest *test = &heap_tests[runner->heap_test - 1];
+        if (bytes_at_peak > test->largest_bytes)
+        {
+            test->largest_bytes = bytes_at_peak;
+            strcpy(test->largest_location, location);
+        }
+    }
+
+    struct HeapSite *site = NULL;
+    for (size_t j = 0; j < heap_sites_n; j++)
+    {
+        if (strcmp(heap_sites[j].location, location) == 0)
+        {
+            site = &heap_sites[j];
+            break;
+        }
+    }
+    if (site == NULL)
+    {
+        if (heap_sites_n == heap_sites_c)
+        {
+            heap_sites_c = heap_sites_c ? heap_sites_c * 2 : 256;
+            heap_sites = realloc(heap_sites, heap_sites_c * sizeof(*heap_sites));
+            if (!heap_sites)
+            {
+                perror("realloc heap_sites failed");
+                exit(2);
+            }
+        }
+        site = &heap_sites[heap_sites_n++];
+        memset(site, 0, sizeof(*site));
+        strcpy(site->location, location);
+    }
+    site->allocations += allocations;
+    site->total_bytes += total_bytes;
+    if (peak_live_bytes > site->peak_live_bytes)
+    {
+        site->peak_live_bytes = peak_live_bytes;
+        strcpy(site->peak_test_name, runner->test_name);
+    }
+}
+
+static int compare_heap_tests(const void *a, const void *b)
+{
+    const struct HeapTest *ta = a, *tb = b;
+    if (ta->peak_bytes > tb->peak_bytes)
+        return -1;
+    else if (ta->peak_bytes == tb->peak_bytes)
+        return 0;
+    else
+        return 1;
+}
+
+static int compare_heap_sites(const void *a, const void *b)
+{
+    const struct HeapSite *sa = a, *sb = b;
+    if (sa->peak_live_bytes > sb->peak_live_bytes)
+        return -1;
+    else if (sa->peak_live_bytes == sb->peak_live_bytes)
+        return 0;
+    else
+        return 1;
+}
+
+static void print_heap_summary(void)
+{
+    qsort(heap_tests, heap_tests_n, sizeof(*heap_tests), compare_heap_tests);
+    qsort(heap_sites, heap_sites_n, sizeof(*heap_sites), compare_heap_sites);
+
+    fprintf(stdout, "\n  Tests with the highest \e[34mHEAP\e[0m usage:\n");
+    for (size_t i = 0; i < heap_tests_n && i < MAX_HEAP_SUMMARY_ENTRIES; i++)
+    {
+        const struct HeapTest *test = &heap_tests[i];
+        fprintf(stdout, "  - %lu/%lu bytes (%lu%%) - %s.", test->peak_bytes, test->heap_size, test->heap_size ? test->peak_bytes * 100 / test->heap_size : 0, test->test_name);
+        if (test->largest_bytes > 0)
+            fprintf(stdout, " Largest at the peak: %s (%lu bytes)", test->largest_location, test->largest_bytes);
+        fprintf(stdout, "\n");
+    }
+
+    fprintf(stdout, "\n  Allocation sites with the most live \e[34mHEAP\e[0m bytes:\n");
+    for (size_t i = 0; i < heap_sites_n && i < MAX_HEAP_SUMMARY_ENTRIES; i++)
+    {
+        const struct HeapSite *site = &heap_sites[i];
+        fprintf(stdout, "  - %s: %lu bytes in %s. %lu allocations, %lu bytes in total\n", site->location, site->peak_live_bytes, site->peak_test_name, site->allocations, site->total_bytes);
+    }
+}
+
+// FNV-1a, see also test/test_runner.c
+static uint32_t hash_test_name(const char *name)
+{
+    uint32_t hash = 2166136261u;
+    while (*name)
+    {
+        hash ^= (unsigned char)*name++;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static struct TestTiming *find_test_timing(const char *name)
+{
+    for (size_t i = 0; i < test_timings_n; i++)
+    {
+        if (strcmp(test_timings[i].name, name) == 0)
+            return &test_timings[i];
+    }
+    return NULL;
+}
+
+static struct TestTiming *add_test_timing(const char *name)
+{
+    if (test_timings_n == test_timings_c)
+    {
+        test_timings_c = test_timings_c ? test_timings_c * 2 : 1024;
+        test_timings = realloc(test_timings, test_timings_c * sizeof(*test_timings));
+        if (!test_timings)
+        {
+            perror("realloc test_timings failed");
+            exit(2);
+        }
+    }
+    struct TestTiming *timing = &test_timings[test_timings_n++];
+    memset(timing, 0, sizeof(*timing));
+    strncpy(timing->name, name, sizeof(timing->name) - 1);
+    return timing;
+}
+
+static void handle_test_timing(const char *soc, const char *eol)
+{
+    unsigned long ticks, estimate;
+    int name_offset;
+    if (sscanf(soc, "%lu %lu %n", &ticks, &estimate, &name_offset) != 2)
+        return;
+
+    char name[256];
+    size_t name_n = eol - (soc + name_offset) - 1;
+    if (name_n >= sizeof(name))
+        name_n = sizeof(name) - 1;
+    memcpy(name, soc + name_offset, name_n);
+    name[name_n] = '\0';
+
+    struct TestTiming *timing = find_test_timing(name);
+    if (timing == NULL)
+        timing = add_test_timing(name);
+    // Tests with the same name share a timing.
+    if (!timing->measured)
+    {
+        timing->ticks = 0;
+        timing->estimate = 0;
+        timing->measured = true;
+    }
+    timing->ticks += ticks;
+    timing->estimate += estimate;
+}
+
+static void read_test_timings(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+        return;
+
+    char line[512];
+    while (fgets(line, sizeof(line), f))
+    {
+        unsigned long ticks, estimate;
+        int name_offset;
+        if (sscanf(line, "%lu %lu %n", &ticks, &estimate, &name_offset) != 2)
+            continue;
+        line[strcspn(line, "\n")] = '\0';
+        struct TestTiming *timing = add_test_timing(line + name_offset);
+        timing->ticks = ticks;
+        timing->estimate = estimate;
+    }
+    fclose(f);
+}
+
+static int compare_test_timings_by_name(const void *a, const void *b)
+{
+    const struct TestTiming *ta = a, *tb = b;
+    return strcmp(ta->name, tb->name);
+}
+
+static void *find_symbol_data(void *elf, const char *name, size_t *size)
+{
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+    if (ehdr->e_shstrndx == SHN_UNDEF)
+        return NULL;
+    const char *shstr = (const char *)(elf + shdrs[ehdr->e_shstrndx].sh_offset);
+    const Elf32_Shdr *shdr_symtab = NULL;
+    const Elf32_Shdr *shdr_strtab = NULL;
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        const char *sh_name = shstr + shdrs[i].sh_name;
+        if (strcmp(sh_name, ".symtab") == 0)
+            shdr_symtab = &shdrs[i];
+        else if (strcmp(sh_name, ".strtab") == 0)
+            shdr_strtab = &shdrs[i];
+    }
+    if (!shdr_symtab || !shdr_strtab)
+        return NULL;
+
+    const Elf32_Sym *symtab = (Elf32_Sym *)(elf + shdr_symtab->sh_offset);
+    const char *strtab = (const char *)(elf + shdr_strtab->sh_offset);
+    for (int i = 0; i < shdr_symtab->sh_size / shdr_symtab->sh_entsize; i++)
+    {
+        if (symtab[i].st_name == 0) continue;
+        if (symtab[i].st_shndx > ehdr->e_shnum) continue;
+        if (strcmp(strtab + symtab[i].st_name, name) != 0) continue;
+        const Elf32_Shdr *shdr = &shdrs[symtab[i].st_shndx];
+        *size = symtab[i].st_size;
+        return elf + shdr->sh_offset + (symtab[i].st_value - shdr->sh_addr);
+    }
+    return NULL;
+}
+
+// Only keeps the timings of tests that ran, and of tests that the
+// filter in gTestRunnerArgv skipped. A test that should have run but
+// didn't was deleted or renamed, and its timing would skew how the
+// next run balances the runners.
+static void write_test_timings(const char *path, void *elf)
+{
+    size_t argv_size;
+    const char *argv = find_symbol_data(elf, "gTestRunnerArgv", &argv_size);
+    size_t argv_n = argv ? strnlen(argv, argv_size) : 0;
+
+    char temp_path[FILENAME_MAX];
+    snprintf(temp_path, sizeof(temp_path), "%s.%d.tmp", path, getpid());
+    FILE *f = fopen(temp_path, "w");
+    if (f == NULL)
+    {
+        perror("fopen test timings failed");
+        return;
+    }
+    qsort(test_timings, test_timings_n, sizeof(*test_timings), compare_test_timings_by_name);
+    for (size_t i = 0; i < test_timings_n; i++)
+    {
+        if (!test_timings[i].measured && (argv == NULL || strncmp(test_timings[i].name, argv, argv_n) == 0))
+            continue;
+        fprintf(f, "%lu %lu %s\n", test_timings[i].ticks, test_timings[i].estimate, test_timings[i].name);
+    }
+    if (fclose(f) != 0 || rename(temp_path, path) == -1)
+    {
+        perror("write test timings failed");
+        unlink(temp_path);
+    }
+}
+
+struct TestAssignment
+{
+    uint32_t name_hash;
+    uint32_t cost;
+    uint32_t runner;
+};
+
+static int compare_assignments_by_hash(const void *a, const void *b)
+{
+    const struct TestAssignment *aa = a, *ab = b;
+    if (aa->name_hash < ab->name_hash)
+        return -1;
+    else if (aa->name_hash == ab->name_hash)
+        return 0;
+    else
+        return 1;
+}
+
+static int compare_assignments_by_cost(const void *a, const void *b)
+{
+    const struct TestAssignment *aa = a, *ab = b;
+    if (aa->cost > ab->cost)
+        return -1;
+    else if (aa->cost == ab->cost)
+        return compare_assignments_by_hash(a, b);
+    else
+        return 1;
+}
+
+// Assigns every test with a timing to a runner, longest first, and
+// patches the assignments into the ROM. The runners greedily assign
+// the remaining tests around them.
+static void assign_test_timings(void *elf)
+{
+    size_t argv_size, timings_size, count_size, scale_size;
+    const char *argv = find_symbol_data(elf, "gTestRunnerArgv", &argv_size);
+    uint8_t *timings = find_symbol_data(elf, "gTestRunnerTimings", &timings_size);
+    uint32_t *count = find_symbol_data(elf, "gTestRunnerTimingsCount", &count_size);
+    uint32_t *scale = find_symbol_data(elf, "gTestRunnerCostScale", &scale_size);
+    if (!argv || !timings || !count || !scale || test_timings_n == 0)
+        return;
+
+    struct TestAssignment *assignments = calloc(test_timings_n, sizeof(*assignments));
+    if (!assignments)
+    {
+        perror("calloc assignments failed");
+        exit(2);
+    }
+    unsigned long total_ticks = 0, total_estimate = 0;
+    size_t assignments_n = 0;
+    for (size_t i = 0; i < test_timings_n; i++)
+    {
+        total_ticks += test_timings[i].ticks;
+        total_estimate += test_timings[i].estimate;
+        if (strncmp(test_timings[i].name, argv, strnlen(argv, argv_size)) != 0)
+            continue;
+        assignments[assignments_n].name_hash = hash_test_name(test_timings[i].name);
+        assignments[assignments_n].cost = test_timings[i].ticks;
+        assignments_n++;
+    }
+
+    // Tests whose names hash the same are assigned together.
+    qsort(assignments, assignments_n, sizeof(*assignments), compare_assignments_by_hash);
+    size_t merged_n = 0;
+    for (size_t i = 0; i < assignments_n; i++)
+    {
+        if (merged_n > 0 && assignments[merged_n - 1].name_hash == assignments[i].name_hash)
+            assignments[merged_n - 1].cost += assignments[i].cost;
+        else
+            assignments[merged_n++] = assignments[i];
+    }
+
+    qsort(assignments, merged_n, sizeof(*assignments), compare_assignments_by_cost);
+    if (merged_n > timings_size / sizeof(*assignments))
+        merged_n = timings_size / sizeof(*assignments);
+    unsigned long loads[MAX_PROCESSES] = {0};
+    for (size_t i = 0; i < merged_n; i++)
+    {
+        unsigned runner = 0;
+        for (unsigned j = 1; j < nrunners; j++)
+        {
+            if (loads[j] < loads[runner])
+                runner = j;
+        }
+        assignments[i].runner = runner;
+        loads[runner] += assignments[i].cost;
+    }
+
+    qsort(assignments, merged_n, sizeof(*assignments), compare_assignments_by_hash);
+    memcpy(timings, assignments, merged_n * sizeof(*assignments));
+    *count = merged_n;
+    *scale = total_estimate ? (total_ticks + total_estimate - 1) / total_estimate : 1;
+    free(assignments);
+}
+
 static void handle_read(int i, struct Runner *runner)
 {
     char *sol = runner->input_buffer;
@@ -237,6 +666,15 @@ static void handle_read(int i, struct Runner *runner)
                     strncpy(runner->filename_line, soc, eol - soc - 1);
                     runner->filename_line[eol - soc - 1] = '\0';
                     break;
+                case 'H':
+                    handle_heap_test(runner, soc + 2);
+                    break;
+                case 'S':
+                    handle_heap_site(runner, soc + 2, eol);
+                    break;
+                case 'C':
+                    handle_test_timing(soc + 2, eol);
+                    break;
 
                 case 'P':
                     runner->passes++;
@@ -272,6 +710,7 @@ static void handle_read(int i, struct Runner *runner)
                     runner->fails++;
 add_to_results:
                     runner->results++;
+                    runner->heap_test = 0;
                     soc += 2;
                     fprintf(stdout, "[%0*d] %s: ", runners_digits, i, runner->test_name);
                     fwrite(soc, 1, eol - soc, stdout);
@@ -428,7 +867,7 @@ int main(int argc, char *argv[])
 {
     if (argc < 4)
     {
-        fprintf(stderr, "usage %s mgba-rom-test objcopy rom\n", argv[0]);
+        fprintf(stderr, "usage %s mgba-rom-test objcopy rom [timings]\n", argv[0]);
         exit(2);
     }
 
@@ -469,7 +908,8 @@ int main(int argc, char *argv[])
     }
 
     void *elf;
-    if ((elf = mmap(NULL, elfst.st_size, PROT_READ, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
+    // Writes only change the copies passed to the runners.
+    if ((elf = mmap(NULL, elfst.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
     {
         perror("mmap elffd failed");
         exit(2);
@@ -520,6 +960,14 @@ int main(int argc, char *argv[])
             fprintf(stdout, "[%0*d] %s\n", runners_digits, i, runners[i].test_name);
     }
     fflush(stdout);
+
+    const char *timings_path = argc > 4 ? argv[4] : NULL;
+    if (timings_path)
+    {
+        read_test_timings(timings_path);
+        assign_test_timings(elf);
+    }
+
     atexit(unlink_roms);
     signal(SIGINT, exit2);
     signal(SIGTERM, exit2);
@@ -852,6 +1300,9 @@ int main(int argc, char *argv[])
             }
         }
 
+        if (heap_tests_n > 0)
+            print_heap_summary();
+
         fprintf(stdout, "\n");
         if (fails > 0)
             fprintf(stdout, "- Tests \e[31mFAILED\e[0m :         %d    Add TESTS='X' to run tests with the defined prefix.\n", fails);
@@ -868,6 +1319,9 @@ int main(int argc, char *argv[])
     }
     fprintf(stdout, "\n");
 
+    if (timings_path)
+        write_test_timings(timings_path, elf);
+
     fflush(stdout);
     return exit_code;
 }
@@ -20,6 +20,34 @@ times_of_day = {
 base_season = "SEASON_SPRING"
 base_time = "TIME_MORNING"
 
+versions = ["FIRERED", "LEAFGREEN"]
+
+map_define_pattern = re.compile(r"#define\s+(MAP_\w+)\s+\((\d+) \| \((\d+) << 8\)\)")
+map_groups_count_pattern = re.compile(r"#define\s+MAP_GROUPS_COUNT\s+(\d+)")
+
+class MapGroups:
+    def __init__(self, map_groups_file_name):
+        self.maps = {}
+        self.group_sizes = []
+
+        with open(map_groups_file_name, 'r') as map_groups_file:
+            for line in map_groups_file:
+                m = map_define_pattern.match(line)
+                if m:
+                    self.maps[m.group(1)] = (int(m.group(3)), int(m.group(2)))
+                m = map_groups_count_pattern.match(line)
+                if m:
+                    self.group_sizes = int(m.group(1)) * [0]
+
+        for map_group, map_num in self.maps.values():
+            self.group_sizes[map_group] = max(self.group_sizes[map_group], map_num + 1)
+
+    def GetGroupStarts(self):
+        starts = [0]
+        for size in self.group_sizes:
+            starts.append(starts[-1] + size)
+        return starts
+
 class Config:
     def __init__(self, config_file_name):
         self.time_encounters = None
@@ -75,10 +103,11 @@ class Config:
             self.time_fallback = m.group(1)
 
 class WildEncounterAssembler:
-    def __init__(self, output_file, json_data, config):
+    def __init__(self, output_file, json_data, config, map_groups):
         self.output_file = output_file
         self.json_data = json_data
         self.config = config
+        self.map_groups = map_groups
     
     def WriteLine(self, line="", indents = 0):
         self.output_file.write(4 * indents * " " + line + "\n")
@@ -218,6 +247,48 @@ class WildEncounterAssembler:
         self.WriteTerminator()
         self.WriteLine("};")
 
+        if label == "gWildMonHeaders":
+            self.WriteHeaderIdsByMap(headers)
+
+    # Lets GetCurrentMapWildMonHeaderId find the first header of the current map
+    # without searching gWildMonHeaders. Each map group's maps are stored together,
+    # starting at sWildMonHeaderIdMapGroupStarts[mapGroup].
+    def WriteHeaderIdsByMap(self, headers):
+        header_ids = {version: {} for version in versions}
+        header_counts = {version: 0 for version in versions}
+        for shared_label in headers["data"]:
+            version = "FIRERED"
+            if "LeafGreen" in shared_label:
+                version = "LEAFGREEN"
+            map_name = headers["data"][shared_label]["map"]
+            if map_name not in self.map_groups.maps:
+                raise Exception(f"{shared_label}: {map_name} is not in include/constants/map_groups.h")
+            header_ids[version].setdefault(map_name, header_counts[version])
+            header_counts[version] += 1
+
+        map_names = {}
+        for map_name, (map_group, map_num) in self.map_groups.maps.items():
+            map_names[(map_group, map_num)] = map_name
+
+        self.WriteLine()
+        self.WriteLine("static const u16 sWildMonHeaderIdMapGroupStarts[MAP_GROUPS_COUNT + 1] =")
+        self.WriteLine("{")
+        for start in self.map_groups.GetGroupStarts():
+            self.WriteLine(f"{start},", 1)
+        self.WriteLine("};")
+        self.WriteLine()
+        self.WriteLine(f"static const u16 sWildMonHeaderIdsByMap[{self.map_groups.GetGroupStarts()[-1]}] =")
+        self.WriteLine("{")
+        for version in versions:
+            self.WriteLine(f"#ifdef {version}")
+            for map_group, group_size in enumerate(self.map_groups.group_sizes):
+                for map_num in range(group_size):
+                    map_name = map_names.get((map_group, map_num))
+                    header_id = header_ids[version].get(map_name, "HEADER_NONE")
+                    self.WriteLine(f"{header_id}, // {map_name}", 1)
+            self.WriteLine(f"#endif")
+        self.WriteLine("};")
+
                 
     def WriteEncounters(self):
         wild_encounter_groups = self.json_data["wild_encounter_groups"]
@@ -259,6 +330,7 @@ class WildEncounterAssembler:
                     headers["data"][shared_label][season] = {}
                 if time not in headers["data"][shared_label][season]:
                     headers["data"][shared_label][season][time] = {}
+                headers["data"][shared_label]["map"] = map_name
                 headers["data"][shared_label]["mapGroup"] = map_group
                 headers["data"][shared_label]["mapNum"] = map_num
 
@@ -286,7 +358,8 @@ class WildEncounterAssembler:
 def ConvertToHeaderFile(json_data):
     with open('src/data/wild_encounters.h', 'w') as output_file:
         config = Config('include/config/overworld.h')
-        assembler = WildEncounterAssembler(output_file, json_data, config)
+        map_groups = MapGroups('include/constants/map_groups.h')
+        assembler = WildEncounterAssembler(output_file, json_data, config, map_groups)
         assembler.WriteHeader()
         assembler.WriteMacros()
         assembler.WriteEncounters()